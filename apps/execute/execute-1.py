@@ -37,6 +37,7 @@
 
 import sys
 import pathlib
+import contextlib
 import traceback
 
 import imath
@@ -111,6 +112,18 @@ class execute( Gaffer.Application ) :
 					},
 				),
 
+				IECore.FileNameParameter(
+					name = "traceFile",
+					description = "Records the start and finish of every process during "
+						"execution, and writes them to the specified file as a timeline that "
+						"can be viewed in https://ui.perfetto.dev or `chrome://tracing`. Use a "
+						"\".json\" extension for the Chrome trace format and \".pftrace\" for "
+						"the Perfetto protobuf format.",
+					defaultValue = "",
+					allowEmptyString = True,
+					extensions = "json pftrace",
+				),
+
 			]
 
 		)
@@ -169,25 +182,40 @@ class execute( Gaffer.Application ) :
 		# accidentally using the default frame set in the script
 		del context["frame"]
 
-		with context :
-			for node in nodes :
-				node.errorSignal().connect( Gaffer.WeakMethod( self.__error ), scoped = False )
+		traceMonitor = Gaffer.TraceMonitor() if args["traceFile"].value else None
+
+		result = 0
+		try :
+			with context, traceMonitor or contextlib.nullcontext() :
+				for node in nodes :
+					node.errorSignal().connect( Gaffer.WeakMethod( self.__error ), scoped = False )
+					try :
+						node["task"].executeSequence( frames )
+					except Exception as exception :
+						IECore.msg(
+							IECore.Msg.Level.Debug,
+							"gaffer execute : executing %s" % node.relativeName( scriptNode ),
+							traceback.format_exc().strip(),
+						)
+						IECore.msg(
+							IECore.Msg.Level.Error,
+							"gaffer execute : executing %s" % node.relativeName( scriptNode ),
+							"See previous message for details",
+						)
+						result = 1
+						break
+		finally :
+			# Written even if execution failed, since that is when a trace
+			# is most useful. We report failures to write it separately, so
+			# that they don't mask any exception from the execution itself.
+			if traceMonitor is not None :
 				try :
-					node["task"].executeSequence( frames )
+					traceMonitor.writeTrace( args["traceFile"].value )
 				except Exception as exception :
-					IECore.msg(
-						IECore.Msg.Level.Debug,
-						"gaffer execute : executing %s" % node.relativeName( scriptNode ),
-						traceback.format_exc().strip(),
-					)
-					IECore.msg(
-						IECore.Msg.Level.Error,
-						"gaffer execute : executing %s" % node.relativeName( scriptNode ),
-						"See previous message for details",
-					)
-					return 1
+					IECore.msg( IECore.Msg.Level.Error, "gaffer execute : writing trace", str( exception ) )
+					result = 1
 
-		return 0
+		return result
 
 	def __error( self, plug, source, message ) :
 
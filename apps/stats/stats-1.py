@@ -228,6 +228,18 @@ class stats( Gaffer.Application ) :
 					extensions = "gfr",
 				),
 
+				IECore.FileNameParameter(
+					name = "traceFile",
+					description = "Records the start and finish of every process, and "
+						"writes them to the specified file as a timeline that can be viewed "
+						"in https://ui.perfetto.dev or `chrome://tracing`. Use a \".json\" "
+						"extension for the Chrome trace format and \".pftrace\" for the Perfetto "
+						"protobuf format.",
+					defaultValue = "",
+					allowEmptyString = True,
+					extensions = "json pftrace",
+				),
+
 				IECore.BoolParameter(
 					name = "vtune",
 					description = "Enables VTune instrumentation. When enabled, the VTune "
@@ -261,7 +273,7 @@ class stats( Gaffer.Application ) :
 
 				IECore.IntParameter(
 					name = "hashCacheSizeLimit",
-					description = "The size limit for the per-thread hash cache. If this is not "
+					description = "The maximum number of entries in the hash cache. If this is not "
 						"specified, the default limit will be used, or a limit specified by an "
 						"application startup file.",
 					defaultValue = 0,
@@ -333,6 +345,8 @@ class stats( Gaffer.Application ) :
 		else :
 			self.__vtuneMonitor = None
 
+		self.__traceMonitor = Gaffer.TraceMonitor() if args["traceFile"].value else None
+
 		self.__output = open( args["outputFile"].value, "w" ) if args["outputFile"].value else sys.stdout
 
 		self.__writeVersion( script )
@@ -370,6 +384,9 @@ class stats( Gaffer.Application ) :
 
 			self.__writeTask( script, args )
 
+		if self.__traceMonitor is not None :
+			self.__traceMonitor.writeTrace( args["traceFile"].value )
+
 		self.__output.write( "\n" )
 
 		self.__writeMemory()
@@ -507,7 +524,7 @@ class stats( Gaffer.Application ) :
 		memory = _Memory.maxRSS()
 		# We don't expect serialisation to trigger any processes that the monitors would see,
 		# but we definitely want to know if they do.
-		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
+		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext(), self.__traceMonitor or contextlib.nullcontext() :
 			with _Timer() as timer :
 				script.serialise()
 
@@ -563,7 +580,7 @@ class stats( Gaffer.Application ) :
 			computeScene()
 
 		memory = _Memory.maxRSS()
-		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
+		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext(), self.__traceMonitor or contextlib.nullcontext() :
 			with contextSanitiser :
 				with _Timer() as sceneTimer :
 					computeScene()
@@ -605,7 +622,7 @@ class stats( Gaffer.Application ) :
 			computeImage()
 
 		memory = _Memory.maxRSS()
-		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
+		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext(), self.__traceMonitor or contextlib.nullcontext() :
 			with contextSanitiser :
 				with _Timer() as imageTimer :
 					computeImage()
@@ -641,7 +658,7 @@ class stats( Gaffer.Application ) :
 
 		memory = _Memory.maxRSS()
 		with _Timer() as taskTimer :
-			with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
+			with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext(), self.__traceMonitor or contextlib.nullcontext() :
 				with self.__context( script, args ) as context :
 					for frame in self.__frames( script, args ) :
 						context.setFrame( frame )
@@ -665,6 +682,20 @@ class stats( Gaffer.Application ) :
 			( "Object pool usage", _Memory( objectPool.memoryUsage() ) ),
 		] )
 
+		for partition in Gaffer.ValuePlug.cachePartitions() :
+			items.extend( [
+				( "", "" ),
+				( "Cache limit ({})".format( partition ), _Memory( Gaffer.ValuePlug.getCachePartitionMemoryLimit( partition ) ) ),
+				( "Cache usage ({})".format( partition ), _Memory( Gaffer.ValuePlug.cachePartitionMemoryUsage( partition ) ) ),
+			] )
+
+		if Gaffer.ValuePlug.getDiskCacheDirectory() :
+			items.extend( [
+				( "", "" ),
+				( "Disk cache limit", _Memory( Gaffer.ValuePlug.getDiskCacheSizeLimit() ) ),
+				( "Disk cache usage", _Memory( Gaffer.ValuePlug.diskCacheUsage() ) ),
+			] )
+
 		import IECoreScene
 		if "IECoreScene" in sys.modules :
 			items.extend( [
@@ -700,6 +731,16 @@ class stats( Gaffer.Application ) :
 					)
 				)
 
+				if Gaffer.ValuePlug.getDiskCacheDirectory() :
+					combinedStatistics = self.__performanceMonitor.combinedStatistics()
+					self.__output.write( "\nDisk cache :\n\n" )
+					self.__writeItems( [
+						( "Hits", combinedStatistics.diskCacheHits ),
+						( "Misses", combinedStatistics.diskCacheMisses ),
+						( "Read", _Memory( combinedStatistics.diskCacheBytesRead ) ),
+						( "Written", _Memory( combinedStatistics.diskCacheBytesWritten ) ),
+					] )
+
 	def __writeContext( self, script, args ) :
 
 			if self.__contextMonitor is None :
@@ -39,6 +39,7 @@
 
 #include "Gaffer/DependencyNode.h"
 
+#include "IECore/InternedString.h"
 #include "IECore/MurmurHash.h"
 
 namespace Gaffer
@@ -83,6 +84,13 @@ class GAFFER_API ComputeNode : public DependencyNode
 		/// Called to determine how calls to `compute()` should be cached. If `compute( output )`
 		/// will spawn TBB tasks then one of the task-based policies _must_ be used.
 		virtual ValuePlug::CachePolicy computeCachePolicy( const ValuePlug *output ) const;
+		/// Called to determine which partition of the compute cache the results of
+		/// `compute( output )` are stored in. Partitions allow independent memory
+		/// limits to be set for different subsystems, so that one can not evict
+		/// the results of another - see `ValuePlug::setCachePartitionMemoryLimit()`.
+		/// The default implementation returns an empty string, meaning the default
+		/// partition.
+		virtual IECore::InternedString computeCachePartition( const ValuePlug *output ) const;
 
 	private :
 
@@ -47,6 +47,7 @@
 #include "IECore/StringAlgo.h"
 
 #include "boost/container/flat_map.hpp"
+#include "boost/container/small_vector.hpp"
 
 namespace Gaffer
 {
@@ -164,6 +165,9 @@ class GAFFER_API Context : public IECore::RefCounted
 		/// A signal emitted when an element of the context is changed.
 		ChangedSignal &changedSignal();
 
+		/// Returns a hash of all variables except those prefixed with "ui:".
+		/// The hash is maintained incrementally as variables are set and
+		/// removed, so this is a constant time operation.
 		IECore::MurmurHash hash() const;
 
 		/// Return the hash of a particular variable ( or a default MurmurHash() if not present )
@@ -366,13 +370,20 @@ class GAFFER_API Context : public IECore::RefCounted
 		const Value &internalGet( const IECore::InternedString &name ) const;
 		// Returns nullptr if variable doesn't exist.
 		const Value *internalGetIfExists( const IECore::InternedString &name ) const;
+		// Updates `m_hash` to account for a variable changing from
+		// `previousHash` to `newHash`. Because the context hash is just the
+		// sum of the variable hashes, this can be done in constant time.
+		void updateHash( const IECore::MurmurHash &previousHash, const IECore::MurmurHash &newHash );
 
-		using Map = boost::container::flat_map<IECore::InternedString, Value>;
+		// Variables are stored inline for the common case of a modest number
+		// of variables, so that copying a context (as EditableScope does for
+		// every compute) doesn't require an additional allocation.
+		static constexpr size_t g_inlineVariables = 12;
+		using Map = boost::container::small_flat_map<IECore::InternedString, Value, g_inlineVariables>;
 
 		Map m_map;
 		ChangedSignal *m_changedSignal;
-		mutable IECore::MurmurHash m_hash;
-		mutable bool m_hashValid;
+		IECore::MurmurHash m_hash;
 		const IECore::Canceller *m_canceller;
 
 		// The alloc map holds a smart pointer to data that we allocate.  It must keep the entries
@@ -180,19 +180,22 @@ void Context::set( const IECore::InternedString &name, const T &value )
 
 inline void Context::internalSet( const IECore::InternedString &name, const Value &value )
 {
+	// Note that newly inserted values have a default hash of `( 0, 0 )`,
+	// so contribute nothing to `m_hash` until they are assigned.
+	Value &v = m_map[name];
+	updateHash( v.hash(), value.hash() );
+
 	if( !m_changedSignal )
 	{
 		// Fast path, typically in an EditableScope, where we
 		// expect the value to have changed and don't want the
 		// expense of checking.
-		m_map[name] = value;
-		m_hashValid = false;
+		v = value;
 	}
 	else
 	{
 		// Always assign to the value, because the caller might have updated
 		// `m_allocMap` already (removing the previous value).
-		Value &v = m_map[name];
 		const bool changed = v != value;
 		v = value;
 		if( changed )
@@ -200,7 +203,6 @@ inline void Context::internalSet( const IECore::InternedString &name, const Valu
 			// But avoid emitting `changedSignal` if the value hasn't
 			// actually changed. We want to avoid expensive re-evaluations
 			// that might otherwise be triggered in the UI.
-			m_hashValid = false;
 			(*m_changedSignal)( this, name );
 		}
 	}
@@ -218,6 +220,19 @@ inline void Context::internalSetWithOwner( const IECore::InternedString &name, c
 	internalSet( name, value );
 }
 
+inline void Context::updateHash( const IECore::MurmurHash &previousHash, const IECore::MurmurHash &newHash )
+{
+	m_hash = IECore::MurmurHash(
+		m_hash.h1() - previousHash.h1() + newHash.h1(),
+		m_hash.h2() - previousHash.h2() + newHash.h2()
+	);
+}
+
+inline IECore::MurmurHash Context::hash() const
+{
+	return m_hash;
+}
+
 inline const Context::Value &Context::internalGet( const IECore::InternedString &name ) const
 {
 	const Value *result = internalGetIfExists( name );
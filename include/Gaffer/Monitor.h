@@ -84,6 +84,17 @@ class GAFFER_API Monitor : public IECore::RefCounted
 		/// on this thread.
 		static const MonitorSet &current();
 
+		/// Events which may be reported to `cacheEvent()`.
+		enum class CacheEvent
+		{
+			/// A value was loaded from the disk cache.
+			DiskCacheHit,
+			/// A value was sought but not found in the disk cache.
+			DiskCacheMiss,
+			/// A value was written to the disk cache.
+			DiskCacheWrite
+		};
+
 	protected :
 
 		Monitor();
@@ -94,6 +105,10 @@ class GAFFER_API Monitor : public IECore::RefCounted
 		virtual void processStarted( const Process *process ) = 0;
 		/// Implementations must be safe to call concurrently.
 		virtual void processFinished( const Process *process ) = 0;
+		/// Called when `process` accesses a secondary cache, with `bytes` being
+		/// the number of bytes read or written. The default implementation does
+		/// nothing. Implementations must be safe to call concurrently.
+		virtual void cacheEvent( const Process *process, CacheEvent event, size_t bytes );
 
 		/// Must return true if forceMonitoring will ever return true from this Monitor
 		/// \todo : In order to efficently support a monitor that only forces monitoring during
@@ -71,13 +71,22 @@ class GAFFER_API PerformanceMonitor : public Monitor
 				size_t hashCount = 0,
 				size_t computeCount = 0,
 				boost::chrono::nanoseconds hashDuration = boost::chrono::nanoseconds( 0 ),
-				boost::chrono::nanoseconds computeDuration = boost::chrono::nanoseconds( 0 )
+				boost::chrono::nanoseconds computeDuration = boost::chrono::nanoseconds( 0 ),
+				size_t diskCacheHits = 0,
+				size_t diskCacheMisses = 0,
+				size_t diskCacheBytesRead = 0,
+				size_t diskCacheBytesWritten = 0
 			);
 
 			size_t hashCount;
 			size_t computeCount;
 			boost::chrono::nanoseconds hashDuration;
 			boost::chrono::nanoseconds computeDuration;
+			/// Accesses to the disk cache. See `ValuePlug::setDiskCacheDirectory()`.
+			size_t diskCacheHits;
+			size_t diskCacheMisses;
+			size_t diskCacheBytesRead;
+			size_t diskCacheBytesWritten;
 
 			Statistics & operator += ( const Statistics &rhs );
 
@@ -97,6 +106,7 @@ class GAFFER_API PerformanceMonitor : public Monitor
 
 		void processStarted( const Process *process ) override;
 		void processFinished( const Process *process ) override;
+		void cacheEvent( const Process *process, CacheEvent event, size_t bytes ) override;
 
 	private :
 
@@ -0,0 +1,203 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "boost/functional/hash.hpp"
+#include "boost/noncopyable.hpp"
+
+#include "tbb/cache_aligned_allocator.h"
+#include "tbb/enumerable_thread_specific.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace Gaffer
+{
+
+namespace Private
+{
+
+/// A thread-safe cache for small keys and values that are looked up far
+/// more often than they are stored, such as the hashes cached by ValuePlug.
+///
+/// Storage is divided into shards, each of which is an open-addressed table
+/// of small set-associative buckets, allocated on first use. Each slot is guarded by a sequence lock,
+/// so that lookups and insertions are lock-free : readers never block, and
+/// a writer that finds a slot busy simply abandons its insertion. Eviction
+/// gives each entry a "second chance" if it has been used since it was last
+/// considered for eviction. `clear()` takes constant time, invalidating all
+/// entries by advancing a generation counter, and the tables replaced by
+/// `setMaxCost()` are freed using epoch-based reclamation once no thread can
+/// still be reading from them.
+///
+/// Requirements :
+///
+/// - `Key` and `Value` may be copied bitwise (although they needn't be
+///   trivially copyable), and have sizes that are a
+///   multiple of 8 bytes.
+/// - `Key` equality is bitwise equality, so `Key` must not contain padding.
+/// - `Hash` is a hash function for `Key`.
+template<typename Key, typename Value, typename Hash = boost::hash<Key>>
+class ConcurrentCache : public boost::noncopyable
+{
+
+	public :
+
+		using KeyType = Key;
+		using ValueType = Value;
+
+		/// Every entry has a cost of 1, so `maxCost` is the maximum number
+		/// of entries.
+		explicit ConcurrentCache( size_t maxCost );
+		~ConcurrentCache();
+
+		/// Returns the value for `key` if it is in the cache.
+		std::optional<Value> getIfCached( const Key &key );
+		/// Stores `value` for `key`, unless it is already cached. Returns
+		/// true if the value was stored. The value may not be stored if
+		/// another thread is storing a value in the same slot concurrently.
+		bool setIfUncached( const Key &key, const Value &value );
+		/// Overload for compatibility with `LRUCache::setIfUncached()`,
+		/// as required by `Process::acquireCollaborativeResult()`. The
+		/// cost function and compute duration are ignored.
+		template<typename CostFunction>
+		bool setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction, std::chrono::nanoseconds computeDuration = std::chrono::nanoseconds( 0 ) );
+
+		/// Removes all entries. This is thread-safe, and may be called
+		/// concurrently with lookups and insertions.
+		void clear();
+
+		/// Changing the maximum cost reallocates the cache, discarding
+		/// all existing entries. The actual capacity is rounded up to
+		/// the next power of two.
+		void setMaxCost( size_t maxCost );
+		size_t getMaxCost() const;
+
+		/// Returns the number of entries in the cache. This requires a scan
+		/// of the whole cache, so is intended only for diagnostics.
+		size_t currentCost() const;
+
+	private :
+
+		static constexpr size_t numKeyWords = sizeof( Key ) / sizeof( uint64_t );
+		static constexpr size_t numValueWords = sizeof( Value ) / sizeof( uint64_t );
+		static_assert( numKeyWords * sizeof( uint64_t ) == sizeof( Key ), "Key size must be a multiple of 8 bytes" );
+		static_assert( numValueWords * sizeof( uint64_t ) == sizeof( Value ), "Value size must be a multiple of 8 bytes" );
+
+		// Slots are written by bumping `version` to an odd number, storing
+		// the words, and bumping `version` to the next even number. Readers
+		// load the words optimistically and discard them if `version` changed
+		// in the meantime. The first word stores the generation the entry
+		// was written in, with zero indicating an empty slot.
+		struct alignas( 64 ) Slot
+		{
+			std::atomic<uint32_t> version = 0;
+			std::atomic<uint32_t> referenced = 0;
+			std::array<std::atomic<uint64_t>, 1 + numKeyWords + numValueWords> words;
+		};
+
+		struct Table
+		{
+			Table( size_t numBuckets );
+			Slot *bucket( size_t hash ) const;
+			const size_t numBuckets;
+			std::unique_ptr<Slot[]> slots;
+		};
+
+		struct alignas( 64 ) Shard
+		{
+			std::atomic<Table *> table = nullptr;
+		};
+
+		// Epoch-based reclamation. Each thread publishes the epoch it observed
+		// when it started reading from the tables, and zero when it is not
+		// reading. A table retired in epoch `e` may be freed once no thread
+		// has published an epoch less than `e`.
+		struct Participant
+		{
+			std::atomic<uint64_t> epoch = 0;
+		};
+
+		class ReadScope : boost::noncopyable
+		{
+			public :
+				ReadScope( const ConcurrentCache &cache );
+				~ReadScope();
+			private :
+				Participant &m_participant;
+				const bool m_nested;
+		};
+
+		using KeyWords = std::array<uint64_t, numKeyWords>;
+
+		static size_t hash( const Key &key );
+		static KeyWords keyWords( const Key &key );
+		// Returns the slot holding `key` if there is one, and fills `value`
+		// from it if `value` is non-null.
+		Slot *find( Slot *bucket, const KeyWords &keyWords, uint64_t generation, Value *value ) const;
+		void allocateTable( Shard &shard );
+		// Frees retired tables that are no longer in use, returning true
+		// if none remain.
+		bool reclaim();
+
+		static constexpr size_t g_bucketSize = 4;
+		static constexpr size_t g_numShardsLog2 = 6;
+		static constexpr size_t g_numShards = 1 << g_numShardsLog2;
+
+		std::array<Shard, g_numShards> m_shards;
+		std::atomic<uint64_t> m_generation;
+
+		mutable tbb::enumerable_thread_specific<Participant, tbb::cache_aligned_allocator<Participant>, tbb::ets_key_per_instance> m_participants;
+		std::atomic<uint64_t> m_epoch;
+		std::atomic_size_t m_maxCost;
+		// Protects the members below, and the allocation of tables.
+		std::mutex m_mutex;
+		size_t m_numBuckets;
+		std::vector<std::pair<uint64_t, std::unique_ptr<Table>>> m_retiredTables;
+
+};
+
+} // namespace Private
+
+} // namespace Gaffer
+
+#include "Gaffer/Private/ConcurrentCache.inl"
@@ -0,0 +1,449 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <thread>
+
+namespace Gaffer
+{
+
+namespace Private
+{
+
+//////////////////////////////////////////////////////////////////////////
+// Table
+//////////////////////////////////////////////////////////////////////////
+
+template<typename Key, typename Value, typename Hash>
+ConcurrentCache<Key, Value, Hash>::Table::Table( size_t numBuckets )
+	// Value-initialisation zeroes all slots, marking them as empty.
+	:	numBuckets( numBuckets ), slots( new Slot[numBuckets * g_bucketSize]() )
+{
+	assert( numBuckets && !( numBuckets & ( numBuckets - 1 ) ) );
+}
+
+template<typename Key, typename Value, typename Hash>
+typename ConcurrentCache<Key, Value, Hash>::Slot *ConcurrentCache<Key, Value, Hash>::Table::bucket( size_t hash ) const
+{
+	return slots.get() + ( hash & ( numBuckets - 1 ) ) * g_bucketSize;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// ReadScope
+//////////////////////////////////////////////////////////////////////////
+
+template<typename Key, typename Value, typename Hash>
+ConcurrentCache<Key, Value, Hash>::ReadScope::ReadScope( const ConcurrentCache &cache )
+	:	m_participant( cache.m_participants.local() ), m_nested( m_participant.epoch.load( std::memory_order_relaxed ) )
+{
+	if( !m_nested )
+	{
+		// Sequential consistency ensures that `setMaxCost()` either sees
+		// our epoch, or we see the tables it has installed. This requires
+		// the subsequent loads of `Shard::table` to be `seq_cst` too, so
+		// that they can't be reordered before this store.
+		m_participant.epoch.store( cache.m_epoch.load(), std::memory_order_seq_cst );
+	}
+}
+
+template<typename Key, typename Value, typename Hash>
+ConcurrentCache<Key, Value, Hash>::ReadScope::~ReadScope()
+{
+	if( !m_nested )
+	{
+		m_participant.epoch.store( 0, std::memory_order_release );
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+// ConcurrentCache
+//////////////////////////////////////////////////////////////////////////
+
+template<typename Key, typename Value, typename Hash>
+ConcurrentCache<Key, Value, Hash>::ConcurrentCache( size_t maxCost )
+	:	m_generation( 1 ), m_epoch( 1 ), m_maxCost( 0 ), m_numBuckets( 0 )
+{
+	setMaxCost( maxCost );
+}
+
+template<typename Key, typename Value, typename Hash>
+ConcurrentCache<Key, Value, Hash>::~ConcurrentCache()
+{
+	// No threads can be reading from us now, so everything
+	// can be freed immediately.
+	for( auto &shard : m_shards )
+	{
+		delete shard.table.load();
+	}
+}
+
+template<typename Key, typename Value, typename Hash>
+std::optional<Value> ConcurrentCache<Key, Value, Hash>::getIfCached( const Key &key )
+{
+	const size_t h = hash( key );
+	ReadScope readScope( *this );
+	const Table *table = m_shards[h >> ( std::numeric_limits<size_t>::digits - g_numShardsLog2 )].table.load( std::memory_order_seq_cst );
+	if( !table )
+	{
+		return std::nullopt;
+	}
+
+	Value value;
+	if( Slot *slot = find( table->bucket( h ), keyWords( key ), m_generation.load( std::memory_order_relaxed ), &value ) )
+	{
+		// Avoid writing to the cache line unless necessary.
+		if( !slot->referenced.load( std::memory_order_relaxed ) )
+		{
+			slot->referenced.store( 1, std::memory_order_relaxed );
+		}
+		return value;
+	}
+
+	return std::nullopt;
+}
+
+template<typename Key, typename Value, typename Hash>
+bool ConcurrentCache<Key, Value, Hash>::setIfUncached( const Key &key, const Value &value )
+{
+	const size_t h = hash( key );
+	Shard &shard = m_shards[h >> ( std::numeric_limits<size_t>::digits - g_numShardsLog2 )];
+	if( !shard.table.load( std::memory_order_acquire ) )
+	{
+		// Must be done outside the ReadScope, because `setMaxCost()`
+		// waits for readers while holding `m_mutex`.
+		allocateTable( shard );
+	}
+
+	ReadScope readScope( *this );
+	const Table *table = shard.table.load( std::memory_order_seq_cst );
+	if( !table )
+	{
+		return false;
+	}
+
+	Slot *bucket = table->bucket( h );
+	const KeyWords kw = keyWords( key );
+	const uint64_t generation = m_generation.load( std::memory_order_relaxed );
+	if( find( bucket, kw, generation, nullptr ) )
+	{
+		return false;
+	}
+
+	// Choose a slot to store the value in. Empty slots and slots from
+	// a previous generation are used first. Otherwise we evict the first
+	// slot that hasn't been referenced since we last passed it over,
+	// clearing the `referenced` flag on the slots we pass.
+
+	Slot *victim = nullptr;
+	for( size_t i = 0; i < g_bucketSize; ++i )
+	{
+		if( bucket[i].words[0].load( std::memory_order_relaxed ) != generation )
+		{
+			victim = bucket + i;
+			break;
+		}
+	}
+
+	if( !victim )
+	{
+		for( size_t i = 0; i < g_bucketSize; ++i )
+		{
+			if( !bucket[i].referenced.load( std::memory_order_relaxed ) )
+			{
+				victim = bucket + i;
+				break;
+			}
+			bucket[i].referenced.store( 0, std::memory_order_relaxed );
+		}
+		if( !victim )
+		{
+			// Everything was referenced. Use the upper bits of the hash
+			// to choose a victim, so that we don't always evict the same
+			// slot.
+			victim = bucket + ( ( h >> 32 ) & ( g_bucketSize - 1 ) );
+		}
+	}
+
+	uint32_t version = victim->version.load( std::memory_order_relaxed );
+	if( ( version & 1 ) || !victim->version.compare_exchange_strong( version, version + 1, std::memory_order_acquire ) )
+	{
+		// Another thread is writing to the slot. Rather than wait for it,
+		// we just abandon our insertion.
+		return false;
+	}
+
+	std::atomic_thread_fence( std::memory_order_release );
+
+	uint64_t valueWords[numValueWords];
+	std::memcpy( valueWords, static_cast<const void *>( &value ), sizeof( Value ) );
+
+	victim->words[0].store( generation, std::memory_order_relaxed );
+	for( size_t i = 0; i < numKeyWords; ++i )
+	{
+		victim->words[1 + i].store( kw[i], std::memory_order_relaxed );
+	}
+	for( size_t i = 0; i < numValueWords; ++i )
+	{
+		victim->words[1 + numKeyWords + i].store( valueWords[i], std::memory_order_relaxed );
+	}
+	victim->referenced.store( 0, std::memory_order_relaxed );
+
+	victim->version.store( version + 2, std::memory_order_release );
+	return true;
+}
+
+template<typename Key, typename Value, typename Hash>
+template<typename CostFunction>
+bool ConcurrentCache<Key, Value, Hash>::setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction, std::chrono::nanoseconds computeDuration )
+{
+	return setIfUncached( key, value );
+}
+
+template<typename Key, typename Value, typename Hash>
+void ConcurrentCache<Key, Value, Hash>::clear()
+{
+	m_generation.fetch_add( 1 );
+}
+
+template<typename Key, typename Value, typename Hash>
+void ConcurrentCache<Key, Value, Hash>::setMaxCost( size_t maxCost )
+{
+	std::lock_guard<std::mutex> lock( m_mutex );
+	if( maxCost == m_maxCost )
+	{
+		return;
+	}
+
+	size_t numBuckets = 0;
+	if( maxCost )
+	{
+		const size_t minBuckets = ( maxCost + g_numShards * g_bucketSize - 1 ) / ( g_numShards * g_bucketSize );
+		numBuckets = 1;
+		while( numBuckets < minBuckets )
+		{
+			numBuckets *= 2;
+		}
+	}
+	m_numBuckets = numBuckets;
+
+	// New tables are allocated lazily by `setIfUncached()`.
+	for( auto &shard : m_shards )
+	{
+		Table *oldTable = shard.table.exchange( nullptr );
+		if( oldTable )
+		{
+			m_retiredTables.emplace_back( 0, oldTable );
+		}
+	}
+
+	// Readers that published an epoch before this increment may still be
+	// using the old tables. Readers that start afterwards can only see
+	// the new ones.
+	const uint64_t retiredEpoch = m_epoch.fetch_add( 1 ) + 1;
+	for( auto &t : m_retiredTables )
+	{
+		if( !t.first )
+		{
+			t.first = retiredEpoch;
+		}
+	}
+
+	m_maxCost = maxCost;
+
+	// Readers only hold on to a table for the duration of a single
+	// lookup or insertion, so we won't be waiting long.
+	while( !reclaim() )
+	{
+		std::this_thread::yield();
+	}
+}
+
+template<typename Key, typename Value, typename Hash>
+size_t ConcurrentCache<Key, Value, Hash>::getMaxCost() const
+{
+	return m_maxCost;
+}
+
+template<typename Key, typename Value, typename Hash>
+size_t ConcurrentCache<Key, Value, Hash>::currentCost() const
+{
+	ReadScope readScope( *this );
+	const uint64_t generation = m_generation.load( std::memory_order_relaxed );
+
+	size_t result = 0;
+	for( const auto &shard : m_shards )
+	{
+		const Table *table = shard.table.load( std::memory_order_seq_cst );
+		if( !table )
+		{
+			continue;
+		}
+		for( size_t i = 0, e = table->numBuckets * g_bucketSize; i < e; ++i )
+		{
+			if( table->slots[i].words[0].load( std::memory_order_relaxed ) == generation )
+			{
+				result++;
+			}
+		}
+	}
+
+	return result;
+}
+
+template<typename Key, typename Value, typename Hash>
+size_t ConcurrentCache<Key, Value, Hash>::hash( const Key &key )
+{
+	// The final mix from MurmurHash3, so that keys with poorly distributed
+	// hashes are spread well across both shards and buckets.
+	uint64_t h = Hash()( key );
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdULL;
+	h ^= h >> 33;
+	h *= 0xc4ceb9fe1a85ec53ULL;
+	h ^= h >> 33;
+	return h;
+}
+
+template<typename Key, typename Value, typename Hash>
+typename ConcurrentCache<Key, Value, Hash>::KeyWords ConcurrentCache<Key, Value, Hash>::keyWords( const Key &key )
+{
+	KeyWords result;
+	std::memcpy( result.data(), static_cast<const void *>( &key ), sizeof( Key ) );
+	return result;
+}
+
+template<typename Key, typename Value, typename Hash>
+typename ConcurrentCache<Key, Value, Hash>::Slot *ConcurrentCache<Key, Value, Hash>::find( Slot *bucket, const KeyWords &keyWords, uint64_t generation, Value *value ) const
+{
+	for( size_t i = 0; i < g_bucketSize; ++i )
+	{
+		Slot &slot = bucket[i];
+		const uint32_t version = slot.version.load( std::memory_order_acquire );
+		if( version & 1 )
+		{
+			// Being written.
+			continue;
+		}
+
+		if( slot.words[0].load( std::memory_order_relaxed ) != generation )
+		{
+			continue;
+		}
+
+		bool match = true;
+		for( size_t k = 0; k < numKeyWords; ++k )
+		{
+			if( slot.words[1 + k].load( std::memory_order_relaxed ) != keyWords[k] )
+			{
+				match = false;
+				break;
+			}
+		}
+		if( !match )
+		{
+			continue;
+		}
+
+		uint64_t valueWords[numValueWords];
+		if( value )
+		{
+			for( size_t v = 0; v < numValueWords; ++v )
+			{
+				valueWords[v] = slot.words[1 + numKeyWords + v].load( std::memory_order_relaxed );
+			}
+		}
+
+		std::atomic_thread_fence( std::memory_order_acquire );
+		if( slot.version.load( std::memory_order_relaxed ) != version )
+		{
+			// Overwritten while we were reading. The slot is unlikely
+			// to contain our key any more.
+			continue;
+		}
+
+		if( value )
+		{
+			std::memcpy( static_cast<void *>( value ), valueWords, sizeof( Value ) );
+		}
+		return &slot;
+	}
+
+	return nullptr;
+}
+
+template<typename Key, typename Value, typename Hash>
+void ConcurrentCache<Key, Value, Hash>::allocateTable( Shard &shard )
+{
+	std::lock_guard<std::mutex> lock( m_mutex );
+	if( !shard.table.load( std::memory_order_relaxed ) && m_numBuckets )
+	{
+		shard.table.store( new Table( m_numBuckets ), std::memory_order_release );
+	}
+}
+
+template<typename Key, typename Value, typename Hash>
+bool ConcurrentCache<Key, Value, Hash>::reclaim()
+{
+	// Called with `m_mutex` locked.
+
+	uint64_t minEpoch = std::numeric_limits<uint64_t>::max();
+	for( const auto &participant : m_participants )
+	{
+		if( const uint64_t epoch = participant.epoch.load( std::memory_order_seq_cst ) )
+		{
+			minEpoch = std::min( minEpoch, epoch );
+		}
+	}
+
+	m_retiredTables.erase(
+		std::remove_if(
+			m_retiredTables.begin(), m_retiredTables.end(),
+			[minEpoch] ( const std::pair<uint64_t, std::unique_ptr<Table>> &t ) { return t.first <= minEpoch; }
+		),
+		m_retiredTables.end()
+	);
+
+	return m_retiredTables.empty();
+}
+
+} // namespace Private
+
+} // namespace Gaffer
@@ -0,0 +1,112 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "Gaffer/Export.h"
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
+
+#include "IECore/MurmurHash.h"
+#include "IECore/Object.h"
+
+#include "boost/noncopyable.hpp"
+
+#include <filesystem>
+
+namespace Gaffer
+{
+
+namespace Private
+{
+
+/// A persistent cache mapping from hashes to objects, stored as one file per
+/// entry within a directory. Entries are written to a temporary file and then
+/// renamed into place, so a directory may be shared safely by any number of
+/// processes on the same host. Each process tracks the entries it knows about
+/// and evicts the least recently used of them to keep the total size within
+/// a limit.
+class GAFFER_API DiskCache : public boost::noncopyable
+{
+
+	public :
+
+		/// Creates the cache, adopting any existing entries in `directory`
+		/// into the index so that they count towards `maxCost` and can be
+		/// found by `get()`. The directory is created if
+		/// it doesn't exist already.
+		DiskCache( const std::filesystem::path &directory, size_t maxCost );
+		~DiskCache();
+
+		const std::filesystem::path &directory() const;
+
+		/// Returns the object stored for `key`, or null if there is none.
+		/// `bytesRead` is set to the size of the entry that was read. Entries
+		/// are first looked up in the in-memory index, so that misses are
+		/// cheap. Entries written by other processes since the cache was
+		/// constructed are not in the index, so are only found if
+		/// `searchUnindexed` is true, at the expense of a filesystem access.
+		IECore::ConstObjectPtr get( const IECore::MurmurHash &key, size_t &bytesRead, bool searchUnindexed = false );
+		/// Stores `object` for `key` and returns the number of bytes
+		/// written. Returns 0 if the entry exists already or the object
+		/// can not be serialised.
+		size_t set( const IECore::MurmurHash &key, const IECore::Object *object );
+
+		/// Sets the maximum total size of the entries, in bytes.
+		void setMaxCost( size_t maxCost );
+		size_t getMaxCost() const;
+		/// Returns the total size of the entries known to this process.
+		size_t currentCost() const;
+
+		/// Removes all entries known to this process.
+		void clear();
+
+	private :
+
+		std::filesystem::path entryPath( const IECore::MurmurHash &key ) const;
+
+		// Maps from key to file size. We use the LRUCache purely as an index
+		// for the files on disk, with the removal callback deleting them.
+		using Index = IECorePreview::LRUCache<IECore::MurmurHash, size_t, IECorePreview::LRUCachePolicy::Parallel>;
+
+		const std::filesystem::path m_directory;
+		Index m_index;
+
+};
+
+} // namespace Private
+
+} // namespace Gaffer
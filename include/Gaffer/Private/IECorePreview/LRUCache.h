@@ -40,6 +40,8 @@
 #include "boost/noncopyable.hpp"
 #include "boost/variant.hpp"
 
+#include <atomic>
+#include <chrono>
 #include <optional>
 
 namespace IECorePreview
@@ -75,6 +77,22 @@ class TaskParallel;
 
 } // namespace LRUCachePolicy
 
+/// Determines which items are discarded when the total cost of
+/// an LRUCache exceeds its maximum cost.
+enum class LRUCacheEvictionPolicy
+{
+	/// Items which have not been accessed recently are
+	/// discarded first.
+	LRU,
+	/// An approximation of the GreedyDual-Size algorithm. Items which
+	/// are quick to recompute relative to their cost are discarded
+	/// before items which are slow to recompute, while still taking
+	/// account of recency of access. Recompute time is measured for
+	/// values computed by the GetterFunction, and may be passed
+	/// explicitly to `set()` and `setIfUncached()`.
+	CostAware
+};
+
 /// A mapping from keys to values, where values are computed from keys using a user
 /// supplied function. Recently computed values are stored in the cache to accelerate
 /// subsequent lookups. Each value has a cost associated with it, and the cache has
@@ -86,7 +104,8 @@ class TaskParallel;
 ///
 /// The Policy determines the thread safety, eviction and performance characteristics
 /// of the cache. See the documentation for each individual policy in the LRUCachePolicy
-/// namespace.
+/// namespace. The LRUCacheEvictionPolicy may additionally be used to account for the
+/// time taken to recompute values when choosing which to evict.
 ///
 /// The GetterKey may be used where the GetterFunction requires some auxiliary information
 /// in addition to the Key. It must be implicitly castable to Key, and all GetterKeys
@@ -100,6 +119,7 @@ class LRUCache : private boost::noncopyable
 
 		using Cost = size_t;
 		using KeyType = Key;
+		using EvictionPolicy = LRUCacheEvictionPolicy;
 
 		/// The GetterFunction is responsible for computing the value and cost for a cache entry
 		/// when given the key. It should throw a descriptive exception if it can't get the data for
@@ -129,15 +149,17 @@ class LRUCache : private boost::noncopyable
 		/// Returns true for success and false on failure - failure can occur
 		/// if the cost exceeds the maximum cost for the cache. Note that even
 		/// when true is returned, the item may be removed from the cache by a
-		/// subsequent (or concurrent) operation.
-		bool set( const Key &key, const Value &value, Cost cost );
+		/// subsequent (or concurrent) operation. The `computeDuration` is the
+		/// time taken to compute the value, and is only used by the `CostAware`
+		/// eviction policy.
+		bool set( const Key &key, const Value &value, Cost cost, std::chrono::nanoseconds computeDuration = std::chrono::nanoseconds( 0 ) );
 		/// As above, but only if the item is not cached already. This avoids
 		/// calling a potentially expensive cost function in the case that the
 		/// item is cached already.
 		/// \todo Ideally we wouldn't need the cost calculation to be duplicated
 		/// between CostFunction and GetterFunction.
 		template<typename CostFunction>
-		bool setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction );
+		bool setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction, std::chrono::nanoseconds computeDuration = std::chrono::nanoseconds( 0 ) );
 
 		/// Returns true if the object is in the cache. Note that the
 		/// return value may be invalidated immediately by operations performed
@@ -163,6 +185,12 @@ class LRUCache : private boost::noncopyable
 		/// Returns the current cost of all cached items.
 		Cost currentCost() const;
 
+		/// Sets the policy used to choose items for removal. This applies to
+		/// items added subsequently; existing items retain the priority they
+		/// were given when added. Defaults to `LRU`.
+		void setEvictionPolicy( EvictionPolicy evictionPolicy );
+		EvictionPolicy getEvictionPolicy() const;
+
 	private :
 
 		// Data
@@ -198,6 +226,11 @@ class LRUCache : private boost::noncopyable
 
 			State state;
 			Cost cost; // the cost for this item
+			// The number of times the item may be passed over
+			// for eviction, in addition to the chance it gets
+			// from being used recently. Always 0 for the `LRU`
+			// eviction policy.
+			unsigned char priority;
 
 			Status status() const;
 
@@ -209,13 +242,21 @@ class LRUCache : private boost::noncopyable
 
 		Cost m_maxCost;
 		bool m_cacheErrors;
+		std::atomic<EvictionPolicy> m_evictionPolicy;
+		// Used by the CostAware policy. Negative until the
+		// first item is added.
+		mutable std::atomic<float> m_averageLogRatio;
 
 		// Methods
 		// =======
 
 		// Updates the cached value and updates the current
 		// total cost.
-		bool setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost );
+		bool setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost, std::chrono::nanoseconds computeDuration );
+
+		// Returns the `CacheEntry::priority` for an item, based on the
+		// eviction policy.
+		unsigned char priority( Cost cost, std::chrono::nanoseconds computeDuration ) const;
 
 		// Removes any cached value and updates the current total
 		// cost.
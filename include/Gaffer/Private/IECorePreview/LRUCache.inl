@@ -49,7 +49,9 @@
 #include "tbb/spin_mutex.h"
 #include "tbb/spin_rw_mutex.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <iostream>
 #include <tuple>
 #include <vector>
@@ -86,7 +88,9 @@ enum AcquireMode
 // performance over separate containers because it halves the
 // allocations needed, and moving items within the list doesn't
 // require any allocation at all. We keep the list in exact LRU
-// order.
+// order, but items with a non-zero `CacheEntry::priority` are
+// moved back to the end of the list rather than being popped
+// when they reach the front, until their priority is used up.
 template<typename LRUCache>
 class Serial
 {
@@ -99,7 +103,7 @@ class Serial
 		struct Item
 		{
 			Item( const Key &key )
-				:	key( key ), handleCount( 0 )
+				:	key( key ), handleCount( 0 ), credit( 0 )
 			{
 			}
 
@@ -111,6 +115,9 @@ class Serial
 			// get non-const access to it.
 			mutable CacheEntry cacheEntry;
 			mutable size_t handleCount;
+			// Number of times the item may yet be passed
+			// over by `pop()`.
+			mutable unsigned char credit;
 		};
 
 		using MapAndList = boost::multi_index_container<
@@ -243,6 +250,7 @@ class Serial
 		{
 			List &list = m_mapAndList.template get<1>();
 			list.relocate( list.end(), list.iterator_to( *(handle.m_it) ) );
+			handle.m_it->credit = handle.m_it->cacheEntry.priority;
 		}
 
 		// Pops a copy of the least recently used CacheEntry from the policy,
@@ -259,9 +267,30 @@ class Serial
 			// to `get( someOtherKey )`, and this inner call has
 			// then entered `limitCost()`.
 			typename List::iterator it = list.begin();
-			while( it != list.end() && it->handleCount )
+			while( it != list.end() )
 			{
-				++it;
+				if( it->handleCount )
+				{
+					++it;
+				}
+				else if( it->credit )
+				{
+					// Give the item another chance, by moving
+					// it to the back of the list. We're guaranteed
+					// to reach it again, at which point it will have
+					// less credit.
+					it->credit--;
+					typename List::iterator next = std::next( it );
+					if( next != list.end() )
+					{
+						list.relocate( list.end(), it );
+						it = next;
+					}
+				}
+				else
+				{
+					break;
+				}
 			}
 
 			if( it == list.end() )
@@ -302,16 +331,18 @@ class Parallel
 
 		struct Item
 		{
-			Item() : recentlyUsed() {}
-			Item( const Key &key ) : key( key ), recentlyUsed() {}
-			Item( const Item &other ) : key( other.key ), cacheEntry( other.cacheEntry ), recentlyUsed() {}
+			Item() : credit( 0 ) {}
+			Item( const Key &key ) : key( key ), credit( 0 ) {}
+			Item( const Item &other ) : key( other.key ), cacheEntry( other.cacheEntry ), credit( 0 ) {}
 			Key key;
 			mutable CacheEntry cacheEntry;
 			// Mutex to protect cacheEntry.
 			using Mutex = tbb::spin_rw_mutex;
 			mutable Mutex mutex;
-			// Flag used in second-chance algorithm.
-			mutable std::atomic_bool recentlyUsed;
+			// Number of chances remaining in the second-chance
+			// algorithm. This is 1 for a recently used item, plus
+			// `CacheEntry::priority`.
+			mutable std::atomic<unsigned char> credit;
 		};
 
 		// We would love to use one of TBB's concurrent containers as
@@ -505,9 +536,10 @@ class Parallel
 			// Simply mark the item as having been used
 			// recently. We will then give it a second chance
 			// in pop(), so it will not be evicted immediately.
+			// Items with a priority get additional chances.
 			// We don't need the handle to be writable to write
-			// here, because `recentlyUsed` is atomic.
-			handle.m_item->recentlyUsed.store( true, std::memory_order_release );
+			// here, because `credit` is atomic.
+			handle.m_item->credit.store( 1 + handle.m_item->cacheEntry.priority, std::memory_order_release );
 		}
 
 		bool pop( Key &key, CacheEntry &cacheEntry )
@@ -552,8 +584,8 @@ class Parallel
 						{
 							// We're not empty, but we've been around and around
 							// without finding anything to pop. This could happen
-							// if other threads are frantically setting
-							// the `recentlyUsed` flag or if `clear()` is
+							// if other threads are frantically resetting
+							// the `credit` or if `clear()` is
 							// called from `get()`, while `get()` holds the lock
 							// on the only item we could pop.
 							return false;
@@ -563,7 +595,8 @@ class Parallel
 
 				if( itemLock.try_acquire( m_popIterator->mutex ) )
 				{
-					if( !m_popIterator->recentlyUsed.load( std::memory_order_acquire ) )
+					const unsigned char credit = m_popIterator->credit.load( std::memory_order_acquire );
+					if( !credit )
 					{
 						// Pop this item.
 						key = m_popIterator->key;
@@ -581,10 +614,10 @@ class Parallel
 					}
 					else
 					{
-						// Item has been used recently. Flag it so we
-						// can pop it next time round, unless another
-						// thread resets the flag.
-						m_popIterator->recentlyUsed.store( false, std::memory_order_release );
+						// Item has been used recently, or has priority.
+						// Use up one chance so we can pop it eventually,
+						// unless another thread resets the credit.
+						m_popIterator->credit.store( credit - 1, std::memory_order_release );
 						itemLock.release();
 					}
 				}
@@ -648,16 +681,18 @@ class TaskParallel
 
 		struct Item
 		{
-			Item() : recentlyUsed() {}
-			Item( const Key &key ) : key( key ), recentlyUsed() {}
-			Item( const Item &other ) : key( other.key ), cacheEntry( other.cacheEntry ), recentlyUsed() {}
+			Item() : credit( 0 ) {}
+			Item( const Key &key ) : key( key ), credit( 0 ) {}
+			Item( const Item &other ) : key( other.key ), cacheEntry( other.cacheEntry ), credit( 0 ) {}
 			Key key;
 			mutable CacheEntry cacheEntry;
 			// Mutex to protect cacheEntry.
 			using Mutex = TaskMutex;
 			mutable Mutex mutex;
-			// Flag used in second-chance algorithm.
-			mutable std::atomic_bool recentlyUsed;
+			// Number of chances remaining in the second-chance
+			// algorithm. This is 1 for a recently used item, plus
+			// `CacheEntry::priority`.
+			mutable std::atomic<unsigned char> credit;
 		};
 
 		// We would love to use one of TBB's concurrent containers as
@@ -890,9 +925,10 @@ class TaskParallel
 			// Simply mark the item as having been used
 			// recently. We will then give it a second chance
 			// in pop(), so it will not be evicted immediately.
+			// Items with a priority get additional chances.
 			// We don't need the handle to be writable to write
-			// here, because `recentlyUsed` is atomic.
-			handle.m_item->recentlyUsed.store( true, std::memory_order_release );
+			// here, because `credit` is atomic.
+			handle.m_item->credit.store( 1 + handle.m_item->cacheEntry.priority, std::memory_order_release );
 		}
 
 		bool pop( Key &key, CacheEntry &cacheEntry )
@@ -937,8 +973,8 @@ class TaskParallel
 						{
 							// We're not empty, but we've been around and around
 							// without finding anything to pop. This could happen
-							// if other threads are frantically setting
-							// the `recentlyUsed` flag or if `clear()` is
+							// if other threads are frantically resetting
+							// the `credit` or if `clear()` is
 							// called from `get()`, while `get()` holds the lock
 							// on the only item we could pop.
 							return false;
@@ -948,7 +984,8 @@ class TaskParallel
 
 				if( itemLock.tryAcquire( m_popIterator->mutex ) )
 				{
-					if( !m_popIterator->recentlyUsed.load( std::memory_order_acquire ) )
+					const unsigned char credit = m_popIterator->credit.load( std::memory_order_acquire );
+					if( !credit )
 					{
 						// Pop this item.
 						key = m_popIterator->key;
@@ -966,10 +1003,10 @@ class TaskParallel
 					}
 					else
 					{
-						// Item has been used recently. Flag it so we
-						// can pop it next time round, unless another
-						// thread resets the flag.
-						m_popIterator->recentlyUsed.store( false, std::memory_order_release );
+						// Item has been used recently, or has priority.
+						// Use up one chance so we can pop it eventually,
+						// unless another thread resets the credit.
+						m_popIterator->credit.store( credit - 1, std::memory_order_release );
 						itemLock.release();
 					}
 				}
@@ -1012,7 +1049,7 @@ class TaskParallel
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 LRUCache<Key, Value, Policy, GetterKey>::CacheEntry::CacheEntry()
-	:	cost( 0 )
+	:	cost( 0 ), priority( 0 )
 {
 }
 
@@ -1027,7 +1064,7 @@ typename LRUCache<Key, Value, Policy, GetterKey>::Status LRUCache<Key, Value, Po
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 LRUCache<Key, Value, Policy, GetterKey>::LRUCache( GetterFunction getter, Cost maxCost, RemovalCallback removalCallback, bool cacheErrors )
-	:	m_getter( getter ), m_removalCallback( removalCallback ), m_maxCost( maxCost ), m_cacheErrors( cacheErrors )
+	:	m_getter( getter ), m_removalCallback( removalCallback ), m_maxCost( maxCost ), m_cacheErrors( cacheErrors ), m_evictionPolicy( EvictionPolicy::LRU ), m_averageLogRatio( -1.0f )
 {
 }
 
@@ -1074,6 +1111,18 @@ typename LRUCache<Key, Value, Policy, GetterKey>::Cost LRUCache<Key, Value, Poli
 	return m_policy.currentCost;
 }
 
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+void LRUCache<Key, Value, Policy, GetterKey>::setEvictionPolicy( EvictionPolicy evictionPolicy )
+{
+	m_evictionPolicy = evictionPolicy;
+}
+
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+typename LRUCache<Key, Value, Policy, GetterKey>::EvictionPolicy LRUCache<Key, Value, Policy, GetterKey>::getEvictionPolicy() const
+{
+	return m_evictionPolicy;
+}
+
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 Value LRUCache<Key, Value, Policy, GetterKey>::get( const GetterKey &key, const IECore::Canceller *canceller )
 {
@@ -1087,6 +1136,10 @@ Value LRUCache<Key, Value, Policy, GetterKey>::get( const GetterKey &key, const
 		assert( handle.isWritable() );
 		Value value = Value();
 		Cost cost = 0;
+		// Timing is only needed by the CostAware policy, so we avoid
+		// the overhead otherwise.
+		const bool timed = m_evictionPolicy == EvictionPolicy::CostAware;
+		const auto startTime = timed ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
 		try
 		{
 			handle.execute( [this, &value, &key, &cost, canceller] { value = m_getter( key, cost, canceller ); } );
@@ -1107,7 +1160,8 @@ Value LRUCache<Key, Value, Policy, GetterKey>::get( const GetterKey &key, const
 		assert( cacheEntry.status() != Cached ); // this would indicate that another thread somehow
 		assert( cacheEntry.status() != Failed ); // loaded the same thing as us, which is not the intention.
 
-		setInternal( key, handle.writable(), value, cost );
+		const std::chrono::nanoseconds computeDuration = timed ? std::chrono::steady_clock::now() - startTime : std::chrono::nanoseconds( 0 );
+		setInternal( key, handle.writable(), value, cost, computeDuration );
 		m_policy.push( handle );
 
 		handle.release();
@@ -1154,12 +1208,12 @@ std::optional<Value> LRUCache<Key, Value, Policy, GetterKey>::getIfCached( const
 }
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
-bool LRUCache<Key, Value, Policy, GetterKey>::set( const Key &key, const Value &value, Cost cost )
+bool LRUCache<Key, Value, Policy, GetterKey>::set( const Key &key, const Value &value, Cost cost, std::chrono::nanoseconds computeDuration )
 {
 	typename Policy<LRUCache>::Handle handle;
 	m_policy.acquire( key, handle, LRUCachePolicy::InsertWritable, /* canceller = */ nullptr );
 	assert( handle.isWritable() );
-	bool result = setInternal( key, handle.writable(), value, cost );
+	bool result = setInternal( key, handle.writable(), value, cost, computeDuration );
 	m_policy.push( handle );
 	handle.release();
 	limitCost( m_maxCost );
@@ -1168,7 +1222,7 @@ bool LRUCache<Key, Value, Policy, GetterKey>::set( const Key &key, const Value &
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 template<typename CostFunction>
-bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction )
+bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction, std::chrono::nanoseconds computeDuration )
 {
 	typename Policy<LRUCache>::Handle handle;
 	m_policy.acquire( key, handle, LRUCachePolicy::Insert, /* canceller = */ nullptr );
@@ -1179,7 +1233,7 @@ bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, con
 	if( status == Uncached )
 	{
 		assert( handle.isWritable() );
-		result = setInternal( key, handle.writable(), value, costFunction( value ) );
+		result = setInternal( key, handle.writable(), value, costFunction( value ), computeDuration );
 		m_policy.push( handle );
 
 		handle.release();
@@ -1189,7 +1243,7 @@ bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, con
 }
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
-bool LRUCache<Key, Value, Policy, GetterKey>::setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost )
+bool LRUCache<Key, Value, Policy, GetterKey>::setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost, std::chrono::nanoseconds computeDuration )
 {
 	eraseInternal( key, cacheEntry );
 
@@ -1200,12 +1254,44 @@ bool LRUCache<Key, Value, Policy, GetterKey>::setInternal( const Key &key, Cache
 
 	cacheEntry.state = value;
 	cacheEntry.cost = cost;
+	cacheEntry.priority = priority( cost, computeDuration );
 
 	m_policy.currentCost += cost;
 
 	return true;
 }
 
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+unsigned char LRUCache<Key, Value, Policy, GetterKey>::priority( Cost cost, std::chrono::nanoseconds computeDuration ) const
+{
+	if( m_evictionPolicy == EvictionPolicy::LRU )
+	{
+		return 0;
+	}
+
+	// GreedyDual-Size ranks items by the ratio of recompute time to
+	// cost, discarding the lowest ranked item and then "ageing" the
+	// remaining items by its rank. We approximate this by quantising
+	// the ratio logarithmically into a number of additional chances
+	// each item gets in the second-chance algorithm used by the policies,
+	// with each pass of the policy over an item serving as the ageing step.
+	//
+	// The ratio is measured relative to a running average, so that the
+	// priorities are independent of the units used for cost, and items of
+	// average or below average expense are treated exactly as they would be
+	// by the LRU policy. Concurrent updates to the average may be lost, but
+	// that is of no consequence.
+	const float logRatio = std::log2( 1.0 + (double)computeDuration.count() / (double)std::max<Cost>( cost, 1 ) );
+	float average = m_averageLogRatio.load( std::memory_order_relaxed );
+	if( average < 0.0f )
+	{
+		// First item. Seed the average with it.
+		average = logRatio;
+	}
+	m_averageLogRatio.store( average + ( logRatio - average ) / 64.0f, std::memory_order_relaxed );
+	return (unsigned char)std::clamp( logRatio - average, 0.0f, 15.0f );
+}
+
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 bool LRUCache<Key, Value, Policy, GetterKey>::cached( const Key &key ) const
 {
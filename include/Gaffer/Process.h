@@ -38,6 +38,7 @@
 
 #include "Gaffer/Context.h"
 #include "Gaffer/Export.h"
+#include "Gaffer/Monitor.h"
 #include "Gaffer/Plug.h"
 #include "Gaffer/ThreadState.h"
 
@@ -99,6 +100,10 @@ class GAFFER_API Process : private ThreadState::Scope
 		/// the original caller.
 		[[noreturn]] void handleException() const;
 
+		/// Reports a secondary cache access to the currently active monitors.
+		/// See `Monitor::cacheEvent()`.
+		void cacheEvent( Monitor::CacheEvent event, size_t bytes = 0 ) const;
+
 		/// Searches for an in-flight process and waits for its result, collaborating
 		/// on any TBB tasks it spawns. If no such process exists, constructs one
 		/// using `args` and makes it available for collaboration by other threads,
@@ -111,8 +116,9 @@ class GAFFER_API Process : private ThreadState::Scope
 		/// - `ProcessType::ResultType` defines the result type for the process.
 		/// - `ProcessType::run()` does the work for the process and returns the
 		///   result.
-		/// - `ProcessType::g_cache` is a static LRUCache of type `ProcessType::CacheType`
-		///   to be used for the caching of the result.
+		/// - `ProcessType::g_cache` is a static cache of type `ProcessType::CacheType`
+		///   to be used for the caching of the result. This must provide the
+		///   `getIfCached()` and `setIfUncached()` methods of LRUCache.
 		/// - `ProcessType::cacheCostFunction()` is a static function suitable
 		///   for use with `CacheType::setIfUncached()`.
 		///
@@ -120,6 +126,13 @@ class GAFFER_API Process : private ThreadState::Scope
 		static typename ProcessType::ResultType acquireCollaborativeResult(
 			const typename ProcessType::CacheType::KeyType &cacheKey, ProcessArguments&&... args
 		);
+		/// As above, but using `cache` in place of `ProcessType::g_cache`.
+		/// This allows the results of a single ProcessType to be partitioned
+		/// between several caches.
+		template<typename ProcessType, typename... ProcessArguments>
+		static typename ProcessType::ResultType acquireCollaborativeResult(
+			typename ProcessType::CacheType &cache, const typename ProcessType::CacheType::KeyType &cacheKey, ProcessArguments&&... args
+		);
 
 	private :
 
@@ -39,6 +39,7 @@
 #include "tbb/task_arena.h"
 #include "tbb/task_group.h"
 
+#include <chrono>
 #include <unordered_set>
 #include <variant>
 
@@ -307,6 +308,14 @@ template<typename ProcessType, typename... ProcessArguments>
 typename ProcessType::ResultType Process::acquireCollaborativeResult(
 	const typename ProcessType::CacheType::KeyType &cacheKey, ProcessArguments&&... args
 )
+{
+	return acquireCollaborativeResult<ProcessType>( ProcessType::g_cache, cacheKey, std::forward<ProcessArguments>( args )... );
+}
+
+template<typename ProcessType, typename... ProcessArguments>
+typename ProcessType::ResultType Process::acquireCollaborativeResult(
+	typename ProcessType::CacheType &cache, const typename ProcessType::CacheType::KeyType &cacheKey, ProcessArguments&&... args
+)
 {
 	const ThreadState &threadState = ThreadState::current();
 	const Collaboration *currentCollaboration = threadState.process() ? threadState.process()->m_collaboration : nullptr;
@@ -380,7 +389,7 @@ typename ProcessType::ResultType Process::acquireCollaborativeResult(
 	// First though, check the cache one more time, in case another thread has
 	// started and finished an equivalent collaboration since we first checked.
 
-	if( auto result = ProcessType::g_cache.getIfCached( cacheKey ) )
+	if( auto result = cache.getIfCached( cacheKey ) )
 	{
 		return *result;
 	}
@@ -406,13 +415,17 @@ typename ProcessType::ResultType Process::acquireCollaborativeResult(
 					{
 						ProcessType process( std::forward<ProcessArguments>( args )... );
 						process.m_collaboration = collaboration.get();
+						const auto startTime = std::chrono::steady_clock::now();
 						collaboration->result = process.run();
 						// Publish result to cache before we remove ourself from
 						// `g_pendingCollaborations`, so that other threads will
-						// be able to get the result one way or the other.
-						ProcessType::g_cache.setIfUncached(
+						// be able to get the result one way or the other. The
+						// duration of the process is provided for use by the
+						// cache's eviction policy.
+						cache.setIfUncached(
 							cacheKey, std::get<typename ProcessType::ResultType>( collaboration->result ),
-							ProcessType::cacheCostFunction
+							ProcessType::cacheCostFunction,
+							std::chrono::steady_clock::now() - startTime
 						);
 					}
 					catch( ... )
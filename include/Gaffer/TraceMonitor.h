@@ -0,0 +1,156 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Gaffer/Monitor.h"
+
+#include "IECore/InternedString.h"
+#include "IECore/MurmurHash.h"
+
+#include "tbb/enumerable_thread_specific.h"
+
+#include <chrono>
+#include <iosfwd>
+#include <unordered_set>
+#include <vector>
+
+namespace Gaffer
+{
+
+IE_CORE_FORWARDDECLARE( Plug )
+
+/// A monitor which records the start and finish of each process, so that
+/// activity can be viewed on a per-thread timeline. This is useful for
+/// identifying stalls and poor parallelism that are invisible in the totals
+/// collected by PerformanceMonitor.
+///
+/// Events are recorded into a ring buffer for each thread, without any locking
+/// or contention between threads. When a buffer is full, the oldest events are
+/// discarded.
+class GAFFER_API TraceMonitor : public Monitor
+{
+
+	public :
+
+		TraceMonitor( size_t maxEventsPerThread = 100000 );
+		~TraceMonitor() override;
+
+		IE_CORE_DECLAREMEMBERPTR( TraceMonitor )
+
+		enum class Format
+		{
+			/// The JSON Trace Event Format, as viewed in `chrome://tracing`
+			/// or https://ui.perfetto.dev.
+			Chrome,
+			/// The Perfetto protobuf format.
+			Perfetto
+		};
+
+		/// Query and output functions. These are not thread-safe, and must be called
+		/// only when the Monitor is not active (as defined by `Monitor::Scope`).
+		///
+		/// Returns the number of events currently held in the buffers.
+		size_t numEvents() const;
+		/// Returns the number of events that have been discarded because
+		/// a buffer was full.
+		size_t numDiscardedEvents() const;
+		/// Writes the trace to `stream`. Each process is written as a slice
+		/// named after its plug, and annotated with the process type, context
+		/// hash and cache result. Because processes are only launched following
+		/// a miss in the in-memory cache, the cache result is either "miss" or
+		/// "diskCacheHit". Disk cache accesses are also written as instant events.
+		void writeTrace( std::ostream &stream, Format format ) const;
+		/// As above, but writes to a file, choosing the format from the extension :
+		/// ".json" for `Chrome` and ".pftrace" for `Perfetto`.
+		void writeTrace( const std::string &fileName ) const;
+
+	protected :
+
+		void processStarted( const Process *process ) override;
+		void processFinished( const Process *process ) override;
+		void cacheEvent( const Process *process, CacheEvent event, size_t bytes ) override;
+
+	private :
+
+		struct Event
+		{
+			enum class Type : uint8_t
+			{
+				ProcessStarted,
+				ProcessFinished,
+				DiskCacheHit,
+				DiskCacheMiss,
+				DiskCacheWrite
+			};
+
+			Type type;
+			std::chrono::steady_clock::time_point time;
+			// Process details are recorded for both `ProcessStarted` and
+			// `ProcessFinished`, so that processes can still be output if
+			// their start has been discarded from the buffer. For cache
+			// events, `bytes` is recorded instead of the context hash.
+			const Plug *plug;
+			IECore::InternedString processType;
+			IECore::MurmurHash contextHash;
+			size_t bytes;
+		};
+
+		struct ThreadData
+		{
+			ThreadData();
+			int id;
+			// Ring buffer, growing on demand up to `m_maxEventsPerThread`.
+			std::vector<Event> events;
+			size_t next;
+			size_t discarded;
+			// Keeps alive all plugs referenced by `events`. We use a separate
+			// set of raw pointers for the lookup to avoid reference count churn.
+			std::unordered_set<const Plug *> plugs;
+			std::vector<ConstPlugPtr> plugOwners;
+		};
+
+		void record( const Process *process, Event::Type type, size_t bytes = 0 );
+
+		const size_t m_maxEventsPerThread;
+		const std::chrono::steady_clock::time_point m_startTime;
+		mutable tbb::enumerable_thread_specific<ThreadData> m_threadData;
+
+};
+
+IE_CORE_DECLAREPTR( TraceMonitor )
+
+} // namespace Gaffer
@@ -40,6 +40,7 @@
 #include "Gaffer/Plug.h"
 
 #include "IECore/Object.h"
+#include "IECore/InternedString.h"
 
 namespace Gaffer
 {
@@ -150,33 +151,99 @@ class GAFFER_API ValuePlug : public Plug
 		/// of the cache.
 		////////////////////////////////////////////////////////////////////
 		//@{
-		/// Returns the maximum amount of memory in bytes to use for the cache.
+		/// Returns the maximum amount of memory in bytes to use for the
+		/// default partition of the cache.
 		static size_t getCacheMemoryLimit();
-		/// Sets the maximum amount of memory the cache may use in bytes.
+		/// Sets the maximum amount of memory the default partition of the
+		/// cache may use in bytes.
 		static void setCacheMemoryLimit( size_t bytes );
-		/// Returns the current memory usage of the cache in bytes.
+		/// Returns the current memory usage of the cache in bytes, summed
+		/// over all partitions.
 		static size_t cacheMemoryUsage();
-		/// Clears the cache.
+		/// Clears the cache, including all partitions.
 		static void clearCache();
+
+		/// Sets the maximum amount of memory used by the named cache partition.
+		/// Values are assigned to partitions by `ComputeNode::computeCachePartition()`.
+		/// Partitions are created on demand by the first call to this function;
+		/// until then their values are stored in the default partition, which
+		/// is also used for the empty partition name.
+		static void setCachePartitionMemoryLimit( const IECore::InternedString &partition, size_t bytes );
+		static size_t getCachePartitionMemoryLimit( const IECore::InternedString &partition );
+		/// Returns the current memory usage of the named partition in bytes.
+		static size_t cachePartitionMemoryUsage( const IECore::InternedString &partition );
+		/// Returns the names of all partitions created by
+		/// `setCachePartitionMemoryLimit()`.
+		static std::vector<IECore::InternedString> cachePartitions();
+
+		/// Determines which values are discarded when the cache
+		/// memory limit is reached.
+		enum class CacheEvictionPolicy
+		{
+			/// Values that have not been used recently are discarded
+			/// first.
+			LRU,
+			/// Values that are quick to compute relative to their memory
+			/// usage are discarded before values that are slow to compute,
+			/// while still accounting for recency of use. This is an
+			/// approximation of the GreedyDual-Size algorithm, using the
+			/// wall-clock time taken by `ComputeNode::compute()`.
+			CostAware
+		};
+
+		/// Sets the eviction policy for the cache. Defaults to `LRU`.
+		static void setCacheEvictionPolicy( CacheEvictionPolicy policy );
+		static CacheEvictionPolicy getCacheEvictionPolicy();
+		//@}
+
+		/// @name Disk cache management
+		/// Values which are expensive to compute may also be stored in an
+		/// optional persistent cache on disk, from where they can be reused
+		/// by subsequent processes on the same host, such as the tasks for
+		/// consecutive frames of a farm job. The disk cache is consulted
+		/// whenever a value is not found in the memory cache.
+		///
+		/// > Caution : Sharing values between processes relies on
+		/// > `ComputeNode::hash()` being stable from one process to the next.
+		/// > This is true for all nodes that hash only their inputs, but not for
+		/// > those that hash transient state such as memory addresses.
+		////////////////////////////////////////////////////////////////////
+		//@{
+		/// Sets the directory used to store the disk cache, which may be shared
+		/// between multiple processes. Passing an empty string disables the
+		/// disk cache, which is the default.
+		static void setDiskCacheDirectory( const std::string &directory );
+		static std::string getDiskCacheDirectory();
+		/// Sets the maximum amount of disk space in bytes used by the cache.
+		/// This limit is enforced independently by each process.
+		static void setDiskCacheSizeLimit( size_t bytes );
+		static size_t getDiskCacheSizeLimit();
+		/// Values are only written to the disk cache if they took at least
+		/// this long to compute, measured in seconds.
+		static void setDiskCacheMinimumComputeTime( float seconds );
+		static float getDiskCacheMinimumComputeTime();
+		/// Returns the size in bytes of the disk cache entries known to
+		/// this process.
+		static size_t diskCacheUsage();
+		/// Removes all entries known to this process from the disk cache.
+		static void clearDiskCache();
 		//@}
 
 		/// @name Hash cache management
 		/// In addition to the cache of recently computed values, we also
-		/// keep a per-thread cache of recently computed hashes. These functions
-		/// allow for management of that cache.
+		/// keep a cache of recently computed hashes, shared by all threads.
+		/// These functions allow for management of that cache.
 		////////////////////////////////////////////////////////////////////
 		//@{
 		static size_t getHashCacheSizeLimit();
-		/// > Note : Limits are applied on a per-thread basis as and
-		/// > when each thread is used to compute a hash.
-		static void setHashCacheSizeLimit( size_t maxEntriesPerThread );
-		/// Returns the total number of entries in both global and per-thread hash caches
+		/// Sets the maximum number of entries in the hash cache. Existing
+		/// entries are discarded when the limit is changed.
+		static void setHashCacheSizeLimit( size_t maxEntries );
+		/// Returns the number of entries in the hash cache.
 		static size_t hashCacheTotalUsage();
-		/// Clears the hash cache.
-		/// > Note : By default, clearing occurs on a per-thread basis as
-		/// > and when each thread next accesses its cache. Pass `now = true`
-		/// > to force all thread-local caches to be cleared immediately
-		/// > (this is not thread-safe with respect to concurrent computations).
+		/// Clears the hash cache. This is thread-safe and takes effect
+		/// immediately.
+		/// \todo Remove `now` argument, which is now ignored.
 		static void clearHashCache( bool now = false );
 
 		/// The standard hash cache mode relies on correctly implemented
@@ -159,6 +159,28 @@ class ComputeNodeWrapper : public DependencyNodeWrapper<WrappedType>
 			return WrappedType::computeCachePolicy( output );
 		}
 
+		IECore::InternedString computeCachePartition( const Gaffer::ValuePlug *output ) const override
+		{
+			if( this->isSubclassed() )
+			{
+				IECorePython::ScopedGILLock gilLock;
+				try
+				{
+					boost::python::object f = this->methodOverride( "computeCachePartition" );
+					if( f )
+					{
+						boost::python::object partition = f( Gaffer::ValuePlugPtr( const_cast<Gaffer::ValuePlug *>( output ) ) );
+						return IECore::InternedString( boost::python::extract<std::string>( partition )() );
+					}
+				}
+				catch( const boost::python::error_already_set & )
+				{
+					IECorePython::ExceptionAlgo::translatePythonException();
+				}
+			}
+			return WrappedType::computeCachePartition( output );
+		}
+
 };
 
 } // namespace GafferBindings
@@ -54,6 +54,18 @@ class GAFFERIMAGE_API Blur : public FlatImageProcessor
 
 		GAFFER_NODE_DECLARE_TYPE( GafferImage::Blur, BlurTypeId, FlatImageProcessor );
 
+		enum class Method
+		{
+			/// Filters with a smooth gaussian. The cost per pixel is
+			/// proportional to the radius.
+			Accurate,
+			/// Approximates the gaussian with repeated box filters applied
+			/// to the whole image. The cost per pixel is independent of the
+			/// radius, making this much faster for large radii, at the expense
+			/// of computing the whole image even when only a few tiles are needed.
+			Fast
+		};
+
 		Gaffer::V2fPlug *radiusPlug();
 		const Gaffer::V2fPlug *radiusPlug() const;
 
@@ -63,6 +75,9 @@ class GAFFERIMAGE_API Blur : public FlatImageProcessor
 		Gaffer::BoolPlug *expandDataWindowPlug();
 		const Gaffer::BoolPlug *expandDataWindowPlug() const;
 
+		Gaffer::IntPlug *methodPlug();
+		const Gaffer::IntPlug *methodPlug() const;
+
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
 
 	protected :
@@ -79,6 +94,11 @@ class GAFFERIMAGE_API Blur : public FlatImageProcessor
 		Gaffer::FloatVectorDataPlug *resampledChannelDataPlug();
 		const Gaffer::FloatVectorDataPlug *resampledChannelDataPlug() const;
 
+		// Output plug to compute the whole channel for the Fast method.
+		// Evaluated without a tile origin in the context.
+		Gaffer::FloatVectorDataPlug *fastBlurPlug();
+		const Gaffer::FloatVectorDataPlug *fastBlurPlug() const;
+
 		// Internal resample node.
 		Resample *resample();
 		const Resample *resample() const;
@@ -92,6 +112,9 @@ class GAFFERIMAGE_API Blur : public FlatImageProcessor
 		void hashChannelData( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 		IECore::ConstFloatVectorDataPtr computeChannelData( const std::string &channelName, const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent ) const override;
 
+		Gaffer::ValuePlug::CachePolicy computeCachePolicy( const Gaffer::ValuePlug *output ) const override;
+		Gaffer::ValuePlug::CachePolicy hashCachePolicy( const Gaffer::ValuePlug *output ) const override;
+
 		static size_t g_firstPlugIndex;
 
 };
@@ -64,6 +64,21 @@ class GAFFERIMAGE_API ChannelDataProcessor : public ImageProcessor
 		Gaffer::BoolPlug *processUnpremultipliedPlug();
 		const Gaffer::BoolPlug *processUnpremultipliedPlug() const;
 
+		/// When fusion is enabled, a chain of ChannelDataProcessors connected one to
+		/// the next is computed as a single operation : the input tile is fetched once,
+		/// and the processChannelData() method of each node in the chain is applied to
+		/// it in turn. Only the output of the last node is stored in the cache. Hashes
+		/// are unaffected, and results are identical to those computed without fusion.
+		/// A node whose output is also used elsewhere terminates the chain, as does
+		/// any node which isn't a ChannelDataProcessor, such as a ColorProcessor. Errors
+		/// and monitoring statistics are still attributed to each node's own output.
+		/// Fusion is enabled by default.
+		///
+		/// > Note : Fused nodes are processed by calling processChannelData() directly, so
+		/// > derived classes must not override computeChannelData().
+		static void setFusionEnabled( bool enabled );
+		static bool getFusionEnabled();
+
 	protected :
 
 		/// This implementation queries whether or not the requested channel is masked by the channelMaskPlug().
@@ -80,10 +95,28 @@ class GAFFERIMAGE_API ChannelDataProcessor : public ImageProcessor
 		///                     It is useful for querying Color4f plugs for the value that coresponds to the channel being processed.
 		/// @param outData The tile where the result of the operation should be written. It is initialized with the coresponding tile data from inPlug() which should be used as the input data.
 		virtual void processChannelData( const Gaffer::Context *context, const ImagePlug *parent, const std::string &channel, IECore::FloatVectorDataPtr outData ) const = 0;
+		/// May be implemented by derived classes to return true if processChannelData()
+		/// produces a uniform result when given a uniform input. Input tiles identified
+		/// by `ImagePlug::isConstantTile()` are then processed as a single pixel, by passing
+		/// `outData` with a size of 1, and the result is output as a constant tile. The
+		/// default implementation returns false.
+		virtual bool processesConstantTiles( const Gaffer::Context *context, const std::string &channel ) const;
 
 		void hashChannelData( const GafferImage::ImagePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 
 	private :
+
+		// Applies processChannelData(), along with any unpremultiplication
+		// requested by processUnpremultipliedPlug().
+		void processTile( const std::string &channelName, const Gaffer::Context *context, const ImagePlug *parent, const IECore::FloatVectorDataPtr &outData ) const;
+		// Returns true if processTile() may be called with a single pixel
+		// from a constant tile.
+		bool constantTileSupported( const std::string &channelName, const Gaffer::Context *context ) const;
+		// Returns the plug from which the input tile for a fused compute should be
+		// read, filling `upstreamProcessors` with the nodes whose processing should
+		// be applied to it before our own. They are ordered from downstream to upstream.
+		const ImagePlug *fusedInput( const std::string &channelName, const Gaffer::Context *context, std::vector<const ChannelDataProcessor *> &upstreamProcessors ) const;
+
 		bool m_hasUnpremultPlug;
 
 		static size_t g_firstPlugIndex;
@@ -62,6 +62,8 @@ class GAFFERIMAGE_API DeepHoldout : public ImageProcessor
 
 	protected :
 
+		Gaffer::ValuePlug::CachePolicy computeCachePolicy( const Gaffer::ValuePlug *output ) const override;
+
 		bool computeDeep( const Gaffer::Context *context, const ImagePlug *parent ) const override;
 		void hashSampleOffsets( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 		IECore::ConstIntVectorDataPtr computeSampleOffsets( const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent ) const override;
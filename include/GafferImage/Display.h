@@ -43,6 +43,7 @@
 
 #include "IECoreImage/DisplayDriver.h"
 
+#include <atomic>
 #include <functional>
 
 namespace GafferImage
@@ -114,6 +115,7 @@ class GAFFERIMAGE_API Display : public ImageNode
 		GafferDisplayDriverPtr m_driver;
 		Gaffer::Signals::Connection m_dataReceivedConnection;
 		Gaffer::Signals::Connection m_imageReceivedConnection;
+		std::atomic_bool m_dataReceivedPending;
 
 		Gaffer::IntPlug *driverCountPlug();
 		const Gaffer::IntPlug *driverCountPlug() const;
@@ -49,6 +49,13 @@ IECORE_POP_DEFAULT_VISIBILITY
 namespace GafferImage
 {
 
+namespace Private
+{
+
+class RegionBuffer;
+
+} // namespace Private
+
 namespace FilterAlgo
 {
 
@@ -65,6 +72,9 @@ GAFFERIMAGE_API Imath::Box2f filterSupport( const Imath::V2f &p, float dx, float
 // The sampler must have been initialized to cover all pixels with centers lying with the support of the filter,
 // filterSupport above may be used to compute an appropriate bound.
 GAFFERIMAGE_API float sampleBox( Sampler &sampler, const Imath::V2f &p, float dx, float dy, const OIIO::Filter2D *filter, std::vector<float> &scratchMemory );
+// As above, but sampling from a RegionBuffer, which must contain all pixels with centers lying within
+// the support of the filter.
+GAFFERIMAGE_API float sampleBox( const Private::RegionBuffer &regionBuffer, const Imath::V2f &p, float dx, float dy, const OIIO::Filter2D *filter, std::vector<float> &scratchMemory );
 
 // Sample over a parallelogram shaped region defined by a center point and two derivative directions.
 // The sampler must have been initialized to cover all pixels with centers lying with the support of the filter
@@ -86,6 +86,7 @@ class GAFFERIMAGE_API Grade : public ChannelDataProcessor
 
 		void hashChannelData( const GafferImage::ImagePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 		void processChannelData( const Gaffer::Context *context, const ImagePlug *parent, const std::string &channelIndex, IECore::FloatVectorDataPtr outData ) const override;
+		bool processesConstantTiles( const Gaffer::Context *context, const std::string &channel ) const override;
 
 	private :
 
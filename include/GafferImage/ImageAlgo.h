@@ -143,14 +143,19 @@ void parallelProcessTiles(
 	TileOrder tileOrder = Unordered
 );
 
-// Call the functor in parallel, once per tile per channel
+// Call the functor in parallel, once per tile per channel. If `prefetchChannelData`
+// is true, upstream channel data is prefetched in the background for the rows of
+// tiles ahead of those being processed - see `setTilePrefetchRows()`. This should
+// only be used when the functor computes `channelData` for every tile, and is
+// ignored when called from within a compute.
 template <class TileFunctor>
 void parallelProcessTiles(
 	const ImagePlug *imagePlug,
 	const std::vector<std::string> &channelNames,
 	TileFunctor &&functor, // Signature : void functor( const ImagePlug *imagePlug, const string &channelName, const V2i &tileOrigin )
 	const Imath::Box2i &window = Imath::Box2i(), // Uses dataWindow if not specified ( requires a valid view in the context )
-	TileOrder tileOrder = Unordered
+	TileOrder tileOrder = Unordered,
+	bool prefetchChannelData = false
 );
 
 // Process all tiles in parallel using TileFunctor, passing the
@@ -165,7 +170,8 @@ void parallelGatherTiles(
 );
 
 // Process all tiles in parallel using TileFunctor, passing the
-// results in series to GatherFunctor.
+// results in series to GatherFunctor. Upstream channel data may be
+// prefetched in the background, as for `parallelProcessTiles()`.
 template <class TileFunctor, class GatherFunctor>
 void parallelGatherTiles(
 	const ImagePlug *image,
@@ -173,9 +179,19 @@ void parallelGatherTiles(
 	const TileFunctor &tileFunctor, // Signature : T tileFunctor( const ImagePlug *imagePlug, const string &channelName, const V2i &tileOrigin )
 	GatherFunctor &&gatherFunctor, // Signature : void gatherFunctor( const ImagePlug *imagePlug, const string &channelName, const V2i &tileOrigin, T &tileFunctorResult )
 	const Imath::Box2i &window = Imath::Box2i(), // Uses dataWindow if not specified ( requires a valid view in the context )
-	TileOrder tileOrder = Unordered
+	TileOrder tileOrder = Unordered,
+	bool prefetchChannelData = false
 );
 
+// Sets the number of rows of tiles that the per-channel versions of
+// `parallelProcessTiles()` and `parallelGatherTiles()` prefetch ahead of the
+// tiles being processed, when called with `prefetchChannelData = true`. Prefetching is performed by BackgroundTasks which
+// compute `channelData` in tile order, so that the tile batches read by
+// upstream readers are loaded while the current row is still being processed
+// by downstream nodes. A value of 0 disables prefetching. Defaults to 1.
+GAFFERIMAGE_API void setTilePrefetchRows( int rows );
+GAFFERIMAGE_API int getTilePrefetchRows();
+
 /// Whole view operations
 /// ==============================
 ///
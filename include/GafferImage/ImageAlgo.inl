@@ -41,11 +41,22 @@
 
 #include "Gaffer/Context.h"
 
+#include "boost/noncopyable.hpp"
 #include "boost/tuple/tuple.hpp"
 
 #include "tbb/pipeline.h"
 #include "tbb/task_scheduler_init.h"
 
+#include <memory>
+#include <optional>
+
+namespace Gaffer
+{
+
+class BackgroundTask;
+
+} // namespace Gaffer
+
 namespace GafferImage
 {
 
@@ -123,12 +134,44 @@ struct OriginAndName
 	std::string name;
 };
 
+// Launches BackgroundTasks to compute `channelData` for the rows of tiles
+// ahead of those issued by TileInputFilter.
+class GAFFERIMAGE_API TilePrefetcher : boost::noncopyable
+{
+
+	public :
+
+		// Prefetching is disabled if constructed from within a compute or hash
+		// process, because waiting for the prefetch tasks from a TBB worker
+		// could deadlock or oversubscribe the machine.
+		TilePrefetcher( const ImagePlug *imagePlug, const std::vector<std::string> &channelNames, const Imath::Box2i &window, TileOrder tileOrder );
+		// Cancels any outstanding prefetches, and waits for them to finish.
+		~TilePrefetcher();
+
+		// Must be called for each tile in turn, as it is issued for processing.
+		void tileIssued( const Imath::V2i &tileOrigin );
+
+	private :
+
+		void prefetchRow( int y, const IECore::Canceller &canceller ) const;
+
+		const ImagePlug *m_imagePlug;
+		const std::vector<std::string> &m_channelNames;
+		const Imath::Box2i m_range;
+		const int m_rowStep;
+		const int m_numRows;
+		int m_nextRow;
+		std::optional<Gaffer::ThreadState> m_threadState;
+		std::vector<std::unique_ptr<Gaffer::BackgroundTask>> m_tasks;
+
+};
+
 template <class Iterator>
 class TileInputFilter
 {
 	public:
-		TileInputFilter( Iterator &it )
-			:	m_it( it )
+		TileInputFilter( Iterator &it, TilePrefetcher *prefetcher = nullptr )
+			:	m_it( it ), m_prefetcher( prefetcher )
 		{}
 
 		typename Iterator::value_type operator()( tbb::flow_control &fc ) const
@@ -140,6 +183,10 @@ class TileInputFilter
 			}
 
 			typename Iterator::value_type result = *m_it;
+			if( m_prefetcher )
+			{
+				m_prefetcher->tileIssued( result );
+			}
 			++m_it;
 			return result;
 		}
@@ -147,6 +194,7 @@ class TileInputFilter
 	private:
 
 		Iterator &m_it;
+		TilePrefetcher *m_prefetcher;
 
 };
 
@@ -252,8 +300,11 @@ inline bool channelExists( const std::vector<std::string> &channelNames, const s
 	return std::find( channelNames.begin(), channelNames.end(), channelName ) != channelNames.end();
 }
 
+namespace Detail
+{
+
 template <class TileFunctor>
-void parallelProcessTiles( const ImagePlug *imagePlug, TileFunctor &&functor, const Imath::Box2i &window, TileOrder tileOrder )
+void parallelProcessTiles( const ImagePlug *imagePlug, TileFunctor &&functor, const Imath::Box2i &window, TileOrder tileOrder, const std::vector<std::string> *prefetchChannelNames )
 {
 	Imath::Box2i processWindow = window;
 	if( processWindow == Imath::Box2i() )
@@ -269,12 +320,18 @@ void parallelProcessTiles( const ImagePlug *imagePlug, TileFunctor &&functor, co
 	Detail::TileInputIterator tileIterator( processWindow, tileOrder );
 	const Gaffer::ThreadState &threadState = Gaffer::ThreadState::current();
 
+	std::optional<Detail::TilePrefetcher> prefetcher;
+	if( prefetchChannelNames )
+	{
+		prefetcher.emplace( imagePlug, *prefetchChannelNames, processWindow, tileOrder );
+	}
+
 	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
 	parallel_pipeline( tbb::task_scheduler_init::default_num_threads(),
 
 		tbb::make_filter<void, Imath::V2i>(
 			tbb::filter::serial,
-			Detail::TileInputFilter<Detail::TileInputIterator>( tileIterator )
+			Detail::TileInputFilter<Detail::TileInputIterator>( tileIterator, prefetcher ? &*prefetcher : nullptr )
 		) &
 
 		tbb::make_filter<Imath::V2i, void>(
@@ -297,8 +354,16 @@ void parallelProcessTiles( const ImagePlug *imagePlug, TileFunctor &&functor, co
 	);
 }
 
+} // namespace Detail
+
+template <class TileFunctor>
+void parallelProcessTiles( const ImagePlug *imagePlug, TileFunctor &&functor, const Imath::Box2i &window, TileOrder tileOrder )
+{
+	Detail::parallelProcessTiles( imagePlug, std::forward<TileFunctor>( functor ), window, tileOrder, nullptr );
+}
+
 template <class TileFunctor>
-void parallelProcessTiles( const ImagePlug *imagePlug, const std::vector<std::string> &channelNames, TileFunctor &&functor, const Imath::Box2i &window, TileOrder tileOrder )
+void parallelProcessTiles( const ImagePlug *imagePlug, const std::vector<std::string> &channelNames, TileFunctor &&functor, const Imath::Box2i &window, TileOrder tileOrder, bool prefetchChannelData )
 {
 
 	// In theory, we could run in parallel over all tiles and channels at the same time.  However,
@@ -328,11 +393,14 @@ void parallelProcessTiles( const ImagePlug *imagePlug, const std::vector<std::st
 		}
 	};
 
-	parallelProcessTiles( imagePlug, f, window, tileOrder );
+	Detail::parallelProcessTiles( imagePlug, f, window, tileOrder, prefetchChannelData ? &channelNames : nullptr );
 }
 
+namespace Detail
+{
+
 template <class TileFunctor, class GatherFunctor>
-void parallelGatherTiles( const ImagePlug *imagePlug, const TileFunctor &tileFunctor, GatherFunctor &&gatherFunctor, const Imath::Box2i &window, TileOrder tileOrder )
+void parallelGatherTiles( const ImagePlug *imagePlug, const TileFunctor &tileFunctor, GatherFunctor &&gatherFunctor, const Imath::Box2i &window, TileOrder tileOrder, const std::vector<std::string> *prefetchChannelNames )
 {
 	Imath::Box2i processWindow = window;
 	if( processWindow == Imath::Box2i() )
@@ -351,12 +419,18 @@ void parallelGatherTiles( const ImagePlug *imagePlug, const TileFunctor &tileFun
 	Detail::TileInputIterator tileIterator( processWindow, tileOrder );
 	const Gaffer::ThreadState &threadState = Gaffer::ThreadState::current();
 
+	std::optional<Detail::TilePrefetcher> prefetcher;
+	if( prefetchChannelNames )
+	{
+		prefetcher.emplace( imagePlug, *prefetchChannelNames, processWindow, tileOrder );
+	}
+
 	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
 	parallel_pipeline( tbb::task_scheduler_init::default_num_threads(),
 
 		tbb::make_filter<void, Imath::V2i>(
 			tbb::filter::serial,
-			Detail::TileInputFilter<Detail::TileInputIterator>( tileIterator )
+			Detail::TileInputFilter<Detail::TileInputIterator>( tileIterator, prefetcher ? &*prefetcher : nullptr )
 		) &
 
 		tbb::make_filter<Imath::V2i, TileFilterResult>(
@@ -396,8 +470,16 @@ void parallelGatherTiles( const ImagePlug *imagePlug, const TileFunctor &tileFun
 	);
 }
 
+} // namespace Detail
+
+template <class TileFunctor, class GatherFunctor>
+void parallelGatherTiles( const ImagePlug *imagePlug, const TileFunctor &tileFunctor, GatherFunctor &&gatherFunctor, const Imath::Box2i &window, TileOrder tileOrder )
+{
+	Detail::parallelGatherTiles( imagePlug, tileFunctor, std::forward<GatherFunctor>( gatherFunctor ), window, tileOrder, nullptr );
+}
+
 template <class TileFunctor, class GatherFunctor>
-void parallelGatherTiles( const ImagePlug *imagePlug, const std::vector<std::string> &channelNames, const TileFunctor &tileFunctor, GatherFunctor &&gatherFunctor, const Imath::Box2i &window, TileOrder tileOrder )
+void parallelGatherTiles( const ImagePlug *imagePlug, const std::vector<std::string> &channelNames, const TileFunctor &tileFunctor, GatherFunctor &&gatherFunctor, const Imath::Box2i &window, TileOrder tileOrder, bool prefetchChannelData )
 {
 	using TileFunctorResult = std::invoke_result_t<TileFunctor, const ImagePlug *, const std::string &, const Imath::V2i &>;
 	using WholeTileResult = std::vector<TileFunctorResult>;
@@ -430,7 +512,7 @@ void parallelGatherTiles( const ImagePlug *imagePlug, const std::vector<std::str
 		}
 	};
 
-	parallelGatherTiles( imagePlug, f, g, window, tileOrder );
+	Detail::parallelGatherTiles( imagePlug, f, g, window, tileOrder, prefetchChannelData ? &channelNames : nullptr );
 }
 
 } // namespace ImageAlgo
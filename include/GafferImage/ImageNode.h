@@ -119,6 +119,9 @@ class GAFFERIMAGE_API ImageNode : public Gaffer::ComputeNode
 		/// Implemented to call the compute*() methods below whenever output is part of an ImagePlug.
 		/// Derived classes should reimplement the specific compute*() methods rather than compute() itself.
 		void compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const override;
+		/// Returns "imageTiles" for `ImagePlug::channelDataPlug()` and
+		/// `ImagePlug::sampleOffsetsPlug()`, and "image" for everything else.
+		IECore::InternedString computeCachePartition( const Gaffer::ValuePlug *output ) const override;
 		/// Compute methods for the individual children of outPlug() - these must be implemented by derived classes, or
 		/// an input connection must be made to the plug, so that the method is not called.
 		virtual IECore::ConstStringVectorDataPtr computeViewNames( const Gaffer::Context *context, const ImagePlug *parent ) const;
@@ -255,6 +255,17 @@ class GAFFERIMAGE_API ImagePlug : public Gaffer::ValuePlug
 		static const IECore::FloatVectorData *emptyTile();
 		static const IECore::FloatVectorData *blackTile();
 		static const IECore::FloatVectorData *whiteTile();
+		/// Returns a tile with every pixel set to `value`. Tiles are shared
+		/// between all callers requesting the same value, so nodes that output
+		/// uniform tiles should use this rather than allocating their own.
+		/// Returns `blackTile()` and `whiteTile()` for 0 and 1 respectively.
+		static IECore::ConstFloatVectorDataPtr constantTile( float value );
+		/// Returns true if `tile` was returned by `constantTile()`, `blackTile()`
+		/// or `whiteTile()`, filling `value` with the value of its pixels. This is
+		/// a constant time test of identity, not of contents, so may return false
+		/// for uniform tiles that were allocated by other means. Nodes may use it
+		/// to process a constant tile as a single pixel.
+		static bool isConstantTile( const IECore::FloatVectorData *tile, float &value );
 
 		static constexpr int tileSize() { return 1 << tileSizeLog2(); };
 		static constexpr int tilePixels() { return tileSize() * tileSize(); };
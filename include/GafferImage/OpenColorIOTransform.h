@@ -77,6 +77,25 @@ class GAFFERIMAGE_API OpenColorIOTransform : public ColorProcessor
 		/// `processor()` in the current context.
 		IECore::MurmurHash processorHash() const;
 
+		/// Determines the trade-off between accuracy and speed when
+		/// processors are prepared for use on the CPU. `Good` and `Draft`
+		/// are lossy, with `Draft` approximating expensive operations
+		/// using lookup tables.
+		enum class Optimization
+		{
+			Lossless,
+			Default,
+			Good,
+			Draft
+		};
+
+		/// Sets the optimisation used by all nodes. Defaults to `Default`,
+		/// unless the `GAFFER_OCIO_OPTIMIZATION` environment variable is set
+		/// to the name of another level. Changing the level clears the hash
+		/// cache, and must not be done while computes are in progress.
+		static void setOptimization( Optimization optimization );
+		static Optimization getOptimization();
+
 	protected :
 
 		explicit OpenColorIOTransform( const std::string &name=defaultName<OpenColorIOTransform>(), bool withContextPlug=false );
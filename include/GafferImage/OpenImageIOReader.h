@@ -92,6 +92,54 @@ class GAFFERIMAGE_API OpenImageIOReader : public ImageNode
 		static void setOpenFilesLimit( size_t maxOpenFiles );
 		static size_t getOpenFilesLimit();
 
+		/// Determines which files are closed when the open files limit is
+		/// reached. The `CostAware` policy keeps files that are slow to open
+		/// (such as those on remote storage) open for longer.
+		static void setOpenFilesEvictionPolicy( Gaffer::ValuePlug::CacheEvictionPolicy policy );
+		static Gaffer::ValuePlug::CacheEvictionPolicy getOpenFilesEvictionPolicy();
+
+		/// Sets the number of dedicated threads used for reading pixel data.
+		/// When non-zero, reads are queued for the I/O threads rather than
+		/// being performed on the TBB worker threads, and reads of adjacent
+		/// regions requested by different computes are coalesced. A compute
+		/// waiting on a read that hasn't started yet performs it itself rather
+		/// than blocking. This is beneficial when reading from network
+		/// filesystems with high latency. Defaults to 0, or the value of the
+		/// `GAFFER_IMAGE_READER_IO_THREADS` environment variable.
+		static void setIOThreads( size_t numThreads );
+		static size_t getIOThreads();
+		/// Returns the number of reads waiting for an I/O thread.
+		static size_t ioQueueDepth();
+		/// Returns the size of the pixel data for all reads that are queued
+		/// or in progress.
+		static size_t ioBytesInFlight();
+
+		/// When enabled, uncompressed single-part OpenEXR files are mapped
+		/// into memory and their pixels copied directly into tiles, bypassing
+		/// OpenImageIO. Files must not be modified while they are mapped.
+		/// Defaults to off, unless the `GAFFER_IMAGE_READER_MEMORY_MAPPING`
+		/// environment variable is set to `1`.
+		static void setMemoryMappingEnabled( bool enabled );
+		static bool getMemoryMappingEnabled();
+
+		/// When enabled, channels stored as half floats in the file are held
+		/// in the tile batch cache as half floats too, and converted to float
+		/// only as each tile is requested. This halves the memory used by the
+		/// reader's own cached tiles, allowing more of the file to be cached.
+		/// The conversion is lossless, but because `channelData` is not cached,
+		/// it is repeated for every access to a tile, with a new float tile
+		/// allocated each time.
+		///
+		/// > Note : Only the reader's tile batch cache is affected. The
+		/// > `channelData` output is always float, so downstream nodes, their
+		/// > cached results, Sampler and ImageWriter all continue to use
+		/// > float tiles, and the memory used by the rest of a comp is
+		/// > unchanged.
+		/// Defaults to off, unless the `GAFFER_IMAGE_READER_HALF_TILES`
+		/// environment variable is set to `1`.
+		static void setHalfTileStorageEnabled( bool enabled );
+		static bool getHalfTileStorageEnabled();
+
 		static size_t supportedExtensions( std::vector<std::string> &extensions );
 
 	protected :
@@ -0,0 +1,115 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Imath/ImathBox.h"
+
+#include "boost/noncopyable.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace GafferImage
+{
+
+namespace Private
+{
+
+/// Provides direct access to the pixels of an uncompressed OpenEXR file,
+/// by mapping the file into memory. This avoids the overhead of reading
+/// via OpenImageIO, and the intermediate buffers that requires. Only
+/// single-part flat images are supported, with half or float channels
+/// that aren't subsampled. Tiled files are supported, but only the
+/// highest resolution level is accessible.
+class MappedEXR : public boost::noncopyable
+{
+
+	public :
+
+		/// Returns null if the file is not a supported EXR or can not be
+		/// mapped, in which case it should be read via OpenImageIO instead.
+		static std::unique_ptr<MappedEXR> create( const std::string &fileName );
+		~MappedEXR();
+
+		/// Channel names in the order they are stored in the file.
+		const std::vector<std::string> &channelNames() const;
+		/// The data window, in EXR coordinates, with inclusive bounds.
+		const Imath::Box2i &dataWindow() const;
+
+		/// Converts the pixels from `xBegin` to `xEnd` (exclusive) of
+		/// scanline `y` to float, writing them into `result`. Coordinates
+		/// are in EXR space, and must be within the data window.
+		/// Throws if the file is corrupt.
+		void readScanline( size_t channelIndex, int y, int xBegin, int xEnd, float *result ) const;
+
+	private :
+
+		MappedEXR( const std::string &fileName, const char *data, size_t size );
+
+		bool parseHeader();
+		const char *chunk( size_t index, size_t headerSize, size_t dataSize ) const;
+
+		const std::string m_fileName;
+		const char *m_data;
+		const size_t m_size;
+
+		struct Channel
+		{
+			std::string name;
+			bool half;
+		};
+		std::vector<Channel> m_channels;
+		std::vector<std::string> m_channelNames;
+		// Offset of each channel within a line of a chunk, in bytes per pixel.
+		std::vector<size_t> m_channelOffsets;
+		size_t m_bytesPerPixel;
+
+		Imath::Box2i m_dataWindow;
+		bool m_tiled;
+		Imath::V2i m_tileSize;
+		int m_numTilesX;
+		// Table of chunk offsets. May not be aligned, so
+		// must be read using `memcpy()`.
+		const char *m_offsets;
+		size_t m_numOffsets;
+
+};
+
+} // namespace Private
+
+} // namespace GafferImage
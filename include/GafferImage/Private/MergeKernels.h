@@ -0,0 +1,76 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "GafferImage/Export.h"
+#include "GafferImage/Merge.h"
+
+#include <vector>
+
+namespace GafferImage
+{
+
+namespace Private
+{
+
+/// The instruction sets for which Merge has span kernels.
+enum class MergeInstructionSet
+{
+	Scalar,
+	SSE42,
+	AVX2,
+	AVX512
+};
+
+/// Returns the instruction sets supported by both the build and the CPU,
+/// starting with `Scalar`. Merge itself always uses the last of these.
+GAFFERIMAGE_API std::vector<MergeInstructionSet> mergeInstructionSets();
+
+/// Applies `operation` to a span of `length` pixels in the same way as
+/// Merge, but using the kernel for the specified instruction set. Either
+/// of `A` and `a` or `B` and `b` may be null, in which case zero is
+/// substituted for that input. Intended for testing only.
+GAFFERIMAGE_API void mergeSpan(
+	Merge::Operation operation, MergeInstructionSet instructionSet,
+	const float *A, const float *B, const float *a, const float *b,
+	float *R, float *r, int length
+);
+
+} // namespace Private
+
+} // namespace GafferImage
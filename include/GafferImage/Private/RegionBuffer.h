@@ -0,0 +1,157 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "GafferImage/BufferAlgo.h"
+#include "GafferImage/Sampler.h"
+
+#include "IECore/Export.h"
+
+IECORE_PUSH_DEFAULT_VISIBILITY
+#include "Imath/ImathBox.h"
+IECORE_POP_DEFAULT_VISIBILITY
+
+#include "OpenImageIO/fmath.h"
+
+#include "boost/noncopyable.hpp"
+
+#include <cassert>
+#include <string>
+#include <vector>
+
+namespace GafferImage
+{
+
+namespace Private
+{
+
+/// Gathers a region of a channel into a single contiguous buffer, applying
+/// a Sampler::BoundingMode to pixels outside the data window. This is
+/// intended for neighbourhood operations which read every input pixel many
+/// times over, allowing them to use simple pointer arithmetic in their inner
+/// loops rather than the per-pixel bounds and tile lookups performed by
+/// `Sampler::sample()`.
+///
+/// The region is filled on construction, by copying whole spans from each
+/// input tile. Input tiles are only held while the rows they contain are
+/// being copied, so the memory required is little more than that of the
+/// buffer itself. But since the buffer always covers the whole region, a
+/// Sampler is the better choice when only sparse lookups are needed
+/// within a large region.
+///
+/// \note Hashing should continue to be performed using `Sampler::hash()`
+/// with the same region and bounding mode.
+class RegionBuffer : public boost::noncopyable
+{
+
+	public :
+
+		RegionBuffer( const GafferImage::ImagePlug *plug, const std::string &channelName, const Imath::Box2i &region, Sampler::BoundingMode boundingMode = Sampler::Black );
+
+		const Imath::Box2i &region() const { return m_region; }
+
+		/// Returns a pointer to the value of the specified pixel, which
+		/// must be within `region()`. Subsequent values in the same row
+		/// follow contiguously.
+		const float *pixel( int x, int y ) const;
+		/// Equivalent to `pixel( region().min.x, y )`.
+		const float *row( int y ) const;
+
+		/// Equivalent to `Sampler::sample( int, int )`.
+		float sample( int x, int y ) const;
+		/// Equivalent to `Sampler::sample( float, float )`. Both of the pixels
+		/// either side of the sample position must be within `region()`.
+		float sample( float x, float y ) const;
+		/// Equivalent to `Sampler::sample( const V2f *, size_t, float * )`.
+		void sample( const Imath::V2f *positions, size_t count, float *result ) const;
+
+		/// Equivalent to `Sampler::visitPixels()`. The signature of the functor
+		/// must be `F( float value, int x, int y )`.
+		template<typename F>
+		void visitPixels( const Imath::Box2i &region, F &&visitor ) const;
+
+	private :
+
+		const Imath::Box2i m_region;
+		const size_t m_width;
+		std::vector<float> m_data;
+
+};
+
+inline const float *RegionBuffer::pixel( int x, int y ) const
+{
+	assert( BufferAlgo::contains( m_region, Imath::V2i( x, y ) ) );
+	return m_data.data() + ( y - m_region.min.y ) * m_width + ( x - m_region.min.x );
+}
+
+inline const float *RegionBuffer::row( int y ) const
+{
+	return pixel( m_region.min.x, y );
+}
+
+inline float RegionBuffer::sample( int x, int y ) const
+{
+	return *pixel( x, y );
+}
+
+inline float RegionBuffer::sample( float x, float y ) const
+{
+	int xi;
+	const float xf = OIIO::floorfrac( x - 0.5, &xi );
+	int yi;
+	const float yf = OIIO::floorfrac( y - 0.5, &yi );
+
+	const float *p = pixel( xi, yi );
+	return OIIO::bilerp( p[0], p[1], p[m_width], p[m_width + 1], xf, yf );
+}
+
+template<typename F>
+void RegionBuffer::visitPixels( const Imath::Box2i &region, F &&visitor ) const
+{
+	for( int y = region.min.y; y < region.max.y; ++y )
+	{
+		const float *p = pixel( region.min.x, y );
+		for( int x = region.min.x; x < region.max.x; ++x )
+		{
+			visitor( *p++, x, y );
+		}
+	}
+}
+
+} // namespace Private
+
+} // namespace GafferImage
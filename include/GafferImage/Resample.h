@@ -124,6 +124,16 @@ class GAFFERIMAGE_API Resample : public ImageProcessor
 		Gaffer::ObjectPlug *deepResampleDataPlug();
 		const Gaffer::ObjectPlug *deepResampleDataPlug() const;
 
+		// Filter weights for the horizontal and vertical passes. These are
+		// evaluated without a channel name, and with the tile origin set to
+		// `( x, 0 )` or `( 0, y )` respectively, so that they are shared by all
+		// channels and all tiles in the same column or row.
+		Gaffer::ObjectPlug *horizontalFilterWeightsPlug();
+		const Gaffer::ObjectPlug *horizontalFilterWeightsPlug() const;
+
+		Gaffer::ObjectPlug *verticalFilterWeightsPlug();
+		const Gaffer::ObjectPlug *verticalFilterWeightsPlug() const;
+
 		static size_t g_firstPlugIndex;
 
 };
@@ -108,6 +108,13 @@ class GAFFERIMAGE_API Sampler
 		/// 0.5, 0.5.
 		float sample( float x, float y );
 
+		/// Equivalent to calling `sample( float, float )` for each of
+		/// the `count` positions, storing the results in `result`. This
+		/// is significantly faster, because positions are processed in
+		/// batches, with the tile lookups for each batch separated from
+		/// the interpolation, which can then be vectorised.
+		void sample( const Imath::V2f *positions, size_t count, float *result );
+
 		/// Call a functor for all pixels in the region.
 		/// Much faster than calling sample(int,int) repeatedly for every pixel in the
 		/// region, up to 5 times faster in practical cases.
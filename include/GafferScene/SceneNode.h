@@ -125,6 +125,9 @@ class GAFFERSCENE_API SceneNode : public Gaffer::ComputeNode
 
 		Gaffer::ValuePlug::CachePolicy hashCachePolicy( const Gaffer::ValuePlug *output ) const override;
 		Gaffer::ValuePlug::CachePolicy computeCachePolicy( const Gaffer::ValuePlug *output ) const override;
+		/// Returns "sceneObjects" for `ScenePlug::objectPlug()`, and "scene"
+		/// for everything else.
+		IECore::InternedString computeCachePartition( const Gaffer::ValuePlug *output ) const override;
 
 		/// Returns `enabledPlug()->getValue()` evaluated in a global context.
 		/// Disabling is handled automatically by the SceneNode and SceneProcessor
@@ -188,6 +188,7 @@ GAFFERTEST_API void testEditableScope();
 GAFFERTEST_API std::tuple<int,int,int,int> countContextHash32Collisions( int contexts, int mode, int seed );
 GAFFERTEST_API void testContextHashPerformance( int numEntries, int entrySize, bool startInitialized );
 GAFFERTEST_API void testContextCopyPerformance( int numEntries, int entrySize );
+GAFFERTEST_API void testEditableScopePerformance( int numEntries, int depth );
 GAFFERTEST_API void testCopyEditableScope();
 GAFFERTEST_API void testContextHashValidation();
 
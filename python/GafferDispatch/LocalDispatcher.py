@@ -39,6 +39,7 @@ import collections
 import datetime
 import enum
 import functools
+import heapq
 import os
 import re
 import signal
@@ -64,6 +65,7 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 		self["executeInBackground"] = Gaffer.BoolPlug( defaultValue = False )
 		self["ignoreScriptLoadErrors"] = Gaffer.BoolPlug( defaultValue = False )
 		self["environmentCommand"] = Gaffer.StringPlug()
+		self["slots"] = Gaffer.IntPlug( defaultValue = 1, minValue = 1 )
 
 		self.__jobPool = jobPool if jobPool else LocalDispatcher.defaultJobPool()
 
@@ -92,6 +94,7 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 			self.__ignoreScriptLoadErrors = dispatcher["ignoreScriptLoadErrors"].getValue()
 			self.__environmentCommand = dispatcher["environmentCommand"].getValue()
 			self.__executeInBackground = dispatcher["executeInBackground"].getValue()
+			self.__slots = dispatcher["slots"].getValue()
 
 			if self.__executeInBackground :
 				application = script.ancestor( Gaffer.ApplicationRoot )
@@ -110,11 +113,15 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 			self.__messagesChangedSignal = Gaffer.Signal1()
 			self.__messageHandler.messagesChangedSignal().connect( Gaffer.WeakMethod( self.__messagesChanged, fallbackResult = None ), scoped = False )
 
+			# Batches in the order they would be executed serially, and
+			# the number of slots each one occupies while executing.
+			self.__batches = []
+			self.__batchSlots = {}
 			self.__initBatchWalk( batch )
 
 			self.__statusChangedSignal = Gaffer.Signal1()
 
-			self.__currentProcess = None
+			self.__currentProcesses = []
 			self.__status = self.Status.Waiting
 			self.__backgroundTask = None
 
@@ -149,29 +156,22 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 			else :
 				return datetime.datetime.now( datetime.timezone.utc ) - self.__startTime
 
+		# When several batches are executing concurrently, returns
+		# the ID of the one that was launched first.
 		def processID( self ) :
 
-			return self.__currentProcess.pid if self.__currentProcess is not None else None
+			processes = list( self.__currentProcesses )
+			return processes[0].pid if processes else None
 
+		# Returns the combined memory usage of all running processes.
 		def memoryUsage( self ) :
 
-			if self.__currentProcess is None :
-				return None
-
-			try :
-				return self.__currentProcess.memory_info().rss
-			except psutil.NoSuchProcess :
-				return None
+			return self.__accumulateProcessUsage( lambda p : p.memory_info().rss )
 
+		# Returns the combined CPU usage of all running processes.
 		def cpuUsage( self ) :
 
-			if self.__currentProcess is None :
-				return None
-
-			try :
-				return self.__currentProcess.cpu_percent()
-			except psutil.NoSuchProcess :
-				return None
+			return self.__accumulateProcessUsage( lambda p : p.cpu_percent() )
 
 		def status( self ) :
 
@@ -216,7 +216,10 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 			with self.__messageHandler :
 				self.__updateStatus( self.Status.Running )
 				try :
-					self.__executeWalk( self.__rootBatch, canceller )
+					if self.__slots > 1 :
+						self.__executeConcurrently( canceller )
+					else :
+						self.__executeSerially( canceller )
 				except IECore.Cancelled :
 					self.__updateStatus( self.Status.Killed )
 				except :
@@ -226,18 +229,108 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 				else :
 					self.__updateStatus( self.Status.Complete )
 
-		def __executeWalk( self, batch, canceller ) :
+		def __executeSerially( self, canceller ) :
+
+			for batch in self.__batches :
+				if self.__requiresExecution( batch ) :
+					self.__executeAndReport( batch, canceller )
+
+		# Executes batches as soon as all their preTasks are complete, running
+		# as many at once as will fit in the available slots. Batches are started
+		# in the same order as they would be executed serially, so a batch
+		# requiring many slots is not starved by smaller batches queued behind it.
+		def __executeConcurrently( self, canceller ) :
+
+			order = { batch : index for index, batch in enumerate( self.__batches ) }
+			numPending = {}
+			postTasks = collections.defaultdict( list )
+			for batch in self.__batches :
+				numPending[batch] = len( batch.preTasks() )
+				for preTask in batch.preTasks() :
+					postTasks[preTask].append( batch )
+
+			ready = [ ( order[b], b ) for b in self.__batches if numPending[b] == 0 ]
+			heapq.heapify( ready )
+
+			condition = threading.Condition()
+			finished = []
+			running = set()
+			freeSlots = self.__slots
+			errors = []
+
+			def worker( batch ) :
+
+				try :
+					with self.__messageHandler :
+						self.__executeAndReport( batch, canceller )
+				except Exception as e :
+					error = e
+				else :
+					error = None
+
+				with condition :
+					finished.append( ( batch, error ) )
+					condition.notify()
+
+			def complete( batch ) :
+
+				for postTask in postTasks[batch] :
+					numPending[postTask] -= 1
+					if numPending[postTask] == 0 :
+						heapq.heappush( ready, ( order[postTask], postTask ) )
+
+			with condition :
+
+				while True :
+
+					while ready and not errors :
+						batch = ready[0][1]
+						if not self.__requiresExecution( batch ) :
+							heapq.heappop( ready )
+							complete( batch )
+							continue
+						slots = min( self.__batchSlots[batch], self.__slots )
+						if slots > freeSlots :
+							break
+						heapq.heappop( ready )
+						freeSlots -= slots
+						running.add( batch )
+						threading.Thread(
+							target = worker, args = [ batch ],
+							name = "localDispatcherBatchExecutor",
+						).start()
+
+					if not running :
+						break
+
+					while not finished :
+						condition.wait()
+
+					for batch, error in finished :
+						running.remove( batch )
+						freeSlots += min( self.__batchSlots[batch], self.__slots )
+						if error is not None :
+							errors.append( error )
+						else :
+							complete( batch )
+
+					del finished[:]
+
+			if errors :
+				# Prefer reporting a genuine failure over the cancellations
+				# it may have caused in concurrent batches.
+				failures = [ e for e in errors if not isinstance( e, IECore.Cancelled ) ]
+				raise failures[0] if failures else errors[0]
+
+		def __requiresExecution( self, batch ) :
 
 			if "localDispatcher:executed" in batch.blindData() :
 				# Visited this batch by another path
-				return
-
-			for upstreamBatch in batch.preTasks() :
-				self.__executeWalk( upstreamBatch, canceller )
+				return False
 
 			if batch.plug() is None :
 				assert( batch is self.__rootBatch )
-				return
+				return False
 
 			if len( batch.frames() ) == 0 :
 				# This case occurs for nodes like TaskList and
@@ -245,7 +338,11 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 				# execute (they have empty hashes). Their batches exist only to
 				# depend on upstream batches, so we don't need to do any work
 				# here.
-				return
+				return False
+
+			return True
+
+		def __executeAndReport( self, batch, canceller ) :
 
 			IECore.Canceller.check( canceller )
 
@@ -329,7 +426,8 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 				shell = os.name == "nt" and self.__environmentCommand, env = env,
 				**platformKW,
 			)
-			self.__currentProcess = psutil.Process( process.pid )
+			currentProcess = psutil.Process( process.pid )
+			self.__currentProcesses.append( currentProcess )
 
 			# Launch a thread to monitor the output stream and feed it into a
 			# our message handler. We must do this on a thread because reading
@@ -363,7 +461,7 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 
 					if canceller is not None and canceller.cancelled() :
 						if os.name == "nt" :
-							for toKill in self.__currentProcess.children( recursive = True ) + [ self.__currentProcess ] :
+							for toKill in currentProcess.children( recursive = True ) + [ currentProcess ] :
 								toKill.kill()
 						else :
 							os.killpg( process.pid, signal.SIGTERM )
@@ -379,7 +477,7 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 
 			finally :
 
-				self.__currentProcess = None
+				self.__currentProcesses.remove( currentProcess )
 				outputHandler.join()
 
 		def __initBatchWalk( self, batch ) :
@@ -389,13 +487,38 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 				return
 
 			nodeName = ""
+			slots = 1
 			if batch.plug() is not None :
-				nodeName = batch.plug().node().relativeName( batch.plug().node().scriptNode() )
+				node = batch.plug().node()
+				nodeName = node.relativeName( node.scriptNode() )
+				slotsPlug = node["dispatcher"].getChild( "local" )
+				if slotsPlug is not None and batch.frames() :
+					# As for `tractor.tags`, slots can not be varied per-frame
+					# within a batch, but we provide the frame anyway.
+					with Gaffer.Context( batch.context() ) as batchContextWithFrame :
+						batchContextWithFrame["frame"] = min( batch.frames() )
+						slots = slotsPlug["slots"].getValue()
 			batch.blindData()["nodeName"] = nodeName
 
 			for upstreamBatch in batch.preTasks() :
 				self.__initBatchWalk( upstreamBatch )
 
+			# Appending after visiting the preTasks gives us the
+			# depth-first order in which batches are executed serially.
+			self.__batches.append( batch )
+			self.__batchSlots[batch] = slots
+
+		def __accumulateProcessUsage( self, f ) :
+
+			result = None
+			for process in list( self.__currentProcesses ) :
+				try :
+					result = ( result or 0 ) + f( process )
+				except psutil.NoSuchProcess :
+					pass
+
+			return result
+
 		def __updateStatus( self, status ) :
 
 			if status == self.__status :
@@ -496,6 +619,15 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 
 		return self.__jobPool
 
+	@staticmethod
+	def _setupPlugs( parentPlug ) :
+
+		if "local" in parentPlug :
+			return
+
+		parentPlug["local"] = Gaffer.Plug()
+		parentPlug["local"]["slots"] = Gaffer.IntPlug( defaultValue = 1, minValue = 1 )
+
 	def _doDispatch( self, batch ) :
 
 		job = LocalDispatcher.Job(
@@ -507,7 +639,7 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 		job._execute()
 
 IECore.registerRunTimeTyped( LocalDispatcher, typeName = "GafferDispatch::LocalDispatcher" )
-GafferDispatch.Dispatcher.registerDispatcher( "Local", LocalDispatcher )
+GafferDispatch.Dispatcher.registerDispatcher( "Local", LocalDispatcher, LocalDispatcher._setupPlugs )
 
 ## \todo Should this be a shared component implemented in C++ in `Messages.h`?
 # It is incredibly similar to the handler in `InteractiveRender.cpp`.
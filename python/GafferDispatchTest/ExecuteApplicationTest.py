@@ -35,6 +35,7 @@
 #
 ##########################################################################
 
+import json
 import os
 import pathlib
 import subprocess
@@ -372,5 +373,79 @@ class ExecuteApplicationTest( GafferTest.TestCase ) :
 		validate( sequence = True )
 		validate( sequence = False )
 
+	def testTraceFile( self ) :
+
+		s = Gaffer.ScriptNode()
+
+		s["write"] = GafferDispatchTest.TextWriter()
+		s["write"]["fileName"].setValue( pathlib.Path( self.__outputFileSeq.fileName ) )
+
+		s["fileName"].setValue( self.__scriptFileName )
+		s.save()
+
+		traceFile = self.temporaryDirectory() / "trace.json"
+		subprocess.check_call( [
+			str( Gaffer.executablePath() ), "execute", str( self.__scriptFileName ),
+			"-frames", "1-3", "-traceFile", str( traceFile )
+		] )
+
+		with open( traceFile ) as f :
+			trace = json.load( f )
+
+		slices = [ e for e in trace["traceEvents"] if e["ph"] == "X" ]
+		self.assertIn(
+			( "write.task", "taskNode:executeSequence" ),
+			{ ( e["name"], e["cat"] ) for e in slices }
+		)
+
+	def testTraceFileErrors( self ) :
+
+		s = Gaffer.ScriptNode()
+
+		s["write"] = GafferDispatchTest.TextWriter()
+		s["write"]["fileName"].setValue( pathlib.Path( self.__outputFileSeq.fileName ) )
+
+		s["fileName"].setValue( self.__scriptFileName )
+		s.save()
+
+		# A trace that can't be written is reported, and fails the execution.
+
+		p = subprocess.Popen(
+			[
+				str( Gaffer.executablePath() ), "execute", str( self.__scriptFileName ),
+				"-traceFile", str( self.temporaryDirectory() / "trace.txt" )
+			],
+			stderr = subprocess.PIPE,
+			universal_newlines = True,
+		)
+		p.wait()
+
+		error = "".join( p.stderr.readlines() )
+		self.assertIn( "writing trace", error )
+		self.assertIn( "Unsupported trace file extension", error )
+		self.assertTrue( p.returncode )
+		self.assertTrue( pathlib.Path( self.__outputFileSeq.fileNameForFrame( 1 ) ).exists() )
+
+		# And it doesn't mask errors from the execution itself. Exclusive
+		# creation fails because the output already exists.
+
+		s["write"]["mode"].setValue( "x" )
+		s.save()
+
+		p = subprocess.Popen(
+			[
+				str( Gaffer.executablePath() ), "execute", str( self.__scriptFileName ),
+				"-traceFile", str( self.temporaryDirectory() / "trace.txt" )
+			],
+			stderr = subprocess.PIPE,
+			universal_newlines = True,
+		)
+		p.wait()
+
+		error = "".join( p.stderr.readlines() )
+		self.assertIn( "executing write", error )
+		self.assertIn( "writing trace", error )
+		self.assertTrue( p.returncode )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -60,6 +60,47 @@ import GafferTest
 import GafferDispatch
 import GafferDispatchTest
 
+# Records the maximum number of tasks executing at once.
+class _ConcurrencyTracker( object ) :
+
+	def __init__( self ) :
+
+		self.__mutex = threading.Lock()
+		self.__running = 0
+		self.maxRunning = 0
+		self.numExecuted = 0
+
+	def execute( self, duration ) :
+
+		with self.__mutex :
+			self.__running += 1
+			self.maxRunning = max( self.maxRunning, self.__running )
+
+		time.sleep( duration )
+
+		with self.__mutex :
+			self.__running -= 1
+			self.numExecuted += 1
+
+class _SleepingTaskNode( GafferDispatch.TaskNode ) :
+
+	def __init__( self, name = "_SleepingTaskNode", tracker = None ) :
+
+		GafferDispatch.TaskNode.__init__( self, name )
+
+		self["duration"] = Gaffer.FloatPlug( defaultValue = 0.25 )
+		self.tracker = tracker
+
+	def execute( self ) :
+
+		self.tracker.execute( self["duration"].getValue() )
+
+	def hash( self, context ) :
+
+		h = GafferDispatch.TaskNode.hash( self, context )
+		self["duration"].hash( h )
+		return h
+
 class LocalDispatcherTest( GafferTest.TestCase ) :
 
 	def tearDown( self ) :
@@ -1292,5 +1333,147 @@ class LocalDispatcherTest( GafferTest.TestCase ) :
 
 		self.assertTrue( fileToCreate.is_file() )
 
+	def testSlots( self ) :
+
+		tracker = _ConcurrencyTracker()
+
+		script = Gaffer.ScriptNode()
+		script["taskList"] = GafferDispatch.TaskList()
+		for i in range( 0, 4 ) :
+			script[f"task{i}"] = _SleepingTaskNode( tracker = tracker )
+			script["taskList"]["preTasks"][i].setInput( script[f"task{i}"]["task"] )
+
+		script["dispatcher"] = self.__createLocalDispatcher()
+		script["dispatcher"]["tasks"][0].setInput( script["taskList"]["task"] )
+
+		# By default, we have only a single slot, so tasks are executed serially.
+
+		self.assertEqual( script["dispatcher"]["slots"].getValue(), 1 )
+		script["dispatcher"]["task"].execute()
+		self.assertEqual( tracker.numExecuted, 4 )
+		self.assertEqual( tracker.maxRunning, 1 )
+
+		# With more slots, independent tasks can execute at the same time.
+
+		tracker.maxRunning = tracker.numExecuted = 0
+		script["dispatcher"]["slots"].setValue( 2 )
+		script["dispatcher"]["task"].execute()
+		self.assertEqual( tracker.numExecuted, 4 )
+		self.assertEqual( tracker.maxRunning, 2 )
+
+		# Tasks occupying multiple slots reduce concurrency.
+
+		tracker.maxRunning = tracker.numExecuted = 0
+		for i in range( 0, 4 ) :
+			script[f"task{i}"]["dispatcher"]["local"]["slots"].setValue( 2 )
+		script["dispatcher"]["task"].execute()
+		self.assertEqual( tracker.numExecuted, 4 )
+		self.assertEqual( tracker.maxRunning, 1 )
+
+		# And tasks requiring more slots than are available execute
+		# on their own rather than blocking forever.
+
+		tracker.maxRunning = tracker.numExecuted = 0
+		script["task0"]["dispatcher"]["local"]["slots"].setValue( 10 )
+		script["dispatcher"]["slots"].setValue( 4 )
+		script["dispatcher"]["task"].execute()
+		self.assertEqual( tracker.numExecuted, 4 )
+		self.assertEqual( tracker.maxRunning, 2 )
+
+		for job in script["dispatcher"].jobPool().jobs() :
+			self.assertEqual( job.status(), GafferDispatch.LocalDispatcher.Job.Status.Complete )
+
+	def testSlotsRespectPreTasks( self ) :
+
+		log = []
+		script = Gaffer.ScriptNode()
+
+		#   a1  a2
+		#    \  /
+		#     b   c
+		#      \ /
+		#       d
+
+		script["a1"] = GafferDispatchTest.LoggingTaskNode( log = log )
+		script["a2"] = GafferDispatchTest.LoggingTaskNode( log = log )
+		script["b"] = GafferDispatchTest.LoggingTaskNode( log = log )
+		script["b"]["preTasks"][0].setInput( script["a1"]["task"] )
+		script["b"]["preTasks"][1].setInput( script["a2"]["task"] )
+		script["c"] = GafferDispatchTest.LoggingTaskNode( log = log )
+		script["d"] = GafferDispatchTest.LoggingTaskNode( log = log )
+		script["d"]["preTasks"][0].setInput( script["b"]["task"] )
+		script["d"]["preTasks"][1].setInput( script["c"]["task"] )
+
+		script["dispatcher"] = self.__createLocalDispatcher()
+		script["dispatcher"]["slots"].setValue( 4 )
+		script["dispatcher"]["tasks"][0].setInput( script["d"]["task"] )
+		script["dispatcher"]["framesMode"].setValue( script["dispatcher"].FramesMode.CustomRange )
+		script["dispatcher"]["frameRange"].setValue( "1-5" )
+		script["dispatcher"]["task"].execute()
+
+		self.assertEqual( len( log ), 25 )
+		index = lambda name, frame : [ ( l.node.getName(), l.context.getFrame() ) for l in log ].index( ( name, frame ) )
+		for frame in range( 1, 6 ) :
+			self.assertLess( index( "a1", frame ), index( "b", frame ) )
+			self.assertLess( index( "a2", frame ), index( "b", frame ) )
+			self.assertLess( index( "b", frame ), index( "d", frame ) )
+			self.assertLess( index( "c", frame ), index( "d", frame ) )
+
+	def testSlotsFailure( self ) :
+
+		tracker = _ConcurrencyTracker()
+
+		script = Gaffer.ScriptNode()
+		script["slow"] = _SleepingTaskNode( tracker = tracker )
+		script["failing"] = GafferDispatchTest.TextWriter()
+		script["failing"]["fileName"].setValue( "" )
+		script["downstream"] = _SleepingTaskNode( tracker = tracker )
+		script["downstream"]["duration"].setValue( 0 )
+		script["downstream"]["preTasks"][0].setInput( script["slow"]["task"] )
+		script["downstream"]["preTasks"][1].setInput( script["failing"]["task"] )
+
+		script["dispatcher"] = self.__createLocalDispatcher()
+		script["dispatcher"]["slots"].setValue( 2 )
+		script["dispatcher"]["tasks"][0].setInput( script["downstream"]["task"] )
+
+		# The failure is reported, but only once the concurrent
+		# task has completed. The downstream task is not executed.
+
+		self.assertRaisesRegex( RuntimeError, "No such file or directory", script["dispatcher"]["task"].execute )
+		self.assertEqual( tracker.numExecuted, 1 )
+		self.assertEqual(
+			script["dispatcher"].jobPool().jobs()[0].status(),
+			GafferDispatch.LocalDispatcher.Job.Status.Failed
+		)
+
+	def testKillConcurrentBackgroundTasks( self ) :
+
+		script = Gaffer.ScriptNode()
+		script["taskList"] = GafferDispatch.TaskList()
+		for i in range( 0, 2 ) :
+			script[f"command{i}"] = GafferDispatch.PythonCommand()
+			script[f"command{i}"]["command"].setValue( f"import time; time.sleep( 10 + {i} )" )
+			script["taskList"]["preTasks"][i].setInput( script[f"command{i}"]["task"] )
+
+		script["dispatcher"] = self.__createLocalDispatcher()
+		script["dispatcher"]["executeInBackground"].setValue( True )
+		script["dispatcher"]["slots"].setValue( 2 )
+		script["dispatcher"]["tasks"][0].setInput( script["taskList"]["task"] )
+
+		script["dispatcher"]["task"].execute()
+		job = script["dispatcher"].jobPool().jobs()[0]
+
+		startTime = time.time()
+		while job.memoryUsage() is None or len( job.messages() ) < 2 :
+			time.sleep( 0.1 )
+			self.assertLess( time.time() - startTime, 10 )
+
+		job.kill()
+		script["dispatcher"].jobPool().waitForAll()
+
+		self.assertEqual( job.status(), GafferDispatch.LocalDispatcher.Job.Status.Killed )
+		self.assertLess( time.time() - startTime, 10 )
+		self.assertIsNone( job.processID() )
+
 if __name__ == "__main__":
 	unittest.main()
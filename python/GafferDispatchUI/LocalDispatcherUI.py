@@ -97,6 +97,56 @@ Gaffer.Metadata.registerNode(
 
 		),
 
+		"slots" : (
+
+			"description",
+			"""
+			The number of slots available for executing tasks concurrently.
+			Tasks are executed as soon as all their upstream tasks are complete,
+			provided that enough slots are free. Each task occupies the number of
+			slots specified by its `dispatcher.local.slots` plug, so expensive tasks
+			can be prevented from oversubscribing the machine. The default of a
+			single slot executes tasks one at a time.
+			""",
+
+		),
+
+	}
+
+)
+
+Gaffer.Metadata.registerNode(
+
+	GafferDispatch.TaskNode,
+
+	plugs = {
+
+		"dispatcher.local" : (
+
+			"description",
+			"""
+			Settings that control how tasks are
+			executed by the LocalDispatcher.
+			""",
+
+			"layout:section", "Local",
+			"plugValueWidget:type", "GafferUI.LayoutPlugValueWidget",
+
+		),
+
+		"dispatcher.local.slots" : (
+
+			"description",
+			"""
+			The number of the LocalDispatcher's slots occupied by this task
+			while it executes. Use this to account for tasks that use many
+			threads or a lot of memory, so that fewer tasks are executed
+			alongside them. Values greater than the dispatcher's total number
+			of slots are clamped, so that the task executes on its own.
+			""",
+
+		),
+
 	}
 
 )
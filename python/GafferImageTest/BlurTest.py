@@ -41,6 +41,7 @@ import pathlib
 import IECore
 
 import Gaffer
+import GafferTest
 import GafferImage
 import GafferImageTest
 import os
@@ -198,5 +199,92 @@ class BlurTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertImagesEqual( finalCrop["out"], expectedReader["out"], maxDifference = 0.00001, ignoreMetadata = True )
 
+	def testFastMethod( self ) :
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( self.imagesPath() / "checker.exr" )
+
+		accurate = GafferImage.Blur()
+		accurate["in"].setInput( reader["out"] )
+		accurate["radius"].setValue( imath.V2f( 20, 12 ) )
+
+		fast = GafferImage.Blur()
+		fast["in"].setInput( reader["out"] )
+		fast["radius"].setInput( accurate["radius"] )
+		fast["boundingMode"].setInput( accurate["boundingMode"] )
+		fast["expandDataWindow"].setInput( accurate["expandDataWindow"] )
+		fast["method"].setValue( GafferImage.Blur.Method.Fast )
+
+		for boundingMode in GafferImage.Sampler.BoundingMode.values.values() :
+			for expandDataWindow in ( False, True ) :
+				with self.subTest( boundingMode = boundingMode, expandDataWindow = expandDataWindow ) :
+					accurate["boundingMode"].setValue( boundingMode )
+					accurate["expandDataWindow"].setValue( expandDataWindow )
+					self.assertImagesEqual( fast["out"], accurate["out"], maxDifference = 0.01 )
+
+	def testFastMethodPassThrough( self ) :
+
+		c = GafferImage.Constant()
+
+		b = GafferImage.Blur()
+		b["in"].setInput( c["out"] )
+		b["radius"].setValue( imath.V2f( 0 ) )
+		b["method"].setValue( GafferImage.Blur.Method.Fast )
+
+		self.assertImageHashesEqual( c["out"], b["out"] )
+
+	def testFastMethodEnergyPreservation( self ) :
+
+		constant = GafferImage.Constant()
+		constant["color"].setValue( imath.Color4f( 1 ) )
+
+		crop = GafferImage.Crop()
+		crop["in"].setInput( constant["out"] )
+		crop["area"].setValue( imath.Box2i( imath.V2i( 100 ), imath.V2i( 101 ) ) )
+		crop["affectDisplayWindow"].setValue( False )
+
+		blur = GafferImage.Blur()
+		blur["in"].setInput( crop["out"] )
+		blur["expandDataWindow"].setValue( True )
+		blur["method"].setValue( GafferImage.Blur.Method.Fast )
+
+		stats = GafferImage.ImageStats()
+		stats["in"].setInput( blur["out"] )
+		stats["area"].setValue( imath.Box2i( imath.V2i( 0 ), imath.V2i( 200 ) ) )
+
+		for radius in ( 1, 5, 20, 50 ) :
+			blur["radius"].setValue( imath.V2f( radius ) )
+			# The box filters have a slightly longer tail than the truncated
+			# gaussian, so a tiny amount of energy falls outside the expanded
+			# data window.
+			self.assertAlmostEqual( stats["average"]["r"].getValue(), 1 / 40000., delta = 0.01 / 40000. )
+
+	def __largeRadiusPerf( self, method ) :
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 1920, 1080 ) )
+
+		blur = GafferImage.Blur()
+		blur["in"].setInput( checker["out"] )
+		blur["radius"].setValue( imath.V2f( 200 ) )
+		blur["method"].setValue( method )
+
+		GafferImageTest.processTiles( checker["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( blur["out"] )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testLargeRadiusAccuratePerformance( self ) :
+
+		self.__largeRadiusPerf( GafferImage.Blur.Method.Accurate )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testLargeRadiusFastPerformance( self ) :
+
+		self.__largeRadiusPerf( GafferImage.Blur.Method.Fast )
+
 if __name__ == "__main__":
 	unittest.main()
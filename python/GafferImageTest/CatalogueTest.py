@@ -1053,6 +1053,125 @@ class CatalogueTest( GafferImageTest.ImageTestCase ) :
 			# made.
 			handler.assertDone()
 
+	def testUnchangedRendersNotRewritten( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["c"] = GafferImage.Catalogue()
+		s["c"]["directory"].setValue( self.temporaryDirectory() / "catalogue" )
+
+		r = GafferImage.ImageReader()
+		r["fileName"].setValue( self.imagesPath() / "checker.exr" )
+
+		self.sendImage( r["out"], s["c"] )
+		self.assertEqual( len( s["c"]["images"] ), 1 )
+		fileName = pathlib.Path( s["c"]["images"][0]["fileName"].getValue() )
+		fileStat = fileName.stat()
+
+		# Rerendering the same image should reuse the existing file
+		# rather than write it again.
+
+		self.sendImage( r["out"], s["c"] )
+		self.assertEqual( len( s["c"]["images"] ), 2 )
+		self.assertEqual( pathlib.Path( s["c"]["images"][1]["fileName"].getValue() ), fileName )
+		self.assertEqual( fileName.stat().st_ino, fileStat.st_ino )
+		self.assertEqual( fileName.stat().st_mtime_ns, fileStat.st_mtime_ns )
+
+		s["c"]["imageIndex"].setValue( 1 )
+		self.assertImagesEqual( s["c"]["out"], r["out"], ignoreMetadata = True )
+
+		# No temporary files should be left behind.
+
+		self.assertEqual( list( fileName.parent.iterdir() ), [ fileName ] )
+
+	def testIncompleteFilesRewritten( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["c"] = GafferImage.Catalogue()
+		s["c"]["directory"].setValue( self.temporaryDirectory() / "catalogue" )
+
+		r = GafferImage.ImageReader()
+		r["fileName"].setValue( self.imagesPath() / "checker.exr" )
+
+		self.sendImage( r["out"], s["c"] )
+		fileName = pathlib.Path( s["c"]["images"][0]["fileName"].getValue() )
+
+		# Simulate a file left behind by an interrupted save.
+
+		with open( fileName, "rb" ) as f :
+			data = f.read()
+		fileName.unlink()
+		with open( fileName, "wb" ) as f :
+			f.write( data[:len(data)//2] )
+
+		# Rerendering the same image must replace the incomplete file
+		# rather than reuse it.
+
+		self.sendImage( r["out"], s["c"] )
+		self.assertEqual( pathlib.Path( s["c"]["images"][1]["fileName"].getValue() ), fileName )
+		self.assertEqual( fileName.stat().st_size, len( data ) )
+
+		r2 = GafferImage.ImageReader()
+		r2["fileName"].setValue( fileName )
+		self.assertImagesEqual( r2["out"], r["out"], ignoreMetadata = True )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testStaleTemporaryFilesRemoved( self ) :
+
+		directory = self.temporaryDirectory() / "catalogue"
+		directory.mkdir()
+
+		staleTemporary = directory / ".abc123.0x7f8a1c2b3d40.exr"
+		freshTemporary = directory / ".def456.0x7f8a1c2b3d50.exr"
+		image = directory / "abc123.exr"
+		hidden = directory / ".hidden.exr"
+		for f in ( staleTemporary, freshTemporary, image, hidden ) :
+			f.touch()
+
+		oldTime = os.path.getmtime( staleTemporary ) - 60 * 60
+		for f in ( staleTemporary, image, hidden ) :
+			os.utime( f, ( oldTime, oldTime ) )
+
+		s = Gaffer.ScriptNode()
+		s["c"] = GafferImage.Catalogue()
+		s["c"]["directory"].setValue( directory )
+
+		self.assertFalse( staleTemporary.exists() )
+		self.assertTrue( freshTemporary.exists() )
+		self.assertTrue( image.exists() )
+		self.assertTrue( hidden.exists() )
+
+	def testRerenderPerformance( self ) :
+
+		# Emulates a lookdev session where an image with many AOVs is
+		# rerendered repeatedly, with only some of the renders changing
+		# the image.
+
+		s = Gaffer.ScriptNode()
+		s["c"] = GafferImage.Catalogue()
+		s["c"]["directory"].setValue( self.temporaryDirectory() / "catalogue" )
+
+		format = GafferImage.Format( 1024, 1024 )
+		channelNames = [ "R", "G", "B", "A" ] + [ "aov{}.{}".format( i // 4, "RGBA"[i%4] ) for i in range( 0, 16 ) ]
+		numValues = format.width() * format.height() * len( channelNames )
+		bucketData = [ IECore.FloatVectorData( [ v ] * numValues ) for v in ( 0.25, 0.5 ) ]
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for i in range( 0, 10 ) :
+				with GafferTest.ParallelAlgoTest.UIThreadCallHandler() as h :
+					driver = GafferImageTest.DisplayTest.Driver(
+						format, format.getDisplayWindow(), channelNames,
+						GafferImage.Catalogue.displayDriverServer().portNumber()
+					)
+					driver.sendInterleavedBucket( format.getDisplayWindow(), bucketData[i//5] )
+					driver.close()
+					# Wait for the save to complete.
+					h.assertCalled()
+					h.assertDone()
+
+		self.assertEqual( len( s["c"]["images"] ), 10 )
+		self.assertEqual( len( list( pathlib.Path( s["c"]["directory"].getValue() ).iterdir() ) ), 2 )
+
 	def testReorder( self ) :
 
 		for newOrder in [
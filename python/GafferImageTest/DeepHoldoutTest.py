@@ -187,5 +187,61 @@ class DeepHoldoutTest( GafferImageTest.ImageTestCase ) :
 		self.assertIn( "__flattened.channelNames", dirtiedPlugs )
 		del cs[:]
 
+	def testIntermediatesNotCached( self ) :
+
+		representativeImage = GafferImage.ImageReader()
+		representativeImage["fileName"].setValue( self.representativeImagePath )
+
+		offset = GafferImage.Offset()
+		offset["in"].setInput( representativeImage["out"] )
+		offset["offset"].setValue( imath.V2i( 20, 10 ) )
+
+		deepMerge = GafferImage.DeepMerge()
+		deepMerge["in"][-1].setInput( representativeImage["out"] )
+		deepMerge["in"][-1].setInput( offset["out"] )
+
+		holdout = GafferImage.DeepHoldout()
+		holdout["in"].setInput( deepMerge["out"] )
+		holdout["holdout"].setInput( offset["out"] )
+
+		dataWindow = holdout["out"].dataWindow()
+		tileSize = GafferImage.ImagePlug.tileSize()
+		firstTileOrigin = GafferImage.ImagePlug.tileOrigin( dataWindow.min() )
+		numTiles = len( range( firstTileOrigin.x, dataWindow.max().x, tileSize ) ) * len( range( firstTileOrigin.y, dataWindow.max().y, tileSize ) )
+
+		Gaffer.ValuePlug.clearCache()
+		with Gaffer.PerformanceMonitor() as monitor :
+			GafferImageTest.processTiles( holdout["out"] )
+
+		# The samples should be sorted and merged only once per tile, even
+		# though all the channels need them.
+		self.assertEqual( monitor.plugStatistics( holdout["__flatten"]["__sampleMapping"] ).computeCount, numTiles )
+		self.assertGreater( monitor.plugStatistics( deepMerge["out"]["channelData"] ).computeCount, 0 )
+
+		# The final results are cached, so we don't need to visit the
+		# intermediates again.
+		with Gaffer.PerformanceMonitor() as monitor :
+			GafferImageTest.processTiles( holdout["out"] )
+
+		self.assertEqual( monitor.plugStatistics( deepMerge["out"]["channelData"] ).computeCount, 0 )
+		self.assertEqual( monitor.plugStatistics( holdout["__flatten"]["__sampleMapping"] ).computeCount, 0 )
+
+		# DeepMerge's output may be read by many downstream nodes, so it
+		# remains cached.
+		for plug in [ deepMerge["out"], holdout["__mergeHoldout"]["out"] ] :
+			GafferImageTest.processTiles( plug )
+			with Gaffer.PerformanceMonitor() as monitor :
+				GafferImageTest.processTiles( plug )
+			self.assertEqual( monitor.plugStatistics( plug["channelData"] ).computeCount, 0 )
+
+		# But DeepHoldout's internal intermediate is not cached.
+		with Gaffer.PerformanceMonitor() as monitor :
+			GafferImageTest.processTiles( holdout["__intermediateIn"] )
+		computeCount = monitor.plugStatistics( holdout["__intermediateIn"]["channelData"] ).computeCount
+		self.assertGreater( computeCount, 0 )
+		with Gaffer.PerformanceMonitor() as monitor :
+			GafferImageTest.processTiles( holdout["__intermediateIn"] )
+		self.assertEqual( monitor.plugStatistics( holdout["__intermediateIn"]["channelData"] ).computeCount, computeCount )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -1027,5 +1027,104 @@ class DeepStateTest( GafferImageTest.ImageTestCase ) :
 
 		self.__assertDeepStateProcessing( deleteChannels["out"], referenceFlatten["out"], [ 0, 0, 0, 10 ], [ 0, 0, 0, 10 ], 100, 0.45 )
 
+	def testSortedMatchesReference( self ) :
+
+		representativeImage = GafferImage.ImageReader()
+		representativeImage["fileName"].setValue( self.representativeImagePath )
+
+		depthGrade = self.__createDepthGrade()
+		depthGrade["in"].setInput( representativeImage["out"] )
+		depthGrade["depthOffset"].setValue( -0.9 )
+
+		# Merging in the same image twice gives us samples with identical depths,
+		# which must stay in their original order.
+		deepMerge = GafferImage.DeepMerge()
+		deepMerge["in"][-1].setInput( representativeImage["out"] )
+		deepMerge["in"][-1].setInput( depthGrade["out"] )
+		deepMerge["in"][-1].setInput( representativeImage["out"] )
+
+		deepState = GafferImage.DeepState()
+		deepState["in"].setInput( deepMerge["out"] )
+		deepState["deepState"].setValue( GafferImage.DeepState.TargetState.Sorted )
+
+		dataWindow = deepMerge["out"].dataWindow()
+		tileSize = GafferImage.ImagePlug.tileSize()
+		firstTileOrigin = GafferImage.ImagePlug.tileOrigin( dataWindow.min() )
+		for y in range( firstTileOrigin.y, dataWindow.max().y, tileSize ) :
+			for x in range( firstTileOrigin.x, dataWindow.max().x, tileSize ) :
+
+				tileOrigin = imath.V2i( x, y )
+				sampleOffsets = deepMerge["out"].sampleOffsets( tileOrigin )
+				self.assertEqual( deepState["out"].sampleOffsets( tileOrigin ), sampleOffsets )
+
+				inputChannels = { c : deepMerge["out"].channelData( c, tileOrigin ) for c in [ "R", "Z", "ZBack" ] }
+				z = inputChannels["Z"]
+				zBack = inputChannels["ZBack"]
+
+				expectedIndices = []
+				prevOffset = 0
+				for offset in sampleOffsets :
+					expectedIndices.extend( sorted( range( prevOffset, offset ), key = lambda i : ( z[i], zBack[i], i ) ) )
+					prevOffset = offset
+
+				for channelName, channelData in inputChannels.items() :
+					self.assertEqual(
+						list( deepState["out"].channelData( channelName, tileOrigin ) ),
+						[ channelData[i] for i in expectedIndices ]
+					)
+
+	def __createPerformanceImage( self ) :
+
+		# Tile copies of the representative image at various depths, so that
+		# each pixel receives samples from several overlapping copies.
+
+		representativeImage = GafferImage.ImageReader()
+		representativeImage["fileName"].setValue( self.representativeImagePath )
+
+		deepMerge = GafferImage.DeepMerge()
+		nodes = [ representativeImage, deepMerge ]
+		for i in range( 64 ) :
+
+			offset = GafferImage.Offset()
+			offset["in"].setInput( representativeImage["out"] )
+			offset["offset"].setValue( imath.V2i( ( i % 8 ) * 75, ( i // 8 ) * 50 ) )
+
+			depthGrade = self.__createDepthGrade()
+			depthGrade["in"].setInput( offset["out"] )
+			depthGrade["depthOffset"].setValue( ( i % 5 ) * 0.3 )
+
+			deepMerge["in"][-1].setInput( depthGrade["out"] )
+			nodes.extend( [ offset, depthGrade ] )
+
+		return nodes
+
+	def __testPerformance( self, targetState ) :
+
+		nodes = self.__createPerformanceImage()
+
+		deepState = GafferImage.DeepState()
+		deepState["in"].setInput( nodes[1]["out"] )
+		deepState["deepState"].setValue( targetState )
+
+		GafferImageTest.processTiles( nodes[1]["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( deepState["out"] )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testSortedPerformance( self ) :
+
+		self.__testPerformance( GafferImage.DeepState.TargetState.Sorted )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testTidyPerformance( self ) :
+
+		self.__testPerformance( GafferImage.DeepState.TargetState.Tidy )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testFlatPerformance( self ) :
+
+		self.__testPerformance( GafferImage.DeepState.TargetState.Flat )
+
 if __name__ == "__main__":
 	unittest.main()
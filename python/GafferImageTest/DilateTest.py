@@ -185,6 +185,31 @@ class DilateTest( GafferImageTest.ImageTestCase ) :
 			# a master
 			self.assertImagesEqual( masterDilateSingleChannel["out"], defaultDilateSingleChannel["out"] )
 
+	def testRadiusIndependentAlgorithms( self ) :
+
+		# Large radii are computed using different algorithms to small radii, and
+		# to the algorithm used to find the pixel offsets for a driver channel.
+		# Check that they all agree.
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( self.imagesPath() / "noisyBlobs.exr" )
+
+		dilate = GafferImage.Dilate()
+		dilate["in"].setInput( reader["out"] )
+
+		drivenDilate = GafferImage.Dilate()
+		drivenDilate["in"].setInput( reader["out"] )
+		drivenDilate["radius"].setInput( dilate["radius"] )
+		drivenDilate["boundingMode"].setInput( dilate["boundingMode"] )
+		drivenDilate["masterChannel"].setValue( "Y" )
+
+		for radius in [ imath.V2i( 1 ), imath.V2i( 3 ), imath.V2i( 4 ), imath.V2i( 1, 40 ), imath.V2i( 12, 5 ), imath.V2i( 0, 7 ), imath.V2i( 30 ) ] :
+			for boundingMode in GafferImage.Sampler.BoundingMode.values.values() :
+				with self.subTest( radius = radius, boundingMode = boundingMode ) :
+					dilate["radius"].setValue( radius )
+					dilate["boundingMode"].setValue( boundingMode )
+					self.assertImagesEqual( dilate["out"], drivenDilate["out"] )
+
 	def writeRefDilateFiltered( self, imageBuf, rad, fileName ):
 		filtered = OpenImageIO.ImageBufAlgo.dilate( imageBuf, 1 + 2 * rad.x, 1 + 2 * rad.y )
 		filtered.write( str( self.temporaryDirectory() / fileName ) )
@@ -398,5 +423,43 @@ class DilateTest( GafferImageTest.ImageTestCase ) :
 		with GafferTest.TestRunner.PerformanceScope() :
 			GafferImageTest.processTiles( dilate["out"] )
 
+	def __radiusPerf( self, radius ) :
+
+		imageReader = GafferImage.ImageReader()
+		imageReader["fileName"].setValue( self.imagesPath() / 'deepMergeReference.exr' )
+
+		GafferImageTest.processTiles( imageReader["out"] )
+
+		dilate = GafferImage.Dilate()
+		dilate["in"].setInput( imageReader["out"] )
+		dilate["radius"].setValue( imath.V2i( radius ) )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( dilate["out"] )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius1( self ) :
+
+		self.__radiusPerf( 1 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius10( self ) :
+
+		self.__radiusPerf( 10 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius30( self ) :
+
+		self.__radiusPerf( 30 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius100( self ) :
+
+		self.__radiusPerf( 100 )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -94,6 +94,13 @@ class DisplayTest( GafferImageTest.ImageTestCase ) :
 					for c in channelData :
 						bucketData.append( c[i] )
 
+			self.sendInterleavedBucket( bucketWindow, bucketData )
+
+		# The bucketData argument is a single FloatVectorData
+		# with the channels interleaved and the rows in EXR order,
+		# as sent by a renderer.
+		def sendInterleavedBucket( self, bucketWindow, bucketData ) :
+
 			with GafferTest.ParallelAlgoTest.UIThreadCallHandler() as h :
 
 				self.__driver.imageData(
@@ -206,6 +213,88 @@ class DisplayTest( GafferImageTest.ImageTestCase ) :
 
 		driver.close()
 
+	def testMultipleChannels( self ) :
+
+		node = GafferImage.Display()
+		server = IECoreImage.DisplayDriverServer()
+		driverCreatedConnection = GafferImage.Display.driverCreatedSignal().connect( lambda driver, parameters : node.setDriver( driver ), scoped = True )
+
+		tileSize = GafferImage.ImagePlug.tileSize()
+		dataWindow = imath.Box2i( imath.V2i( 0 ), imath.V2i( tileSize * 2 ) )
+		channelNames = [ "R", "G", "B", "A", "Z" ]
+		driver = self.Driver(
+			GafferImage.Format( dataWindow ),
+			dataWindow,
+			channelNames,
+			port = server.portNumber(),
+		)
+
+		# Bucket straddles all four tiles.
+		bucketWindow = imath.Box2i( imath.V2i( tileSize // 2 ), imath.V2i( tileSize + tileSize // 2 ) )
+		numPixels = bucketWindow.size().x * bucketWindow.size().y
+		driver.sendBucket(
+			bucketWindow,
+			[ IECore.FloatVectorData( [ i + 1 ] * numPixels ) for i in range( 0, len( channelNames ) ) ]
+		)
+
+		for i, channelName in enumerate( channelNames ) :
+			for tileOrigin in [ imath.V2i( x, y ) for x in ( 0, tileSize ) for y in ( 0, tileSize ) ] :
+				channelData = node["out"].channelData( channelName, tileOrigin )
+				for y in range( tileOrigin.y, tileOrigin.y + tileSize ) :
+					for x in range( tileOrigin.x, tileOrigin.x + tileSize ) :
+						expected = i + 1 if GafferImage.BufferAlgo.contains( bucketWindow, imath.V2i( x, y ) ) else 0
+						self.assertEqual( channelData[(y - tileOrigin.y) * tileSize + x - tileOrigin.x], expected )
+
+		driver.close()
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testStreamingPerformance( self ) :
+
+		# Acts as a stand-in for an interactive render with many AOVs,
+		# streaming buckets to the Display and pulling the updated tiles
+		# after each one, as the Viewer would. This measures the end-to-end
+		# latency of ingesting a bucket, propagating dirtiness and computing
+		# the affected tiles.
+
+		node = GafferImage.Display()
+		server = IECoreImage.DisplayDriverServer()
+		driverCreatedConnection = GafferImage.Display.driverCreatedSignal().connect( lambda driver, parameters : node.setDriver( driver ), scoped = True )
+
+		dataWindow = imath.Box2i( imath.V2i( 0 ), imath.V2i( 1920, 1080 ) )
+		channelNames = [ "R", "G", "B", "A" ] + [ "aov{}.{}".format( i // 3, "RGB"[i%3] ) for i in range( 0, 36 ) ]
+		driver = self.Driver(
+			GafferImage.Format( dataWindow ),
+			dataWindow,
+			channelNames,
+			port = server.portNumber(),
+		)
+
+		# Buckets deliberately don't align with tiles.
+		bucketSize = 48
+		bucketData = {}
+
+		with GafferTest.TestRunner.PerformanceScope() :
+
+			for y in range( 0, dataWindow.max().y, bucketSize ) :
+				for x in range( 0, dataWindow.max().x, bucketSize ) :
+
+					bucketWindow = imath.Box2i( imath.V2i( x, y ), imath.V2i( min( x + bucketSize, dataWindow.max().x ), min( y + bucketSize, dataWindow.max().y ) ) )
+					size = ( bucketWindow.size().x, bucketWindow.size().y )
+					if size not in bucketData :
+						bucketData[size] = IECore.FloatVectorData( [ 0.5 ] * ( size[0] * size[1] * len( channelNames ) ) )
+
+					driver.sendInterleavedBucket( bucketWindow, bucketData[size] )
+
+					minTileOrigin = GafferImage.ImagePlug.tileOrigin( bucketWindow.min() )
+					maxTileOrigin = GafferImage.ImagePlug.tileOrigin( bucketWindow.max() - imath.V2i( 1 ) )
+					for tileY in range( minTileOrigin.y, maxTileOrigin.y + 1, GafferImage.ImagePlug.tileSize() ) :
+						for tileX in range( minTileOrigin.x, maxTileOrigin.x + 1, GafferImage.ImagePlug.tileSize() ) :
+							for channelName in channelNames :
+								node["out"].channelData( channelName, imath.V2i( tileX, tileY ), _copy = False )
+
+		driver.close()
+
 	def testTransferChecker( self ) :
 
 		self.__testTransferImage( self.imagesPath() / "checker.exr" )
@@ -259,5 +259,82 @@ class DisplayTransformTest( GafferImageTest.ImageTestCase ) :
 			GafferImage.OpenColorIOAlgo.setConfig( context, str( configPath ) )
 			self.assertImagesEqual( defaultDisplayTransform["out"], explicitDisplayTransform["out"] )
 
+	def testOptimization( self ) :
+
+		self.addCleanup( GafferImage.OpenColorIOTransform.setOptimization, GafferImage.OpenColorIOTransform.getOptimization() )
+
+		for optimization in GafferImage.OpenColorIOTransform.Optimization.values.values() :
+			GafferImage.OpenColorIOTransform.setOptimization( optimization )
+			self.assertEqual( GafferImage.OpenColorIOTransform.getOptimization(), optimization )
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( self.imageFile )
+
+		displayTransform = GafferImage.DisplayTransform()
+		displayTransform["in"].setInput( reader["out"] )
+		displayTransform["inputColorSpace"].setValue( "scene_linear" )
+		displayTransform["display"].setValue( "sRGB - Display" )
+		displayTransform["view"].setValue( "ACES 1.0 - SDR Video" )
+
+		GafferImage.OpenColorIOTransform.setOptimization( GafferImage.OpenColorIOTransform.Optimization.Default )
+		defaultImage = GafferImage.ImageAlgo.image( displayTransform["out"] )
+		defaultHash = GafferImage.ImageAlgo.imageHash( displayTransform["out"] )
+
+		for optimization, tolerance in [
+			( GafferImage.OpenColorIOTransform.Optimization.Lossless, 0.0001 ),
+			( GafferImage.OpenColorIOTransform.Optimization.Draft, 0.05 ),
+		] :
+
+			with self.subTest( optimization = optimization ) :
+
+				GafferImage.OpenColorIOTransform.setOptimization( optimization )
+				self.assertNotEqual( GafferImage.ImageAlgo.imageHash( displayTransform["out"] ), defaultHash )
+
+				image = GafferImage.ImageAlgo.image( displayTransform["out"] )
+				for channelName in [ "R", "G", "B" ] :
+					for a, b in zip( image[channelName], defaultImage[channelName] ) :
+						self.assertAlmostEqual( a, b, delta = tolerance )
+
+	def __throughputPerfTest( self, threads ) :
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 2048, 2048 ) )
+
+		displayTransform = GafferImage.DisplayTransform()
+		displayTransform["in"].setInput( checker["out"] )
+		displayTransform["inputColorSpace"].setValue( "scene_linear" )
+		displayTransform["display"].setValue( "sRGB - Display" )
+		displayTransform["view"].setValue( "ACES 1.0 - SDR Video" )
+
+		GafferImageTest.processTiles( checker["out"] )
+
+		with IECore.tbb_global_control( IECore.tbb_global_control.parameter.max_allowed_parallelism, threads ) :
+			with GafferTest.TestRunner.PerformanceScope() :
+				GafferImageTest.processTiles( displayTransform["out"] )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 3 )
+	def testThroughput1Thread( self ) :
+
+		self.__throughputPerfTest( 1 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 3 )
+	def testThroughput4Threads( self ) :
+
+		self.__throughputPerfTest( 4 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 3 )
+	def testThroughput16Threads( self ) :
+
+		self.__throughputPerfTest( 16 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 3 )
+	def testThroughput64Threads( self ) :
+
+		self.__throughputPerfTest( 64 )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -141,6 +141,31 @@ class ErodeTest( GafferImageTest.ImageTestCase ) :
 			# a master
 			self.assertImagesEqual( masterErodeSingleChannel["out"], defaultErodeSingleChannel["out"] )
 
+	def testRadiusIndependentAlgorithms( self ) :
+
+		# Large radii are computed using different algorithms to small radii, and
+		# to the algorithm used to find the pixel offsets for a driver channel.
+		# Check that they all agree.
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( self.imagesPath() / "noisyBlobs.exr" )
+
+		erode = GafferImage.Erode()
+		erode["in"].setInput( reader["out"] )
+
+		drivenErode = GafferImage.Erode()
+		drivenErode["in"].setInput( reader["out"] )
+		drivenErode["radius"].setInput( erode["radius"] )
+		drivenErode["boundingMode"].setInput( erode["boundingMode"] )
+		drivenErode["masterChannel"].setValue( "Y" )
+
+		for radius in [ imath.V2i( 1 ), imath.V2i( 3 ), imath.V2i( 4 ), imath.V2i( 1, 40 ), imath.V2i( 12, 5 ), imath.V2i( 0, 7 ), imath.V2i( 30 ) ] :
+			for boundingMode in GafferImage.Sampler.BoundingMode.values.values() :
+				with self.subTest( radius = radius, boundingMode = boundingMode ) :
+					erode["radius"].setValue( radius )
+					erode["boundingMode"].setValue( boundingMode )
+					self.assertImagesEqual( erode["out"], drivenErode["out"] )
+
 	def writeRefErodeFiltered( self, imageBuf, rad, fileName ):
 		filtered = OpenImageIO.ImageBufAlgo.erode( imageBuf, 1 + 2 * rad.x, 1 + 2 * rad.y )
 		filtered.write( str( self.temporaryDirectory() / fileName ) )
@@ -353,5 +378,43 @@ class ErodeTest( GafferImageTest.ImageTestCase ) :
 		with GafferTest.TestRunner.PerformanceScope() :
 			GafferImageTest.processTiles( erode["out"] )
 
+	def __radiusPerf( self, radius ) :
+
+		imageReader = GafferImage.ImageReader()
+		imageReader["fileName"].setValue( self.imagesPath() / 'deepMergeReference.exr' )
+
+		GafferImageTest.processTiles( imageReader["out"] )
+
+		erode = GafferImage.Erode()
+		erode["in"].setInput( imageReader["out"] )
+		erode["radius"].setValue( imath.V2i( radius ) )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( erode["out"] )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius1( self ) :
+
+		self.__radiusPerf( 1 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius10( self ) :
+
+		self.__radiusPerf( 10 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius30( self ) :
+
+		self.__radiusPerf( 30 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius100( self ) :
+
+		self.__radiusPerf( 100 )
+
 if __name__ == "__main__":
 	unittest.main()
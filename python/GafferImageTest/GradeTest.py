@@ -42,6 +42,7 @@ import imath
 import IECore
 
 import Gaffer
+import GafferTest
 import GafferImage
 import GafferImageTest
 
@@ -306,3 +307,208 @@ class GradeTest( GafferImageTest.ImageTestCase ) :
 		defaultGrade["gamma"].setValue( imath.Color4f( 2, 2, 2, 1.0 ) )
 
 		self.assertImagesEqual( unpremultipliedGrade["out"], defaultGrade["out"] )
+
+	def testFusion( self ) :
+
+		self.addCleanup( GafferImage.ChannelDataProcessor.setFusionEnabled, GafferImage.ChannelDataProcessor.getFusionEnabled() )
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( self.imagesPath() / "blurRange.exr" )
+
+		shuffleAlpha = GafferImage.Shuffle()
+		shuffleAlpha["shuffles"].addChild( Gaffer.ShufflePlug( "R", "A" ) )
+		shuffleAlpha["in"].setInput( reader["out"] )
+
+		grade1 = GafferImage.Grade()
+		grade1["in"].setInput( shuffleAlpha["out"] )
+		grade1["channels"].setValue( "[RGBA]" )
+		grade1["multiply"].setValue( imath.Color4f( 1, 0.5, 2, 0.75 ) )
+
+		clamp = GafferImage.Clamp()
+		clamp["in"].setInput( grade1["out"] )
+		clamp["max"].setValue( imath.Color4f( 0.9, 0.8, 0.7, 1 ) )
+
+		disabledGrade = GafferImage.Grade()
+		disabledGrade["in"].setInput( clamp["out"] )
+		disabledGrade["gamma"].setValue( imath.Color4f( 3 ) )
+		disabledGrade["enabled"].setValue( False )
+
+		grade2 = GafferImage.Grade()
+		grade2["in"].setInput( disabledGrade["out"] )
+		grade2["channels"].setValue( "[RG]" )
+		grade2["offset"].setValue( imath.Color4f( 0.1, 0.2, 0.3, 0 ) )
+
+		unpremultipliedGrade = GafferImage.Grade()
+		unpremultipliedGrade["in"].setInput( grade2["out"] )
+		unpremultipliedGrade["channels"].setValue( "[RGBA]" )
+		unpremultipliedGrade["processUnpremultiplied"].setValue( True )
+		unpremultipliedGrade["gamma"].setValue( imath.Color4f( 2, 2, 2, 0.5 ) )
+
+		premultiply = GafferImage.Premultiply()
+		premultiply["in"].setInput( unpremultipliedGrade["out"] )
+
+		# Compare the results of the fused and unfused computes,
+		# clearing the cache in between so that each is computed
+		# from scratch.
+
+		for plug in [ clamp["out"], grade2["out"], unpremultipliedGrade["out"], premultiply["out"] ] :
+
+			GafferImage.ChannelDataProcessor.setFusionEnabled( False )
+			Gaffer.ValuePlug.clearCache()
+			unfused = GafferImage.ImageAlgo.image( plug )
+
+			GafferImage.ChannelDataProcessor.setFusionEnabled( True )
+			Gaffer.ValuePlug.clearCache()
+			fused = GafferImage.ImageAlgo.image( plug )
+
+			self.assertEqual( fused, unfused )
+
+	def testConstantTiles( self ) :
+
+		constant = GafferImage.Constant()
+		constant["format"].setValue( GafferImage.Format( 300, 200 ) )
+		constant["color"].setValue( imath.Color4f( 0.25, 0.5, 2.0, 0.5 ) )
+
+		# Write the constant to file, so that we can compare against
+		# processing of tiles that aren't known to be constant.
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( constant["out"] )
+		writer["fileName"].setValue( self.temporaryDirectory() / "constant.exr" )
+		writer["openexr"]["dataType"].setValue( "float" )
+		writer["task"].execute()
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( writer["fileName"].getValue() )
+
+		def processors( image ) :
+
+			grade = GafferImage.Grade()
+			grade["in"].setInput( image )
+			grade["channels"].setValue( "[RGBA]" )
+			grade["gamma"].setValue( imath.Color4f( 2, 1, 0.5, 1 ) )
+			grade["offset"].setValue( imath.Color4f( 0.1, 0.2, 0.3, 0 ) )
+
+			clamp = GafferImage.Clamp()
+			clamp["in"].setInput( grade["out"] )
+			clamp["max"].setValue( imath.Color4f( 0.9, 0.8, 0.7, 1 ) )
+
+			unpremultiply = GafferImage.Unpremultiply()
+			unpremultiply["in"].setInput( clamp["out"] )
+
+			premultiply = GafferImage.Premultiply()
+			premultiply["in"].setInput( unpremultiply["out"] )
+
+			unpremultipliedGrade = GafferImage.Grade()
+			unpremultipliedGrade["in"].setInput( premultiply["out"] )
+			unpremultipliedGrade["processUnpremultiplied"].setValue( True )
+			unpremultipliedGrade["gamma"].setValue( imath.Color4f( 2 ) )
+
+			return [ grade, clamp, unpremultiply, premultiply, unpremultipliedGrade ]
+
+		constantProcessors = processors( constant["out"] )
+		fileProcessors = processors( reader["out"] )
+
+		for constantProcessor, fileProcessor in zip( constantProcessors, fileProcessors ) :
+			self.assertImagesEqual( constantProcessor["out"], fileProcessor["out"], ignoreMetadata = True )
+
+		# The output remains constant until processing unpremultiplied,
+		# which isn't supported for constant tiles.
+
+		for processor in constantProcessors :
+			self.assertEqual(
+				GafferImage.ImagePlug.isConstantTile( processor["out"].channelData( "R", imath.V2i( 0 ), _copy = False ) ),
+				processor is not constantProcessors[-1]
+			)
+
+	def testFusedComputes( self ) :
+
+		self.addCleanup( GafferImage.ChannelDataProcessor.setFusionEnabled, GafferImage.ChannelDataProcessor.getFusionEnabled() )
+		GafferImage.ChannelDataProcessor.setFusionEnabled( True )
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 256, 256 ) )
+
+		grade1 = GafferImage.Grade()
+		grade1["in"].setInput( checker["out"] )
+		grade1["channels"].setValue( "[RGBA]" )
+		grade1["gain"].setValue( imath.Color4f( 2 ) )
+
+		clamp = GafferImage.Clamp()
+		clamp["in"].setInput( grade1["out"] )
+		clamp["channels"].setValue( "[RGBA]" )
+
+		grade2 = GafferImage.Grade()
+		grade2["in"].setInput( clamp["out"] )
+		grade2["channels"].setValue( "[RGBA]" )
+		grade2["offset"].setValue( imath.Color4f( 0.1 ) )
+
+		numTiles = ( 256 // GafferImage.ImagePlug.tileSize() ) ** 2
+
+		# Each node in the chain should still be reported as computing,
+		# so that monitors can attribute the work correctly.
+
+		Gaffer.ValuePlug.clearCache()
+		with Gaffer.PerformanceMonitor() as monitor :
+			GafferImageTest.processTiles( grade2["out"] )
+
+		self.assertEqual( monitor.plugStatistics( grade2["out"]["channelData"] ).computeCount, numTiles * 4 )
+		self.assertEqual( monitor.plugStatistics( clamp["out"]["channelData"] ).computeCount, numTiles * 4 )
+		self.assertEqual( monitor.plugStatistics( grade1["out"]["channelData"] ).computeCount, numTiles * 4 )
+
+		# But only the result of the last node should be cached.
+
+		with Gaffer.PerformanceMonitor() as monitor :
+			GafferImageTest.processTiles( grade2["out"] )
+			GafferImageTest.processTiles( clamp["out"] )
+
+		self.assertEqual( monitor.plugStatistics( grade2["out"]["channelData"] ).computeCount, 0 )
+		self.assertEqual( monitor.plugStatistics( clamp["out"]["channelData"] ).computeCount, numTiles * 4 )
+
+		# But if an intermediate result is needed elsewhere, then
+		# the chain must be split so it can be cached.
+
+		grade3 = GafferImage.Grade()
+		grade3["in"].setInput( clamp["out"] )
+
+		Gaffer.ValuePlug.clearCache()
+		with Gaffer.PerformanceMonitor() as monitor :
+			GafferImageTest.processTiles( grade2["out"] )
+
+		self.assertEqual( monitor.plugStatistics( grade2["out"]["channelData"] ).computeCount, numTiles * 4 )
+		self.assertEqual( monitor.plugStatistics( clamp["out"]["channelData"] ).computeCount, numTiles * 4 )
+		self.assertEqual( monitor.plugStatistics( grade1["out"]["channelData"] ).computeCount, 0 )
+
+	def testFusedErrors( self ) :
+
+		self.addCleanup( GafferImage.ChannelDataProcessor.setFusionEnabled, GafferImage.ChannelDataProcessor.getFusionEnabled() )
+		GafferImage.ChannelDataProcessor.setFusionEnabled( True )
+
+		script = Gaffer.ScriptNode()
+
+		script["checker"] = GafferImage.Checkerboard()
+
+		script["clamp"] = GafferImage.Clamp()
+		script["clamp"]["in"].setInput( script["checker"]["out"] )
+
+		script["grade"] = GafferImage.Grade()
+		script["grade"]["in"].setInput( script["clamp"]["out"] )
+		script["grade"]["gain"].setValue( imath.Color4f( 2 ) )
+
+		# Only error when computing, not when hashing.
+		script["expression"] = Gaffer.Expression()
+		script["expression"].setExpression( 'parent["clamp"]["min"]["r"] = 1 / 0' )
+
+		# The error should be reported by the node whose processing
+		# failed, even though it was performed by the end of the chain.
+
+		clampErrors = GafferTest.CapturingSlot( script["clamp"].errorSignal() )
+		gradeErrors = GafferTest.CapturingSlot( script["grade"].errorSignal() )
+
+		with self.assertRaisesRegex( Gaffer.ProcessException, "division by zero" ) :
+			script["grade"]["out"].channelData( "R", imath.V2i( 0 ) )
+
+		self.assertEqual( len( clampErrors ), 1 )
+		self.assertTrue( clampErrors[0][0].isSame( script["clamp"]["out"]["channelData"] ) )
+		self.assertEqual( len( gradeErrors ), 1 )
+		self.assertTrue( gradeErrors[0][0].isSame( script["grade"]["out"]["channelData"] ) )
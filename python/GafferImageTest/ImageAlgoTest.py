@@ -275,6 +275,79 @@ class ImageAlgoTest( GafferImageTest.ImageTestCase ) :
 			numTilesX * numTilesY * 4
 		)
 
+	def testTilePrefetchRows( self ) :
+
+		self.addCleanup( GafferImage.ImageAlgo.setTilePrefetchRows, GafferImage.ImageAlgo.getTilePrefetchRows() )
+
+		GafferImage.ImageAlgo.setTilePrefetchRows( 3 )
+		self.assertEqual( GafferImage.ImageAlgo.getTilePrefetchRows(), 3 )
+
+		GafferImage.ImageAlgo.setTilePrefetchRows( 0 )
+		self.assertEqual( GafferImage.ImageAlgo.getTilePrefetchRows(), 0 )
+
+		GafferImage.ImageAlgo.setTilePrefetchRows( -1 )
+		self.assertEqual( GafferImage.ImageAlgo.getTilePrefetchRows(), 0 )
+
+	def testTilePrefetch( self ) :
+
+		self.addCleanup( GafferImage.ImageAlgo.setTilePrefetchRows, GafferImage.ImageAlgo.getTilePrefetchRows() )
+
+		checkerboard = GafferImage.Checkerboard()
+		checkerboard["format"].setValue( GafferImage.Format( 1000, 700 ) )
+
+		def computeTile( image, channelName, tileOrigin ) :
+
+			return image["channelData"].getValue()
+
+		def gather( image, channelName, tileOrigin, tile ) :
+
+			results.append( ( channelName, tileOrigin, tile ) )
+
+		numTiles = ( ( 1000 - 1 ) // GafferImage.ImagePlug.tileSize() + 1 ) * ( ( 700 - 1 ) // GafferImage.ImagePlug.tileSize() + 1 )
+
+		expected = {}
+		for rows in ( 0, 1, 4, 100 ) :
+
+			for order in GafferImage.ImageAlgo.TileOrder.TopToBottom, GafferImage.ImageAlgo.TileOrder.BottomToTop :
+
+				GafferImage.ImageAlgo.setTilePrefetchRows( rows )
+				Gaffer.ValuePlug.clearCache()
+				Gaffer.ValuePlug.clearHashCache()
+
+				# Prefetching must not affect the results, or the order they
+				# are delivered in. The number of computes depends on timing
+				# and cache behaviour, so we only check that every tile was
+				# computed.
+
+				results = []
+				with Gaffer.PerformanceMonitor() as monitor :
+					GafferImage.ImageAlgo.parallelGatherTiles(
+						checkerboard["out"], [ "R", "G", "B", "A" ], computeTile, gather, tileOrder = order,
+						prefetchChannelData = True
+					)
+
+				self.assertGreaterEqual( monitor.plugStatistics( checkerboard["out"]["channelData"] ).computeCount, numTiles * 4 )
+
+				if order in expected :
+					self.assertEqual( results, expected[order] )
+				else :
+					expected[order] = results
+
+	def testNoPrefetchByDefault( self ) :
+
+		self.addCleanup( GafferImage.ImageAlgo.setTilePrefetchRows, GafferImage.ImageAlgo.getTilePrefetchRows() )
+		GafferImage.ImageAlgo.setTilePrefetchRows( 4 )
+
+		checkerboard = GafferImage.Checkerboard()
+		checkerboard["format"].setValue( GafferImage.Format( 1000, 700 ) )
+
+		# Hashing an image must not compute any channel data.
+
+		with Gaffer.PerformanceMonitor() as monitor :
+			GafferImage.ImageAlgo.imageHash( checkerboard["out"] )
+
+		self.assertEqual( monitor.plugStatistics( checkerboard["out"]["channelData"] ).computeCount, 0 )
+
 	def testSortedChannelNames( self ):
 
 		# Sort RGBA
@@ -35,6 +35,7 @@
 ##########################################################################
 
 import inspect
+import subprocess
 import unittest
 import threading
 import imath
@@ -156,5 +157,32 @@ class ImageNodeTest( GafferImageTest.ImageTestCase ) :
 
 		Gaffer.ValuePlug.setCacheMemoryLimit( self.__previousCacheMemoryLimit )
 
+	def testCachePartitions( self ) :
+
+		# Partitions can't be removed once created, so we test in a
+		# subprocess to avoid affecting the other tests.
+		subprocess.check_call( [
+			str( Gaffer.executablePath() ), "env", "python", "-c",
+			"import GafferImageTest; GafferImageTest.ImageNodeTest._cachePartitions()"
+		] )
+
+	@staticmethod
+	def _cachePartitions() :
+
+		for partition in ( "image", "imageTiles" ) :
+			Gaffer.ValuePlug.setCachePartitionMemoryLimit( partition, 1024 * 1024 * 1024 )
+
+		checkerboard = GafferImage.Checkerboard()
+
+		checkerboard["out"].channelData( "R", imath.V2i( 0 ) )
+		tilesUsage = Gaffer.ValuePlug.cachePartitionMemoryUsage( "imageTiles" )
+		assert( tilesUsage > 0 )
+
+		checkerboard["out"].format()
+		checkerboard["out"].dataWindow()
+		checkerboard["out"].channelNames()
+		assert( Gaffer.ValuePlug.cachePartitionMemoryUsage( "image" ) > 0 )
+		assert( Gaffer.ValuePlug.cachePartitionMemoryUsage( "imageTiles" ) == tilesUsage )
+
 if __name__ == "__main__":
 	unittest.main()
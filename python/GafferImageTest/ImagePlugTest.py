@@ -248,6 +248,29 @@ class ImagePlugTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertTrue( tileDataNoCopyA.isSame( tileDataNoCopyB ) )
 
+	def testConstantTile( self ) :
+
+		ts = GafferImage.ImagePlug.tileSize()
+		tileDataCopiedA = GafferImage.ImagePlug.constantTile( 0.5 )
+		tileDataCopiedB = GafferImage.ImagePlug.constantTile( 0.5 )
+		self.__testTileData( tileDataCopiedA, ts*ts, value = 0.5 )
+
+		self.assertFalse( tileDataCopiedA.isSame( tileDataCopiedB ) )
+		self.assertFalse( GafferImage.ImagePlug.isConstantTile( tileDataCopiedA ) )
+
+		tileDataNoCopyA = GafferImage.ImagePlug.constantTile( 0.5, _copy = False )
+		tileDataNoCopyB = GafferImage.ImagePlug.constantTile( 0.5, _copy = False )
+		self.__testTileData( tileDataNoCopyA, ts*ts, value = 0.5 )
+
+		self.assertTrue( tileDataNoCopyA.isSame( tileDataNoCopyB ) )
+		self.assertTrue( GafferImage.ImagePlug.isConstantTile( tileDataNoCopyA ) )
+
+		self.assertTrue( GafferImage.ImagePlug.constantTile( 0, _copy = False ).isSame( GafferImage.ImagePlug.blackTile( _copy = False ) ) )
+		self.assertTrue( GafferImage.ImagePlug.constantTile( 1, _copy = False ).isSame( GafferImage.ImagePlug.whiteTile( _copy = False ) ) )
+		self.assertTrue( GafferImage.ImagePlug.isConstantTile( GafferImage.ImagePlug.blackTile( _copy = False ) ) )
+		self.assertTrue( GafferImage.ImagePlug.isConstantTile( GafferImage.ImagePlug.whiteTile( _copy = False ) ) )
+		self.assertFalse( GafferImage.ImagePlug.isConstantTile( GafferImage.ImagePlug.emptyTile( _copy = False ) ) )
+
 	def testEmptyTile( self ) :
 
 		tileDataCopiedA = GafferImage.ImagePlug.emptyTile()
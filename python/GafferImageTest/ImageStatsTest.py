@@ -360,6 +360,32 @@ class ImageStatsTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertEqual( pm.plugStatistics( stats["__allStats" ] ).computeCount, 1 )
 
+	def testConstantTiles( self ) :
+
+		constant = GafferImage.Constant()
+		constant["format"].setValue( GafferImage.Format( 300, 200 ) )
+		constant["color"].setValue( imath.Color4f( 0.1, 0.2, 0.3, 0.4 ) )
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( constant["out"] )
+		writer["fileName"].setValue( self.temporaryDirectory() / "constant.exr" )
+		writer["openexr"]["dataType"].setValue( "float" )
+		writer["task"].execute()
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( writer["fileName"].getValue() )
+
+		constantStats = GafferImage.ImageStats()
+		constantStats["in"].setInput( constant["out"] )
+		constantStats["area"].setValue( imath.Box2i( imath.V2i( 10, 20 ), imath.V2i( 290, 190 ) ) )
+
+		fileStats = GafferImage.ImageStats()
+		fileStats["in"].setInput( reader["out"] )
+		fileStats["area"].setInput( constantStats["area"] )
+
+		for plugName in [ "average", "min", "max" ] :
+			self.assertEqual( constantStats[plugName].getValue(), fileStats[plugName].getValue() )
+
 	def testInf( self ) :
 
 		# Make an image with all `inf` values. We can't do this directly
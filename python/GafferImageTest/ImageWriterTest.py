@@ -1962,5 +1962,108 @@ class ImageWriterTest( GafferImageTest.ImageTestCase ) :
 		imageReader["fileName"].setValue( self.temporaryDirectory() / "test.exr" )
 		self.assertNotIn( "fileValid", imageReader["out"].metadata() )
 
+	def __runPrefetchPerformanceTest( self, prefetchRows ) :
+
+		self.addCleanup( GafferImage.ImageAlgo.setTilePrefetchRows, GafferImage.ImageAlgo.getTilePrefetchRows() )
+
+		# Make a large source image, so that the reads are
+		# significant relative to the processing.
+
+		sourceReader = GafferImage.ImageReader()
+		sourceReader["fileName"].setValue( self.imagesPath() / "dotGrid.warped.exr" )
+
+		sourceResize = GafferImage.Resize()
+		sourceResize["in"].setInput( sourceReader["out"] )
+		sourceResize["format"]["displayWindow"].setValue( imath.Box2i( imath.V2i( 0 ), imath.V2i( 8192 ) ) )
+
+		sourceWriter = GafferImage.ImageWriter()
+		sourceWriter["in"].setInput( sourceResize["out"] )
+		sourceWriter["fileName"].setValue( self.temporaryDirectory() / "source.exr" )
+		sourceWriter["task"].execute()
+
+		# Read -> Grade -> Resize -> Write
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( sourceWriter["fileName"].getValue() )
+
+		grade = GafferImage.Grade()
+		grade["in"].setInput( reader["out"] )
+		grade["gain"].setValue( imath.Color4f( 0.5, 0.75, 1.5, 1 ) )
+
+		resize = GafferImage.Resize()
+		resize["in"].setInput( grade["out"] )
+		resize["format"]["displayWindow"].setValue( imath.Box2i( imath.V2i( 0 ), imath.V2i( 4096 ) ) )
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( resize["out"] )
+		writer["fileName"].setValue( self.temporaryDirectory() / "test.exr" )
+
+		GafferImage.ImageAlgo.setTilePrefetchRows( prefetchRows )
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.clearHashCache()
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			writer["task"].execute()
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPrefetchPerformance( self ) :
+
+		self.__runPrefetchPerformanceTest( prefetchRows = 1 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testNoPrefetchPerformance( self ) :
+
+		self.__runPrefetchPerformanceTest( prefetchRows = 0 )
+
+	def __runCompressionPerformanceTest( self, compression ) :
+
+		# A 4K image with 40 channels, computed up front so that we
+		# measure only the cost of writing.
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( self.imagesPath() / "dotGrid.warped.exr" )
+
+		resize = GafferImage.Resize()
+		resize["in"].setInput( reader["out"] )
+		resize["format"].setValue( GafferImage.Format( 4096, 2160 ) )
+
+		shuffle = GafferImage.Shuffle()
+		shuffle["in"].setInput( resize["out"] )
+		for i in range( 37 ) :
+			shuffle["shuffles"].addChild( Gaffer.ShufflePlug( "RGB"[i%3], "aov{}.{}".format( i // 3, "RGB"[i%3] ) ) )
+
+		self.assertEqual( len( shuffle["out"].channelNames() ), 40 )
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( shuffle["out"] )
+		writer["fileName"].setValue( self.temporaryDirectory() / "test.exr" )
+		writer["openexr"]["mode"].setValue( GafferImage.ImageWriter.Mode.Tile )
+		writer["openexr"]["compression"].setValue( compression )
+
+		GafferImageTest.processTiles( shuffle["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			writer["task"].execute()
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testDWAACompressionPerformance( self ) :
+
+		self.__runCompressionPerformanceTest( "dwaa" )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testZIPCompressionPerformance( self ) :
+
+		self.__runCompressionPerformanceTest( "zip" )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPIZCompressionPerformance( self ) :
+
+		self.__runCompressionPerformanceTest( "piz" )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -174,6 +174,31 @@ class MedianTest( GafferImageTest.ImageTestCase ) :
 		bt.cancelAndWait()
 		self.assertLess( time.time() - t, acceptableCancellationDelay )
 
+	def testRadiusIndependentAlgorithms( self ) :
+
+		# Large radii are computed using different algorithms to small radii, and
+		# to the algorithm used to find the pixel offsets for a driver channel.
+		# Check that they all agree.
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( self.imagesPath() / "noisyBlobs.exr" )
+
+		median = GafferImage.Median()
+		median["in"].setInput( reader["out"] )
+
+		drivenMedian = GafferImage.Median()
+		drivenMedian["in"].setInput( reader["out"] )
+		drivenMedian["radius"].setInput( median["radius"] )
+		drivenMedian["boundingMode"].setInput( median["boundingMode"] )
+		drivenMedian["masterChannel"].setValue( "Y" )
+
+		for radius in [ imath.V2i( 1 ), imath.V2i( 3 ), imath.V2i( 4 ), imath.V2i( 1, 40 ), imath.V2i( 12, 5 ), imath.V2i( 0, 7 ), imath.V2i( 30 ) ] :
+			for boundingMode in GafferImage.Sampler.BoundingMode.values.values() :
+				with self.subTest( radius = radius, boundingMode = boundingMode ) :
+					median["radius"].setValue( radius )
+					median["boundingMode"].setValue( boundingMode )
+					self.assertImagesEqual( median["out"], drivenMedian["out"] )
+
 	def writeRefMedianFiltered( self, imageBuf, rad, fileName ):
 		# OIIO has a different edge behaviour to us - they reduce the size of the filter region
 		# as they get closer to the edge. In order to get matching behaviour, pad out the image
@@ -377,5 +402,49 @@ class MedianTest( GafferImageTest.ImageTestCase ) :
 		with GafferTest.TestRunner.PerformanceScope() :
 			GafferImageTest.processTiles( median["out"] )
 
+	def __radiusPerf( self, radius ) :
+
+		imageReader = GafferImage.ImageReader()
+		imageReader["fileName"].setValue( self.imagesPath() / 'deepMergeReference.exr' )
+
+		GafferImageTest.processTiles( imageReader["out"] )
+
+		median = GafferImage.Median()
+		median["in"].setInput( imageReader["out"] )
+		median["radius"].setValue( imath.V2i( radius ) )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( median["out"] )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius1( self ) :
+
+		self.__radiusPerf( 1 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius4( self ) :
+
+		self.__radiusPerf( 4 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius10( self ) :
+
+		self.__radiusPerf( 10 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius30( self ) :
+
+		self.__radiusPerf( 30 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius100( self ) :
+
+		self.__radiusPerf( 100 )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -923,6 +923,13 @@ class MergeTest( GafferImageTest.ImageTestCase ) :
 		merge["in"][0].setInput( c1["out"] )
 		self.assertImagesEqual( merge["out"], c1["out"] )
 
+	def testKernels( self ) :
+
+		# Compares the SIMD kernels for every instruction set supported by
+		# this CPU against the scalar implementation, for every operation,
+		# over NaNs, infinities, signed zeroes and partial spans.
+		GafferImageTest.testMergeKernels()
+
 	def mergePerf( self, operation, mismatch ):
 		r = GafferImage.Checkerboard( "Checkerboard" )
 		r["format"].setValue( GafferImage.Format( 4096, 3112, 1.000 ) )
@@ -1115,5 +1122,155 @@ class MergeTest( GafferImageTest.ImageTestCase ) :
 	def testMaxMismatchPerf( self ):
 		self.mergePerf( GafferImage.Merge.Operation.Max, True )
 
+	def testConstantTiles( self ) :
+
+		constantB = GafferImage.Constant()
+		constantB["format"].setValue( GafferImage.Format( 300, 200 ) )
+		constantB["color"].setValue( imath.Color4f( 0.25, 0.5, 2.0, 0.75 ) )
+
+		constantA = GafferImage.Constant()
+		constantA["format"].setValue( GafferImage.Format( 300, 200 ) )
+		constantA["color"].setValue( imath.Color4f( 0.1, 0.8, -1.0, 0.5 ) )
+
+		# Write the constants to file, so that we can compare against
+		# a merge of tiles that aren't known to be constant.
+
+		readers = []
+		for constant in [ constantB, constantA ] :
+
+			writer = GafferImage.ImageWriter()
+			writer["in"].setInput( constant["out"] )
+			writer["fileName"].setValue( self.temporaryDirectory() / "{}.exr".format( len( readers ) ) )
+			writer["openexr"]["dataType"].setValue( "float" )
+			writer["task"].execute()
+
+			reader = GafferImage.ImageReader()
+			reader["fileName"].setValue( writer["fileName"].getValue() )
+			readers.append( reader )
+
+		constantMerge = GafferImage.Merge()
+		constantMerge["in"][0].setInput( constantB["out"] )
+		constantMerge["in"][1].setInput( constantA["out"] )
+
+		fileMerge = GafferImage.Merge()
+		fileMerge["in"][0].setInput( readers[0]["out"] )
+		fileMerge["in"][1].setInput( readers[1]["out"] )
+
+		for operation in GafferImage.Merge.Operation.values.values() :
+
+			with self.subTest( operation = operation ) :
+
+				constantMerge["operation"].setValue( operation )
+				fileMerge["operation"].setValue( operation )
+
+				self.assertImagesEqual( constantMerge["out"], fileMerge["out"], ignoreMetadata = True )
+
+				for channelName in [ "R", "G", "B", "A" ] :
+					self.assertTrue(
+						GafferImage.ImagePlug.isConstantTile(
+							constantMerge["out"].channelData( channelName, imath.V2i( 0 ), _copy = False )
+						)
+					)
+
+	def manyLayersPerf( self, operation ) :
+
+		# Merges 50 UHD layers, alternating between a layer which is aligned
+		# with the tile grid and one that is not, so that both whole tiles and
+		# the partial tile regions at the edges of the data windows are exercised.
+
+		checkerboard = GafferImage.Checkerboard()
+		checkerboard["format"].setValue( GafferImage.Format( 3840, 2160, 1.000 ) )
+		checkerboard["size"].setValue( imath.V2f( 64.01 ) )
+
+		alphaShuffle = GafferImage.Shuffle()
+		alphaShuffle["in"].setInput( checkerboard["out"] )
+		alphaShuffle["shuffles"].addChild( Gaffer.ShufflePlug( "R", "A" ) )
+
+		offset = GafferImage.Offset()
+		offset["in"].setInput( alphaShuffle["out"] )
+		offset["offset"].setValue( imath.V2i( 37, 21 ) )
+
+		merge = GafferImage.Merge()
+		merge["operation"].setValue( operation )
+		for i in range( 0, 50 ) :
+			merge["in"][i].setInput( offset["out"] if i % 2 else alphaShuffle["out"] )
+
+		# Precache upstream network, we're only interested in the performance of Merge
+		GafferImageTest.processTiles( alphaShuffle["out"] )
+		GafferImageTest.processTiles( offset["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( merge["out"] )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 3 )
+	def testAddManyLayersPerf( self ) :
+		self.manyLayersPerf( GafferImage.Merge.Operation.Add )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 3 )
+	def testAtopManyLayersPerf( self ) :
+		self.manyLayersPerf( GafferImage.Merge.Operation.Atop )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 3 )
+	def testDivideManyLayersPerf( self ) :
+		self.manyLayersPerf( GafferImage.Merge.Operation.Divide )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 3 )
+	def testInManyLayersPerf( self ) :
+		self.manyLayersPerf( GafferImage.Merge.Operation.In )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 3 )
+	def testOutManyLayersPerf( self ) :
+		self.manyLayersPerf( GafferImage.Merge.Operation.Out )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 3 )
+	def testMaskManyLayersPerf( self ) :
+		self.manyLayersPerf( GafferImage.Merge.Operation.Mask )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 3 )
+	def testMatteManyLayersPerf( self ) :
+		self.manyLayersPerf( GafferImage.Merge.Operation.Matte )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 3 )
+	def testMultiplyManyLayersPerf( self ) :
+		self.manyLayersPerf( GafferImage.Merge.Operation.Multiply )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 3 )
+	def testOverManyLayersPerf( self ) :
+		self.manyLayersPerf( GafferImage.Merge.Operation.Over )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 3 )
+	def testSubtractManyLayersPerf( self ) :
+		self.manyLayersPerf( GafferImage.Merge.Operation.Subtract )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 3 )
+	def testDifferenceManyLayersPerf( self ) :
+		self.manyLayersPerf( GafferImage.Merge.Operation.Difference )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 3 )
+	def testUnderManyLayersPerf( self ) :
+		self.manyLayersPerf( GafferImage.Merge.Operation.Under )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 3 )
+	def testMinManyLayersPerf( self ) :
+		self.manyLayersPerf( GafferImage.Merge.Operation.Min )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 3 )
+	def testMaxManyLayersPerf( self ) :
+		self.manyLayersPerf( GafferImage.Merge.Operation.Max )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -738,6 +738,195 @@ class OpenImageIOReaderTest( GafferImageTest.ImageTestCase ) :
 		finally :
 			GafferImage.OpenImageIOReader.setOpenFilesLimit( l )
 
+	def testIOThreads( self ) :
+
+		self.addCleanup( GafferImage.OpenImageIOReader.setIOThreads, GafferImage.OpenImageIOReader.getIOThreads() )
+
+		GafferImage.OpenImageIOReader.setIOThreads( 2 )
+		self.assertEqual( GafferImage.OpenImageIOReader.getIOThreads(), 2 )
+
+		# Write scanline and tiled versions of a test image, so we exercise
+		# the queueing of both scanline and tile reads.
+
+		reader = GafferImage.OpenImageIOReader()
+		reader["fileName"].setValue( self.dotGridWarpedFileName )
+
+		fileNames = [ self.fileName, self.offsetDataWindowFileName, self.imagesPath() / "multipart.exr" ]
+		for mode, compression in [
+			( GafferImage.ImageWriter.Mode.Scanline, "zips" ),
+			( GafferImage.ImageWriter.Mode.Scanline, "zip" ),
+			( GafferImage.ImageWriter.Mode.Tile, "zip" ),
+		] :
+			writer = GafferImage.ImageWriter()
+			writer["in"].setInput( reader["out"] )
+			writer["fileName"].setValue( self.temporaryDirectory() / "{}{}.exr".format( mode, compression ) )
+			writer["openexr"]["mode"].setValue( mode )
+			writer["openexr"]["compression"].setValue( compression )
+			writer["task"].execute()
+			fileNames.append( writer["fileName"].getValue() )
+
+		for fileName in fileNames :
+
+			with self.subTest( fileName = fileName ) :
+
+				reader["fileName"].setValue( fileName )
+
+				GafferImage.OpenImageIOReader.setIOThreads( 0 )
+				Gaffer.ValuePlug.clearCache()
+				expected = GafferImage.ImageAlgo.image( reader["out"] )
+
+				for numThreads in ( 1, 4 ) :
+					GafferImage.OpenImageIOReader.setIOThreads( numThreads )
+					Gaffer.ValuePlug.clearCache()
+					self.assertEqual( GafferImage.ImageAlgo.image( reader["out"] ), expected )
+
+		self.assertEqual( GafferImage.OpenImageIOReader.ioQueueDepth(), 0 )
+		self.assertEqual( GafferImage.OpenImageIOReader.ioBytesInFlight(), 0 )
+
+	def testMemoryMapping( self ) :
+
+		self.addCleanup( GafferImage.OpenImageIOReader.setMemoryMappingEnabled, GafferImage.OpenImageIOReader.getMemoryMappingEnabled() )
+
+		GafferImage.OpenImageIOReader.setMemoryMappingEnabled( True )
+		self.assertTrue( GafferImage.OpenImageIOReader.getMemoryMappingEnabled() )
+		GafferImage.OpenImageIOReader.setMemoryMappingEnabled( False )
+		self.assertFalse( GafferImage.OpenImageIOReader.getMemoryMappingEnabled() )
+
+		# Write uncompressed files in all the variations we support mapping
+		# for, plus a compressed one which must fall back to OIIO. The
+		# offset makes sure the data window doesn't align with the tiles.
+
+		reader = GafferImage.OpenImageIOReader()
+		reader["fileName"].setValue( self.dotGridWarpedFileName )
+
+		offset = GafferImage.Offset()
+		offset["in"].setInput( reader["out"] )
+		offset["offset"].setValue( imath.V2i( -17, 23 ) )
+
+		fileNames = [ self.fileName, self.offsetDataWindowFileName, self.imagesPath() / "multipart.exr" ]
+		for mode, dataType, compression in [
+			( GafferImage.ImageWriter.Mode.Scanline, "half", "none" ),
+			( GafferImage.ImageWriter.Mode.Scanline, "float", "none" ),
+			( GafferImage.ImageWriter.Mode.Tile, "half", "none" ),
+			( GafferImage.ImageWriter.Mode.Tile, "float", "none" ),
+			( GafferImage.ImageWriter.Mode.Scanline, "half", "zips" ),
+		] :
+			writer = GafferImage.ImageWriter()
+			writer["in"].setInput( offset["out"] )
+			writer["fileName"].setValue( self.temporaryDirectory() / "{}{}{}.exr".format( mode, dataType, compression ) )
+			writer["openexr"]["mode"].setValue( mode )
+			writer["openexr"]["dataType"].setValue( dataType )
+			writer["openexr"]["compression"].setValue( compression )
+			writer["task"].execute()
+			fileNames.append( writer["fileName"].getValue() )
+
+		for fileName in fileNames :
+
+			with self.subTest( fileName = fileName ) :
+
+				reader["fileName"].setValue( fileName )
+
+				GafferImage.OpenImageIOReader.setMemoryMappingEnabled( False )
+				Gaffer.ValuePlug.clearCache()
+				expected = GafferImage.ImageAlgo.image( reader["out"] )
+
+				GafferImage.OpenImageIOReader.setMemoryMappingEnabled( True )
+				Gaffer.ValuePlug.clearCache()
+				self.assertEqual( GafferImage.ImageAlgo.image( reader["out"] ), expected )
+
+	def __runMemoryMappingPerfTest( self, memoryMapping ) :
+
+		self.addCleanup( GafferImage.OpenImageIOReader.setMemoryMappingEnabled, GafferImage.OpenImageIOReader.getMemoryMappingEnabled() )
+
+		origSource = GafferImage.ImageReader()
+		origSource["fileName"].setValue( self.dotGridWarpedFileName )
+
+		resize = GafferImage.Resize()
+		resize["in"].setInput( origSource["out"] )
+		resize["format"]["displayWindow"].setValue( imath.Box2i( imath.V2i( 0 ), imath.V2i( 8192 ) ) )
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( resize["out"] )
+		writer["fileName"].setValue( self.temporaryDirectory() / "uncompressed.exr" )
+		writer["openexr"]["compression"].setValue( "none" )
+		writer["openexr"]["dataType"].setValue( "half" )
+		writer["task"].execute()
+
+		GafferImage.OpenImageIOReader.setMemoryMappingEnabled( memoryMapping )
+
+		perfReader = GafferImage.ImageReader()
+		perfReader["fileName"].setValue( writer["fileName"].getValue() )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( perfReader["out"] )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testUncompressedPerformance( self ) :
+
+		self.__runMemoryMappingPerfTest( False )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testMemoryMappedPerformance( self ) :
+
+		self.__runMemoryMappingPerfTest( True )
+
+	def testHalfTileStorage( self ) :
+
+		self.addCleanup( GafferImage.OpenImageIOReader.setHalfTileStorageEnabled, GafferImage.OpenImageIOReader.getHalfTileStorageEnabled() )
+		self.addCleanup( GafferImage.OpenImageIOReader.setMemoryMappingEnabled, GafferImage.OpenImageIOReader.getMemoryMappingEnabled() )
+
+		GafferImage.OpenImageIOReader.setHalfTileStorageEnabled( True )
+		self.assertTrue( GafferImage.OpenImageIOReader.getHalfTileStorageEnabled() )
+		GafferImage.OpenImageIOReader.setHalfTileStorageEnabled( False )
+		self.assertFalse( GafferImage.OpenImageIOReader.getHalfTileStorageEnabled() )
+
+		reader = GafferImage.OpenImageIOReader()
+		reader["fileName"].setValue( self.dotGridWarpedFileName )
+
+		offset = GafferImage.Offset()
+		offset["in"].setInput( reader["out"] )
+		offset["offset"].setValue( imath.V2i( -17, 23 ) )
+
+		files = []
+		for dataType, compression in [
+			( "half", "zips" ),
+			( "half", "none" ),
+			( "float", "zips" ),
+		] :
+			writer = GafferImage.ImageWriter()
+			writer["in"].setInput( offset["out"] )
+			writer["fileName"].setValue( self.temporaryDirectory() / "{}{}.exr".format( dataType, compression ) )
+			writer["openexr"]["dataType"].setValue( dataType )
+			writer["openexr"]["compression"].setValue( compression )
+			writer["task"].execute()
+			files.append( ( writer["fileName"].getValue(), dataType ) )
+
+		for fileName, dataType in files :
+			for memoryMapping in ( False, True ) :
+
+				with self.subTest( fileName = fileName, memoryMapping = memoryMapping ) :
+
+					reader["fileName"].setValue( fileName )
+					GafferImage.OpenImageIOReader.setMemoryMappingEnabled( memoryMapping )
+
+					GafferImage.OpenImageIOReader.setHalfTileStorageEnabled( False )
+					Gaffer.ValuePlug.clearCache()
+					expected = GafferImage.ImageAlgo.image( reader["out"] )
+					floatMemoryUsage = Gaffer.ValuePlug.cacheMemoryUsage()
+
+					GafferImage.OpenImageIOReader.setHalfTileStorageEnabled( True )
+					Gaffer.ValuePlug.clearCache()
+					self.assertEqual( GafferImage.ImageAlgo.image( reader["out"] ), expected )
+
+					# Half channels should take up roughly half the space in the cache,
+					# and float channels should be unaffected.
+					if dataType == "half" :
+						self.assertLess( Gaffer.ValuePlug.cacheMemoryUsage(), floatMemoryUsage * 0.75 )
+					else :
+						self.assertEqual( Gaffer.ValuePlug.cacheMemoryUsage(), floatMemoryUsage )
+
 	def testSubimageMetadataNotLoaded( self ) :
 
 		reader = GafferImage.ImageReader()
@@ -239,6 +239,26 @@ class ResampleTest( GafferImageTest.ImageTestCase ) :
 		r["filterScale"].setValue( imath.V2f( 10 ) )
 		self.assertEqual( r["out"]["dataWindow"].getValue(), imath.Box2i( d.min() - imath.V2i( 5 ), d.max() + imath.V2i( 5 ) ) )
 
+	def testFilterWeightsShared( self ) :
+
+		constant = GafferImage.Constant()
+		constant["format"].setValue( GafferImage.Format( 512, 256 ) )
+
+		resample = GafferImage.Resample()
+		resample["in"].setInput( constant["out"] )
+		resample["matrix"].setValue( imath.M33f().scale( imath.V2f( 0.5 ) ) )
+		resample["filter"].setValue( "lanczos3" )
+
+		self.assertEqual( resample["out"]["dataWindow"].getValue(), imath.Box2i( imath.V2i( 0 ), imath.V2i( 256, 128 ) ) )
+
+		with Gaffer.PerformanceMonitor() as monitor :
+			GafferImageTest.processTiles( resample["out"] )
+
+		# Weights should be computed once per tile column for the horizontal pass,
+		# and once per tile row for the vertical pass, and shared by all channels.
+		self.assertEqual( monitor.plugStatistics( resample["__horizontalFilterWeights"] ).computeCount, 4 )
+		self.assertEqual( monitor.plugStatistics( resample["__verticalFilterWeights"] ).computeCount, 2 )
+
 	def testCancellation( self ) :
 
 		script = Gaffer.ScriptNode()
@@ -304,5 +304,32 @@ class SamplerTest( GafferImageTest.ImageTestCase ) :
 									with self.subTest( dataWindow = dataWindow, region = region ):
 										GafferImageTest.validateVisitPixels( sampler, region )
 
+	def testBatchSample( self ) :
+
+		ts = GafferImage.ImagePlug.tileSize()
+
+		ramp = GafferImage.Ramp()
+		ramp["format"].setValue( GafferImage.Format( 2 * ts + 9, ts + 7 ) )
+		ramp["endPosition"].setValue( imath.V2f( 2 * ts + 9, ts + 7 ) )
+
+		offset = GafferImage.Offset()
+		offset["in"].setInput( ramp["out"] )
+		offset["offset"].setValue( imath.V2i( -ts // 2 - 3, 5 ) )
+		dataWindow = offset["out"].dataWindow()
+
+		# Positions covering the interior of tiles, the edges of tiles,
+		# the edges of the data window and areas outside it.
+		positions = IECore.V2fVectorData()
+		for y in range( dataWindow.min().y - 3, dataWindow.max().y + 3 ) :
+			for x in range( dataWindow.min().x - 3, dataWindow.max().x + 3, 7 ) :
+				positions.append( imath.V2f( x + 0.5, y + 0.5 ) )
+				positions.append( imath.V2f( x + 0.25, y + 0.9 ) )
+				positions.append( imath.V2f( x, y ) )
+
+		sampleWindow = imath.Box2i( dataWindow.min() - imath.V2i( 4 ), dataWindow.max() + imath.V2i( 4 ) )
+		for boundingMode in GafferImage.Sampler.BoundingMode.values.values() :
+			sampler = GafferImage.Sampler( offset["out"], "R", sampleWindow, boundingMode )
+			GafferImageTest.validateBatchSample( sampler, positions )
+
 if __name__ == "__main__":
 	unittest.main()
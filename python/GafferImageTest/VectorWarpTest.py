@@ -117,6 +117,137 @@ class VectorWarpTest( GafferImageTest.ImageTestCase ) :
 
 		GafferImageTest.processTiles( vectorWarp["out"] )
 
+	def testAbsolutePixelPositions( self ) :
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 100, 100 ) )
+		checker["size"].setValue( imath.V2f( 5 ) )
+
+		constant = GafferImage.Constant()
+		constant["format"].setValue( GafferImage.Format( 10, 10 ) )
+
+		vectorWarp = GafferImage.VectorWarp()
+		vectorWarp["in"].setInput( checker["out"] )
+		vectorWarp["vector"].setInput( constant["out"] )
+		vectorWarp["vectorUnits"].setValue( GafferImage.VectorWarp.VectorUnits.Pixels )
+		vectorWarp["filter"].setValue( "bilinear" )
+
+		inputSampler = GafferImage.ImageSampler()
+		inputSampler["image"].setInput( checker["out"] )
+
+		outputSampler = GafferImage.ImageSampler()
+		outputSampler["image"].setInput( vectorWarp["out"] )
+		outputSampler["pixel"].setValue( imath.V2f( 5.5 ) )
+
+		for position in [
+			imath.V2f( 0.5 ), imath.V2f( 12.3, 47.9 ), imath.V2f( 99.9, 0.1 ),
+			imath.V2f( -0.3, 50.5 ), imath.V2f( 50.5, 100.2 ), imath.V2f( -20.5, 30.5 )
+		] :
+			constant["color"].setValue( imath.Color4f( position.x, position.y, 0, 1 ) )
+			inputSampler["pixel"].setValue( position )
+			self.assertEqual( outputSampler["color"].getValue(), inputSampler["color"].getValue() )
+
+		# In Clamp mode, positions more than a pixel outside the data
+		# window take the value of the nearest pixel inside it.
+
+		vectorWarp["boundingMode"].setValue( GafferImage.Sampler.BoundingMode.Clamp )
+		for position, clampedPosition in [
+			( imath.V2f( -20.5, 30.5 ), imath.V2f( 0.5, 30.5 ) ),
+			( imath.V2f( 50.5, 120.5 ), imath.V2f( 50.5, 99.5 ) ),
+			( imath.V2f( 150.5, -3.5 ), imath.V2f( 99.5, 0.5 ) ),
+		] :
+			constant["color"].setValue( imath.Color4f( position.x, position.y, 0, 1 ) )
+			inputSampler["pixel"].setValue( clampedPosition )
+			self.assertEqual( outputSampler["color"].getValue(), inputSampler["color"].getValue() )
+
+	def testBilinearNeighboursAffectHash( self ) :
+
+		# The input is black except for a strip starting at x == 64, which
+		# is in the second column of tiles. The Offset is not tile-aligned,
+		# so the first column of tiles doesn't depend on the colour.
+
+		constant = GafferImage.Constant()
+		constant["format"].setValue( GafferImage.Format( 10, 64 ) )
+		constant["color"].setValue( imath.Color4f( 1 ) )
+
+		offset = GafferImage.Offset()
+		offset["in"].setInput( constant["out"] )
+		offset["offset"].setValue( imath.V2i( 64, 1 ) )
+
+		# Sample at a position whose filter support lies entirely within
+		# the first column of tiles, but whose bilinear neighbour doesn't.
+
+		vector = GafferImage.Constant()
+		vector["format"].setValue( GafferImage.Format( 64, 64 ) )
+		vector["color"].setValue( imath.Color4f( 63.9, 10.5, 0, 1 ) )
+
+		vectorWarp = GafferImage.VectorWarp()
+		vectorWarp["in"].setInput( offset["out"] )
+		vectorWarp["vector"].setInput( vector["out"] )
+		vectorWarp["vectorUnits"].setValue( GafferImage.VectorWarp.VectorUnits.Pixels )
+		vectorWarp["filter"].setValue( "bilinear" )
+
+		sampler = GafferImage.ImageSampler()
+		sampler["image"].setInput( vectorWarp["out"] )
+		sampler["pixel"].setValue( imath.V2f( 5.5 ) )
+
+		self.assertAlmostEqual( sampler["color"].getValue()[0], 0.4, places = 5 )
+
+		constant["color"].setValue( imath.Color4f( 0.5 ) )
+		self.assertAlmostEqual( sampler["color"].getValue()[0], 0.2, places = 5 )
+
+	def testSparseSamples( self ) :
+
+		# When the input positions for a tile are scattered over a large
+		# area, VectorWarp only fetches the input tiles it needs, rather
+		# than gathering the whole area. Check that this gives the same
+		# results as the usual case.
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 4000, 4000 ) )
+		checker["size"].setValue( imath.V2f( 5 ) )
+
+		constant = GafferImage.Constant()
+		constant["format"].setValue( GafferImage.Format( 100, 100 ) )
+		constant["color"].setValue( imath.Color4f( 20.3, 31.7, 0, 1 ) )
+
+		farConstant = GafferImage.Constant()
+		farConstant["format"].setValue( GafferImage.Format( 100, 100 ) )
+		farConstant["color"].setValue( imath.Color4f( 3500.5, 3500.5, 0, 1 ) )
+
+		farCrop = GafferImage.Crop()
+		farCrop["in"].setInput( farConstant["out"] )
+		farCrop["area"].setValue( imath.Box2i( imath.V2i( 3 ), imath.V2i( 4 ) ) )
+		farCrop["affectDisplayWindow"].setValue( False )
+
+		merge = GafferImage.Merge()
+		merge["in"][0].setInput( constant["out"] )
+		merge["in"][1].setInput( farCrop["out"] )
+
+		for filter in ( "bilinear", "cubic" ) :
+			for boundingMode in GafferImage.Sampler.BoundingMode.values.values() :
+
+				vectorWarp = GafferImage.VectorWarp()
+				vectorWarp["in"].setInput( checker["out"] )
+				vectorWarp["vector"].setInput( constant["out"] )
+				vectorWarp["vectorUnits"].setValue( GafferImage.VectorWarp.VectorUnits.Pixels )
+				vectorWarp["filter"].setValue( filter )
+				vectorWarp["boundingMode"].setValue( boundingMode )
+
+				sparseVectorWarp = GafferImage.VectorWarp()
+				sparseVectorWarp["in"].setInput( checker["out"] )
+				sparseVectorWarp["vector"].setInput( merge["out"] )
+				for name in ( "vectorUnits", "filter", "boundingMode" ) :
+					sparseVectorWarp[name].setValue( vectorWarp[name].getValue() )
+
+				farPixel = GafferImage.ImagePlug.pixelIndex( imath.V2i( 3 ), imath.V2i( 0 ) )
+				for channelName in ( "R", "G", "B", "A" ) :
+					tile = list( vectorWarp["out"].channelData( channelName, imath.V2i( 0 ) ) )
+					sparseTile = list( sparseVectorWarp["out"].channelData( channelName, imath.V2i( 0 ) ) )
+					del tile[farPixel]
+					del sparseTile[farPixel]
+					self.assertEqual( sparseTile, tile )
+
 	def testWarpImage( self ):
 		dotGridReader = GafferImage.ImageReader()
 		dotGridReader["fileName"].setValue( self.imagesPath() / "dotGrid.300.exr" )
@@ -226,6 +357,10 @@ class VectorWarpTest( GafferImageTest.ImageTestCase ) :
 	def testBilinearPerf( self ):
 		self.runPerfTest( 300, 2500, "bilinear", False )
 
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testBilinear4KPerf( self ):
+		self.runPerfTest( 4096, 4096, "bilinear", False )
+
 	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
 	def testDownsamplePerf( self ):
 		self.runPerfTest( 6000, 300, "cubic", True )
@@ -91,7 +91,30 @@ Gaffer.Metadata.registerNode(
 			which the blur will bleed onto.
 			"""
 
-		]
+		],
+
+		"method" : [
+
+			"description",
+			"""
+			The algorithm used to compute the blur.
+
+			- Accurate : Filters the image with a true gaussian. The cost
+			  per pixel grows with the radius, so very large blurs can be
+			  slow.
+			- Fast : Approximates the gaussian using repeated box filters,
+			  with a cost per pixel that is independent of the radius. The
+			  result is computed for the whole image at once, so this is best
+			  suited to large radii, where it is visually indistinguishable
+			  from the Accurate method.
+			""",
+
+			"preset:Accurate", GafferImage.Blur.Method.Accurate,
+			"preset:Fast", GafferImage.Blur.Method.Fast,
+
+			"plugValueWidget:type", "GafferUI.PresetsPlugValueWidget",
+
+		],
 
 	}
 
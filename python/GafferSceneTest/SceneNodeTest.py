@@ -37,6 +37,7 @@
 
 import enum
 import inspect
+import subprocess
 import unittest
 import time
 import threading
@@ -505,5 +506,32 @@ class SceneNodeTest( GafferSceneTest.SceneTestCase ) :
 
 		Gaffer.ValuePlug.setCacheMemoryLimit( self.__previousCacheMemoryLimit )
 
+	def testCachePartitions( self ) :
+
+		# Partitions can't be removed once created, so we test in a
+		# subprocess to avoid affecting the other tests.
+		subprocess.check_call( [
+			str( Gaffer.executablePath() ), "env", "python", "-c",
+			"import GafferSceneTest; GafferSceneTest.SceneNodeTest._cachePartitions()"
+		] )
+
+	@staticmethod
+	def _cachePartitions() :
+
+		for partition in ( "scene", "sceneObjects" ) :
+			Gaffer.ValuePlug.setCachePartitionMemoryLimit( partition, 1024 * 1024 * 1024 )
+
+		sphere = GafferScene.Sphere()
+
+		sphere["out"].object( "/sphere" )
+		objectsUsage = Gaffer.ValuePlug.cachePartitionMemoryUsage( "sceneObjects" )
+		assert( objectsUsage > 0 )
+
+		sphere["out"].childNames( "/" )
+		sphere["out"].transform( "/sphere" )
+		sphere["out"].bound( "/sphere" )
+		assert( Gaffer.ValuePlug.cachePartitionMemoryUsage( "scene" ) > 0 )
+		assert( Gaffer.ValuePlug.cachePartitionMemoryUsage( "sceneObjects" ) == objectsUsage )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -0,0 +1,111 @@
+##########################################################################
+#
+#  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+import unittest
+
+import IECore
+
+import GafferTest
+
+class ConcurrentCacheTest( GafferTest.TestCase ) :
+
+	def test( self ) :
+
+		GafferTest.testConcurrentCache()
+
+	def testConcurrency( self ) :
+
+		GafferTest.testConcurrentCacheConcurrency( numIterations = 100000, numValues = 1000, maxCost = 2000 )
+
+	def testConcurrencyWithEviction( self ) :
+
+		GafferTest.testConcurrentCacheConcurrency( numIterations = 100000, numValues = 10000, maxCost = 900 )
+
+	def testConcurrentClear( self ) :
+
+		GafferTest.testConcurrentCacheConcurrency( numIterations = 100000, numValues = 1000, maxCost = 2000, clearFrequency = 20 )
+
+	def testConcurrentResize( self ) :
+
+		GafferTest.testConcurrentCacheConcurrency( numIterations = 100000, numValues = 1000, maxCost = 2000, resizeFrequency = 1000 )
+
+	def testHashCacheSharing( self ) :
+
+		# The shared cache should never need to compute more hashes than
+		# the per-thread caches it replaces, and will typically compute
+		# far fewer when there are many threads, because tasks for sibling
+		# locations share the hashes for their parent location. We allow
+		# a little slack for the occasional conflict evictions caused by
+		# the shared cache's limited associativity.
+
+		for numThreads in ( 1, 2, 4, 8, 16, 32, 64, 128 ) :
+			with self.subTest( numThreads = numThreads ) :
+
+				shared = GafferTest.benchmarkHashCache( "shared", numThreads )
+				perThread = GafferTest.benchmarkHashCache( "perThread", numThreads )
+
+				for result in ( shared, perThread ) :
+					self.assertGreater( result["hits"], 0 )
+					self.assertGreater( result["misses"], 0 )
+
+				self.assertLessEqual( shared["misses"], perThread["misses"] * 1.01 )
+
+	def __hashCachePerformance( self, cache, numThreads ) :
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			result = GafferTest.benchmarkHashCache( cache, numThreads, depth = 6 )
+
+		IECore.msg(
+			IECore.Msg.Level.Debug, "ConcurrentCacheTest",
+			"{} cache, {} threads : hit rate {:.3f}, throughput {:.0f} lookups/s".format(
+				cache, numThreads, result["hitRate"], result["throughput"]
+			)
+		)
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testSharedHashCachePerformance( self ) :
+
+		for numThreads in ( 1, 8, 32, 128 ) :
+			self.__hashCachePerformance( "shared", numThreads )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerThreadHashCachePerformance( self ) :
+
+		for numThreads in ( 1, 8, 32, 128 ) :
+			self.__hashCachePerformance( "perThread", numThreads )
+
+if __name__ == "__main__":
+	unittest.main()
@@ -498,6 +498,47 @@ class ContextTest( GafferTest.TestCase ) :
 		c["test2"] = "test2" # no change
 		self.assertEqual( c.hash(), hashes[-1] )
 
+	def testHashMatchesFreshContext( self ) :
+
+		# The hash is updated incrementally as variables are added, replaced
+		# and removed. Check that it always matches the hash of a context
+		# constructed from scratch with the same variables.
+
+		def assertHashValid( c ) :
+
+			fresh = Gaffer.Context()
+			for name in fresh.names() :
+				del fresh[name]
+			for name in c.names() :
+				fresh[name] = c[name]
+			self.assertEqual( c.hash(), fresh.hash() )
+
+		c = Gaffer.Context()
+		assertHashValid( c )
+
+		for i in range( 0, 20 ) :
+			c["test{}".format( i )] = i
+			assertHashValid( c )
+
+		c["test1"] = "one"
+		c["test2"] = IECore.V3fData( imath.V3f( 2 ) )
+		c.setFrame( 10 )
+		assertHashValid( c )
+
+		del c["test3"]
+		c.removeMatching( "test1*" )
+		assertHashValid( c )
+
+		c2 = Gaffer.Context( c )
+		self.assertEqual( c2.hash(), c.hash() )
+		c2["test4"] = 5
+		assertHashValid( c2 )
+		self.assertNotEqual( c2.hash(), c.hash() )
+
+		with Gaffer.Context( c ) as c3 :
+			c3["test5"] = 6
+			assertHashValid( c3 )
+
 	def testHashIgnoresUIEntries( self ) :
 
 		c = Gaffer.Context()
@@ -809,6 +850,11 @@ class ContextTest( GafferTest.TestCase ) :
 
 		GafferTest.testContextCopyPerformance( 10, 10 )
 
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testEditableScopePerformance( self ) :
+
+		GafferTest.testEditableScopePerformance( 10, 5 )
+
 	def testCopyEditableScope( self ) :
 
 		GafferTest.testCopyEditableScope()
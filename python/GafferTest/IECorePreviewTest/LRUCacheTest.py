@@ -34,6 +34,7 @@
 #
 ##########################################################################
 
+import random
 import unittest
 
 import GafferTest
@@ -228,5 +229,81 @@ class LRUCacheTest( GafferTest.TestCase ) :
 			with self.subTest( policy = policy ) :
 				GafferTest.testLRUCacheSetIfUncached( policy )
 
+	# Returns a trace of cache accesses in the form expected by
+	# `GafferTest.replayLRUCacheTrace()`, simulating a handful of
+	# expensive values (think Instancer engines) being used repeatedly,
+	# interleaved with scans over many cheap values (think image tiles).
+	@staticmethod
+	def __trace( numIterations, numExpensive, numCheap, cheapPoolSize ) :
+
+		random.seed( 0 )
+
+		result = []
+		for i in range( 0, numIterations ) :
+			for k in range( 0, numExpensive ) :
+				result.append( ( k, 1000, 1.0 ) )
+			for k in range( 0, numCheap ) :
+				result.append( ( 1000 + random.randrange( 0, cheapPoolSize ), 1000, 0.000001 ) )
+
+		return result
+
+	def testCostAwareEviction( self ) :
+
+		trace = self.__trace( numIterations = 200, numExpensive = 10, numCheap = 100, cheapPoolSize = 1000 )
+
+		for policy in [ "serial", "parallel", "taskParallel" ] :
+			with self.subTest( policy = policy ) :
+
+				lru = GafferTest.replayLRUCacheTrace( policy, "lru", trace, maxCost = 50000 )
+				costAware = GafferTest.replayLRUCacheTrace( policy, "costAware", trace, maxCost = 50000 )
+
+				for result in ( lru, costAware ) :
+					self.assertEqual( result["hits"] + result["misses"], len( trace ) )
+
+				# LRU evicts the expensive values during every scan, so
+				# must recompute them each time.
+				self.assertGreaterEqual( lru["recomputeTime"], 2000 )
+				# CostAware retains them.
+				self.assertLess( costAware["recomputeTime"], lru["recomputeTime"] / 10 )
+				self.assertGreater( costAware["hits"], lru["hits"] )
+
+	def testCostAwareEvictionWithUniformCosts( self ) :
+
+		# When all items are equally expensive, CostAware should behave
+		# the same as LRU.
+
+		trace = [ ( i % 100, 1, 0.001 ) for i in range( 0, 10000 ) ]
+		for policy in [ "serial", "parallel", "taskParallel" ] :
+			with self.subTest( policy = policy ) :
+				lru = GafferTest.replayLRUCacheTrace( policy, "lru", trace, maxCost = 90 )
+				costAware = GafferTest.replayLRUCacheTrace( policy, "costAware", trace, maxCost = 90 )
+				self.assertEqual( lru["hits"], costAware["hits"] )
+
+	def __replayPerformance( self, policy, evictionPolicy ) :
+
+		trace = self.__trace( numIterations = 2000, numExpensive = 100, numCheap = 1000, cheapPoolSize = 100000 )
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferTest.replayLRUCacheTrace( policy, evictionPolicy, trace, maxCost = 500000 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testReplayPerformanceSerialLRU( self ) :
+
+		self.__replayPerformance( "serial", "lru" )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testReplayPerformanceSerialCostAware( self ) :
+
+		self.__replayPerformance( "serial", "costAware" )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testReplayPerformanceParallelLRU( self ) :
+
+		self.__replayPerformance( "parallel", "lru" )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testReplayPerformanceParallelCostAware( self ) :
+
+		self.__replayPerformance( "parallel", "costAware" )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -100,23 +100,39 @@ class PerformanceMonitorTest( GafferTest.TestCase ) :
 			hashCount = 10,
 			computeCount = 20,
 			hashDuration = 100,
-			computeDuration = 200
+			computeDuration = 200,
+			diskCacheHits = 1,
+			diskCacheMisses = 2,
+			diskCacheBytesRead = 300,
+			diskCacheBytesWritten = 400
 		)
 
 		self.assertEqual( s.hashCount, 10 )
 		self.assertEqual( s.computeCount, 20 )
 		self.assertEqual( s.hashDuration, 100 )
 		self.assertEqual( s.computeDuration, 200 )
+		self.assertEqual( s.diskCacheHits, 1 )
+		self.assertEqual( s.diskCacheMisses, 2 )
+		self.assertEqual( s.diskCacheBytesRead, 300 )
+		self.assertEqual( s.diskCacheBytesWritten, 400 )
 
 		s.hashCount = 20
 		s.computeCount = 30
 		s.hashDuration = 200
 		s.computeDuration = 300
+		s.diskCacheHits = 2
+		s.diskCacheMisses = 3
+		s.diskCacheBytesRead = 400
+		s.diskCacheBytesWritten = 500
 
 		self.assertEqual( s.hashCount, 20 )
 		self.assertEqual( s.computeCount, 30 )
 		self.assertEqual( s.hashDuration, 200 )
 		self.assertEqual( s.computeDuration, 300 )
+		self.assertEqual( s.diskCacheHits, 2 )
+		self.assertEqual( s.diskCacheMisses, 3 )
+		self.assertEqual( s.diskCacheBytesRead, 400 )
+		self.assertEqual( s.diskCacheBytesWritten, 500 )
 
 	def testEnterReturnValue( self ) :
 
@@ -34,6 +34,7 @@
 #
 ##########################################################################
 
+import json
 import re
 import unittest
 import os
@@ -70,5 +71,23 @@ class StatsApplicationTest( GafferTest.TestCase ) :
 		self.assertTrue( re.search( r"Box\s*1", o ) )
 		self.assertTrue( re.search( r"Total\s*3", o ) )
 
+	def testTraceFile( self ) :
+
+		script = Gaffer.ScriptNode()
+		script["n"] = GafferTest.AddNode()
+		script["fileName"].setValue( self.temporaryDirectory() / "script.gfr" )
+		script.save()
+
+		traceFile = self.temporaryDirectory() / "trace.json"
+		subprocess.check_call( [
+			str( Gaffer.executablePath() ), "stats", script["fileName"].getValue(),
+			"-serialise", "-traceFile", str( traceFile )
+		] )
+
+		with open( traceFile ) as f :
+			trace = json.load( f )
+
+		self.assertIn( "traceEvents", trace )
+
 if __name__ == "__main__":
 	unittest.main()
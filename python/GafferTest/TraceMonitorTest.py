@@ -0,0 +1,162 @@
+##########################################################################
+#
+#  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+import json
+import unittest
+
+import IECore
+
+import Gaffer
+import GafferTest
+
+class TraceMonitorTest( GafferTest.TestCase ) :
+
+	def testConstruction( self ) :
+
+		monitor = Gaffer.TraceMonitor()
+		self.assertEqual( monitor.numEvents(), 0 )
+		self.assertEqual( monitor.numDiscardedEvents(), 0 )
+
+	def testChromeTrace( self ) :
+
+		script = Gaffer.ScriptNode()
+		script["add1"] = GafferTest.AddNode()
+		script["add2"] = GafferTest.AddNode()
+		script["add2"]["op1"].setInput( script["add1"]["sum"] )
+
+		monitor = Gaffer.TraceMonitor()
+		with monitor :
+			script["add2"]["sum"].getValue()
+
+		# A hash and a compute for each node, each with a start and finish.
+		self.assertEqual( monitor.numEvents(), 8 )
+		self.assertEqual( monitor.numDiscardedEvents(), 0 )
+
+		fileName = self.temporaryDirectory() / "trace.json"
+		monitor.writeTrace( str( fileName ) )
+
+		with open( fileName ) as f :
+			trace = json.load( f )
+
+		slices = [ e for e in trace["traceEvents"] if e["ph"] == "X" ]
+		self.assertEqual( len( slices ), 4 )
+		self.assertEqual(
+			{ ( s["name"], s["cat"] ) for s in slices },
+			{
+				( "add1.sum", "computeNode:hash" ),
+				( "add1.sum", "computeNode:compute" ),
+				( "add2.sum", "computeNode:hash" ),
+				( "add2.sum", "computeNode:compute" ),
+			}
+		)
+
+		threadId = Gaffer.ThreadMonitor.thisThreadId()
+		for s in slices :
+			self.assertEqual( s["tid"], threadId )
+			self.assertEqual( s["args"]["cache"], "miss" )
+			self.assertEqual( s["args"]["contextHash"], str( Gaffer.Context().hash() ) )
+			self.assertGreaterEqual( s["dur"], 0 )
+
+		# The upstream compute is nested inside the downstream one.
+
+		add1Compute = next( s for s in slices if s["name"] == "add1.sum" and s["cat"] == "computeNode:compute" )
+		add2Compute = next( s for s in slices if s["name"] == "add2.sum" and s["cat"] == "computeNode:compute" )
+		self.assertGreaterEqual( add1Compute["ts"], add2Compute["ts"] )
+		self.assertLessEqual( add1Compute["ts"] + add1Compute["dur"], add2Compute["ts"] + add2Compute["dur"] )
+
+	def testPerfettoTrace( self ) :
+
+		node = GafferTest.AddNode()
+		monitor = Gaffer.TraceMonitor()
+		with monitor :
+			node["sum"].getValue()
+
+		fileName = self.temporaryDirectory() / "trace.pftrace"
+		monitor.writeTrace( str( fileName ) )
+
+		with open( fileName, "rb" ) as f :
+			data = f.read()
+
+		# Each packet is a length-delimited field 1 of the `Trace` message.
+		self.assertEqual( data[0], 0x0a )
+		self.assertIn( b"computeNode:compute", data )
+		self.assertIn( node["sum"].fullName().encode(), data )
+
+	def testUnsupportedExtension( self ) :
+
+		monitor = Gaffer.TraceMonitor()
+		with self.assertRaisesRegex( Exception, "Unsupported trace file extension" ) :
+			monitor.writeTrace( str( self.temporaryDirectory() / "trace.txt" ) )
+
+	def testDiscardOldestEvents( self ) :
+
+		node = GafferTest.AddNode()
+		monitor = Gaffer.TraceMonitor( maxEventsPerThread = 6 )
+		with monitor, Gaffer.Context() as context :
+			for i in range( 0, 4 ) :
+				context["i"] = i # Unique context to force hashing
+				node["sum"].getValue()
+
+		self.assertEqual( monitor.numEvents(), 6 )
+		self.assertGreater( monitor.numDiscardedEvents(), 0 )
+
+		fileName = self.temporaryDirectory() / "trace.json"
+		monitor.writeTrace( str( fileName ) )
+
+		with open( fileName ) as f :
+			trace = json.load( f )
+
+		slices = [ e for e in trace["traceEvents"] if e["ph"] == "X" ]
+		self.assertEqual( len( slices ), 3 )
+
+	def testThreading( self ) :
+
+		node = GafferTest.AddNode()
+		monitor = Gaffer.TraceMonitor()
+		with monitor :
+			GafferTest.parallelGetValue( node["sum"], 10000, "i" )
+
+		fileName = self.temporaryDirectory() / "trace.json"
+		monitor.writeTrace( str( fileName ) )
+
+		with open( fileName ) as f :
+			trace = json.load( f )
+
+		slices = [ e for e in trace["traceEvents"] if e["ph"] == "X" ]
+		self.assertEqual( len( slices ), monitor.numEvents() // 2 )
+
+if __name__ == "__main__":
+	unittest.main()
@@ -791,6 +791,46 @@ class ValuePlugTest( GafferTest.TestCase ) :
 			node["sum"].getValue()
 		self.assertEqual( m.plugStatistics( node["sum"] ).hashCount, 1 )
 
+	def testHashCacheSharedBetweenThreads( self ) :
+
+		node = GafferTest.AddNode()
+		Gaffer.ValuePlug.clearHashCache()
+
+		thread = threading.Thread( target = node["sum"].hash )
+		thread.start()
+		thread.join()
+
+		with Gaffer.PerformanceMonitor() as m :
+			node["sum"].hash()
+		self.assertEqual( m.plugStatistics( node["sum"] ).hashCount, 0 )
+
+	def testHashCacheSizeLimit( self ) :
+
+		originalLimit = Gaffer.ValuePlug.getHashCacheSizeLimit()
+		self.addCleanup( Gaffer.ValuePlug.setHashCacheSizeLimit, originalLimit )
+
+		node = GafferTest.AddNode()
+		node["sum"].hash()
+		self.assertGreater( Gaffer.ValuePlug.hashCacheTotalUsage(), 0 )
+
+		# Changing the limit discards all entries.
+
+		Gaffer.ValuePlug.setHashCacheSizeLimit( 10000 )
+		self.assertEqual( Gaffer.ValuePlug.getHashCacheSizeLimit(), 10000 )
+		self.assertEqual( Gaffer.ValuePlug.hashCacheTotalUsage(), 0 )
+
+		node["sum"].hash()
+		self.assertEqual( Gaffer.ValuePlug.hashCacheTotalUsage(), 1 )
+
+		# A limit of zero disables caching.
+
+		Gaffer.ValuePlug.setHashCacheSizeLimit( 0 )
+		for i in range( 0, 2 ) :
+			with Gaffer.PerformanceMonitor() as m :
+				node["sum"].hash()
+			self.assertEqual( m.plugStatistics( node["sum"] ).hashCount, 1 )
+			self.assertEqual( Gaffer.ValuePlug.hashCacheTotalUsage(), 0 )
+
 	def testResetDefault( self ) :
 
 		script = Gaffer.ScriptNode()
@@ -1067,17 +1107,341 @@ class ValuePlugTest( GafferTest.TestCase ) :
 					node["in"].setValue( i )
 					self.assertEqual( node["out"].getValue(), i )
 
+	def testDiskCache( self ) :
+
+		directory = str( self.temporaryDirectory() / "diskCache" )
+		Gaffer.ValuePlug.setDiskCacheDirectory( directory )
+		Gaffer.ValuePlug.setDiskCacheMinimumComputeTime( 0 )
+		self.assertEqual( Gaffer.ValuePlug.getDiskCacheDirectory(), directory )
+		self.assertEqual( Gaffer.ValuePlug.diskCacheUsage(), 0 )
+
+		node = GafferTest.CachingTestNode()
+		node["in"].setValue( "diskCacheTest" )
+
+		# First compute misses the disk cache, and then writes to it.
+
+		with Gaffer.PerformanceMonitor() as monitor :
+			self.assertEqual( node["out"].getValue(), IECore.StringData( "diskCacheTest" ) )
+
+		statistics = monitor.plugStatistics( node["out"] )
+		self.assertEqual( statistics.computeCount, 1 )
+		self.assertEqual( statistics.diskCacheHits, 0 )
+		self.assertEqual( statistics.diskCacheMisses, 1 )
+		self.assertEqual( statistics.diskCacheBytesRead, 0 )
+		self.assertGreater( statistics.diskCacheBytesWritten, 0 )
+		self.assertEqual( Gaffer.ValuePlug.diskCacheUsage(), statistics.diskCacheBytesWritten )
+
+		# Value is still in the memory cache, so the disk cache isn't needed.
+
+		with Gaffer.PerformanceMonitor() as monitor :
+			self.assertEqual( node["out"].getValue(), IECore.StringData( "diskCacheTest" ) )
+
+		self.assertEqual( monitor.plugStatistics( node["out"] ), Gaffer.PerformanceMonitor.Statistics() )
+
+		# After clearing the memory cache, the value is loaded from disk.
+
+		Gaffer.ValuePlug.clearCache()
+		with Gaffer.PerformanceMonitor() as monitor :
+			self.assertEqual( node["out"].getValue(), IECore.StringData( "diskCacheTest" ) )
+
+		statistics = monitor.plugStatistics( node["out"] )
+		self.assertEqual( statistics.diskCacheHits, 1 )
+		self.assertEqual( statistics.diskCacheMisses, 0 )
+		self.assertEqual( statistics.diskCacheBytesRead, Gaffer.ValuePlug.diskCacheUsage() )
+		self.assertEqual( statistics.diskCacheBytesWritten, 0 )
+
+		# A new cache using the same directory adopts the existing
+		# entries, as would a new process.
+
+		Gaffer.ValuePlug.setDiskCacheDirectory( "" )
+		self.assertEqual( Gaffer.ValuePlug.getDiskCacheDirectory(), "" )
+		self.assertEqual( Gaffer.ValuePlug.diskCacheUsage(), 0 )
+
+		Gaffer.ValuePlug.setDiskCacheDirectory( directory )
+		self.assertEqual( Gaffer.ValuePlug.diskCacheUsage(), statistics.diskCacheBytesRead )
+
+		# Clearing the disk cache means we must compute again.
+
+		Gaffer.ValuePlug.clearDiskCache()
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( Gaffer.ValuePlug.diskCacheUsage(), 0 )
+
+		with Gaffer.PerformanceMonitor() as monitor :
+			self.assertEqual( node["out"].getValue(), IECore.StringData( "diskCacheTest" ) )
+
+		self.assertEqual( monitor.plugStatistics( node["out"] ).diskCacheMisses, 1 )
+
+		# Values which are quick to compute aren't written.
+
+		Gaffer.ValuePlug.clearDiskCache()
+		Gaffer.ValuePlug.setDiskCacheMinimumComputeTime( 1000 )
+		node["in"].setValue( "quickToCompute" )
+
+		with Gaffer.PerformanceMonitor() as monitor :
+			self.assertEqual( node["out"].getValue(), IECore.StringData( "quickToCompute" ) )
+
+		self.assertEqual( monitor.plugStatistics( node["out"] ).diskCacheMisses, 1 )
+		self.assertEqual( monitor.plugStatistics( node["out"] ).diskCacheBytesWritten, 0 )
+		self.assertEqual( Gaffer.ValuePlug.diskCacheUsage(), 0 )
+
+	def testDiskCacheSizeLimit( self ) :
+
+		Gaffer.ValuePlug.setDiskCacheDirectory( str( self.temporaryDirectory() / "diskCache" ) )
+		Gaffer.ValuePlug.setDiskCacheMinimumComputeTime( 0 )
+
+		node = GafferTest.CachingTestNode()
+		for i in range( 0, 10 ) :
+			node["in"].setValue( str( i ) )
+			node["out"].getValue()
+
+		usage = Gaffer.ValuePlug.diskCacheUsage()
+		self.assertGreater( usage, 0 )
+
+		Gaffer.ValuePlug.setDiskCacheSizeLimit( usage // 2 )
+		self.assertEqual( Gaffer.ValuePlug.getDiskCacheSizeLimit(), usage // 2 )
+		self.assertLessEqual( Gaffer.ValuePlug.diskCacheUsage(), usage // 2 )
+
+	def testDiskCacheFindsEntriesFromOtherProcesses( self ) :
+
+		directory = self.temporaryDirectory() / "diskCache"
+		Gaffer.ValuePlug.setDiskCacheDirectory( str( directory ) )
+		Gaffer.ValuePlug.setDiskCacheMinimumComputeTime( 0 )
+
+		node = GafferTest.CachingTestNode()
+		node["in"].setValue( "otherProcess" )
+		node["out"].getValue()
+
+		# Simulate another process writing the entry after our index was
+		# built, by removing it from our cache and then restoring the file.
+
+		entries = { p : p.read_bytes() for p in directory.rglob( "*.cache" ) }
+		self.assertEqual( len( entries ), 1 )
+		Gaffer.ValuePlug.clearDiskCache()
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( Gaffer.ValuePlug.diskCacheUsage(), 0 )
+		for path, data in entries.items() :
+			path.parent.mkdir( parents = True, exist_ok = True )
+			path.write_bytes( data )
+
+		# The plug has been slow enough to be written to the disk cache
+		# before, so we look for the unindexed entry and find it.
+
+		with Gaffer.PerformanceMonitor() as monitor :
+			self.assertEqual( node["out"].getValue(), IECore.StringData( "otherProcess" ) )
+
+		statistics = monitor.plugStatistics( node["out"] )
+		self.assertEqual( statistics.diskCacheHits, 1 )
+		self.assertEqual( Gaffer.ValuePlug.diskCacheUsage(), statistics.diskCacheBytesRead )
+
+	def testCacheEvictionPolicy( self ) :
+
+		self.assertEqual( Gaffer.ValuePlug.getCacheEvictionPolicy(), Gaffer.ValuePlug.CacheEvictionPolicy.LRU )
+
+		Gaffer.ValuePlug.setCacheEvictionPolicy( Gaffer.ValuePlug.CacheEvictionPolicy.CostAware )
+		self.assertEqual( Gaffer.ValuePlug.getCacheEvictionPolicy(), Gaffer.ValuePlug.CacheEvictionPolicy.CostAware )
+
+		node = GafferTest.CachingTestNode()
+		node["in"].setValue( "0" )
+		node["out"].getValue()
+		Gaffer.ValuePlug.setCacheMemoryLimit( Gaffer.ValuePlug.cacheMemoryUsage() * 5 )
+
+		for i in range( 0, 100 ) :
+			node["in"].setValue( str( i ) )
+			self.assertEqual( node["out"].getValue(), IECore.StringData( str( i ) ) )
+			self.assertLessEqual( Gaffer.ValuePlug.cacheMemoryUsage(), Gaffer.ValuePlug.getCacheMemoryLimit() )
+
+	def testCostAwareEvictionKeepsExpensiveValues( self ) :
+
+		class SlowNode( Gaffer.ComputeNode ) :
+
+			def __init__( self, name = "SlowNode" ) :
+
+				Gaffer.ComputeNode.__init__( self, name )
+
+				self["in"] = Gaffer.StringPlug()
+				self["out"] = Gaffer.ObjectPlug( direction = Gaffer.Plug.Direction.Out, defaultValue = IECore.NullObject() )
+
+			def affects( self, input ) :
+
+				result = Gaffer.ComputeNode.affects( self, input )
+				if input.isSame( self["in"] ) :
+					result.append( self["out"] )
+
+				return result
+
+			def hash( self, output, context, h ) :
+
+				self["in"].hash( h )
+
+			def compute( self, output, context ) :
+
+				value = self["in"].getValue()
+				if value == "expensive" :
+					time.sleep( 0.2 )
+				output.setValue( IECore.StringData( value ) )
+
+		def expensiveValueRetained( policy ) :
+
+			Gaffer.ValuePlug.setCacheEvictionPolicy( policy )
+			Gaffer.ValuePlug.setCacheMemoryLimit( self.__originalCacheMemoryLimit )
+			Gaffer.ValuePlug.clearCache()
+
+			node = SlowNode()
+
+			# Seed the average compute cost with cheap values, and
+			# measure the memory used by one value.
+			node["in"].setValue( "cheap" )
+			node["out"].getValue()
+			Gaffer.ValuePlug.setCacheMemoryLimit( Gaffer.ValuePlug.cacheMemoryUsage() * 5 )
+			for i in range( 0, 10 ) :
+				node["in"].setValue( "seed{}".format( i ) )
+				node["out"].getValue()
+
+			node["in"].setValue( "expensive" )
+			node["out"].getValue()
+
+			# Stream enough cheap values through the cache to evict
+			# everything under an LRU policy.
+			for i in range( 0, 20 ) :
+				node["in"].setValue( str( i ) )
+				node["out"].getValue()
+
+			node["in"].setValue( "expensive" )
+			with Gaffer.PerformanceMonitor() as monitor :
+				node["out"].getValue()
+
+			return monitor.plugStatistics( node["out"] ).computeCount == 0
+
+		self.assertFalse( expensiveValueRetained( Gaffer.ValuePlug.CacheEvictionPolicy.LRU ) )
+		self.assertTrue( expensiveValueRetained( Gaffer.ValuePlug.CacheEvictionPolicy.CostAware ) )
+
+	class PartitionedNode( Gaffer.ComputeNode ) :
+
+		def __init__( self, name = "PartitionedNode", partition = "" ) :
+
+			Gaffer.ComputeNode.__init__( self, name )
+
+			self.partition = partition
+
+			self["in"] = Gaffer.StringPlug()
+			self["out"] = Gaffer.ObjectPlug( direction = Gaffer.Plug.Direction.Out, defaultValue = IECore.NullObject.defaultNullObject() )
+
+		def affects( self, input ) :
+
+			outputs = Gaffer.ComputeNode.affects( self, input )
+			if input == self["in"] :
+				outputs.append( self["out"] )
+
+			return outputs
+
+		def hash( self, output, context, h ) :
+
+			if output == self["out"] :
+				self["in"].hash( h )
+				h.append( self.partition )
+
+		def compute( self, output, context ) :
+
+			if output == self["out"] :
+				output.setValue( IECore.StringData( self["in"].getValue() ) )
+
+		def computeCachePartition( self, output ) :
+
+			return self.partition
+
+	IECore.registerRunTimeTyped( PartitionedNode )
+
+	def testCachePartitions( self ) :
+
+		partition = "ValuePlugTest.testCachePartitions"
+		self.assertNotIn( partition, Gaffer.ValuePlug.cachePartitions() )
+		self.assertEqual( Gaffer.ValuePlug.getCachePartitionMemoryLimit( partition ), Gaffer.ValuePlug.getCacheMemoryLimit() )
+
+		defaultNode = self.PartitionedNode()
+		defaultNode["in"].setValue( "default" )
+		partitionedNode = self.PartitionedNode( partition = partition )
+		partitionedNode["in"].setValue( "partitioned" )
+
+		# Until the partition has been given its own limit, its values are
+		# stored in the default partition.
+
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( partitionedNode["out"].getValue(), IECore.StringData( "partitioned" ) )
+		self.assertGreater( Gaffer.ValuePlug.cachePartitionMemoryUsage( "" ), 0 )
+		self.assertEqual( Gaffer.ValuePlug.cachePartitionMemoryUsage( partition ), Gaffer.ValuePlug.cachePartitionMemoryUsage( "" ) )
+
+		# Once it has a limit, it is stored separately.
+
+		Gaffer.ValuePlug.setCachePartitionMemoryLimit( partition, 1024 * 1024 )
+		self.assertIn( partition, Gaffer.ValuePlug.cachePartitions() )
+		self.assertEqual( Gaffer.ValuePlug.getCachePartitionMemoryLimit( partition ), 1024 * 1024 )
+
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( Gaffer.ValuePlug.cachePartitionMemoryUsage( partition ), 0 )
+		self.assertEqual( partitionedNode["out"].getValue(), IECore.StringData( "partitioned" ) )
+		partitionUsage = Gaffer.ValuePlug.cachePartitionMemoryUsage( partition )
+		self.assertGreater( partitionUsage, 0 )
+		self.assertEqual( Gaffer.ValuePlug.cachePartitionMemoryUsage( "" ), 0 )
+
+		self.assertEqual( defaultNode["out"].getValue(), IECore.StringData( "default" ) )
+		self.assertGreater( Gaffer.ValuePlug.cachePartitionMemoryUsage( "" ), 0 )
+		self.assertEqual( Gaffer.ValuePlug.cachePartitionMemoryUsage( partition ), partitionUsage )
+		self.assertEqual(
+			Gaffer.ValuePlug.cacheMemoryUsage(),
+			Gaffer.ValuePlug.cachePartitionMemoryUsage( "" ) + partitionUsage
+		)
+
+		# Pressure on the default partition doesn't evict values from
+		# the named partition.
+
+		Gaffer.ValuePlug.setCacheMemoryLimit( 0 )
+		self.assertEqual( Gaffer.ValuePlug.cachePartitionMemoryUsage( "" ), 0 )
+		self.assertEqual( Gaffer.ValuePlug.cachePartitionMemoryUsage( partition ), partitionUsage )
+
+		with Gaffer.PerformanceMonitor() as monitor :
+			self.assertEqual( partitionedNode["out"].getValue(), IECore.StringData( "partitioned" ) )
+		self.assertEqual( monitor.plugStatistics( partitionedNode["out"] ).computeCount, 0 )
+
+		# And vice versa.
+
+		Gaffer.ValuePlug.setCacheMemoryLimit( self.__originalCacheMemoryLimit )
+		Gaffer.ValuePlug.setCachePartitionMemoryLimit( partition, 0 )
+		self.assertEqual( Gaffer.ValuePlug.cachePartitionMemoryUsage( partition ), 0 )
+		self.assertEqual( defaultNode["out"].getValue(), IECore.StringData( "default" ) )
+		self.assertGreater( Gaffer.ValuePlug.cachePartitionMemoryUsage( "" ), 0 )
+
+		# Eviction policy is shared by all partitions, and `clearCache()`
+		# clears them all.
+
+		Gaffer.ValuePlug.setCachePartitionMemoryLimit( partition, 1024 * 1024 )
+		Gaffer.ValuePlug.setCacheEvictionPolicy( Gaffer.ValuePlug.CacheEvictionPolicy.CostAware )
+		partitionedNode["in"].setValue( "partitioned2" )
+		self.assertEqual( partitionedNode["out"].getValue(), IECore.StringData( "partitioned2" ) )
+		self.assertGreater( Gaffer.ValuePlug.cachePartitionMemoryUsage( partition ), 0 )
+
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( Gaffer.ValuePlug.cacheMemoryUsage(), 0 )
+		self.assertEqual( Gaffer.ValuePlug.cachePartitionMemoryUsage( partition ), 0 )
+
 	def setUp( self ) :
 
 		GafferTest.TestCase.setUp( self )
 
 		self.__originalCacheMemoryLimit = Gaffer.ValuePlug.getCacheMemoryLimit()
+		self.__originalCacheEvictionPolicy = Gaffer.ValuePlug.getCacheEvictionPolicy()
+		self.__originalDiskCacheDirectory = Gaffer.ValuePlug.getDiskCacheDirectory()
+		self.__originalDiskCacheSizeLimit = Gaffer.ValuePlug.getDiskCacheSizeLimit()
+		self.__originalDiskCacheMinimumComputeTime = Gaffer.ValuePlug.getDiskCacheMinimumComputeTime()
 
 	def tearDown( self ) :
 
 		GafferTest.TestCase.tearDown( self )
 
 		Gaffer.ValuePlug.setCacheMemoryLimit( self.__originalCacheMemoryLimit )
+		Gaffer.ValuePlug.setCacheEvictionPolicy( self.__originalCacheEvictionPolicy )
+		Gaffer.ValuePlug.setDiskCacheDirectory( self.__originalDiskCacheDirectory )
+		Gaffer.ValuePlug.setDiskCacheSizeLimit( self.__originalDiskCacheSizeLimit )
+		Gaffer.ValuePlug.setDiskCacheMinimumComputeTime( self.__originalDiskCacheMinimumComputeTime )
 
 if __name__ == "__main__":
 	unittest.main()
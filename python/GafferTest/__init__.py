@@ -160,8 +160,10 @@ from .HiddenFilePathFilterTest import HiddenFilePathFilterTest
 from .ContextVariableTweaksTest import ContextVariableTweaksTest
 from .OptionalValuePlugTest import OptionalValuePlugTest
 from .ThreadMonitorTest import ThreadMonitorTest
+from .TraceMonitorTest import TraceMonitorTest
 from .CollectTest import CollectTest
 from .ProcessTest import ProcessTest
+from .ConcurrentCacheTest import ConcurrentCacheTest
 
 from .IECorePreviewTest import *
 
@@ -149,7 +149,7 @@ ActiveTasks &activeTasks()
 struct BackgroundTask::TaskData : public boost::noncopyable
 {
 	TaskData( Function *function )
-		:	function( function ), status( Pending )
+		:	function( function ), status( Pending ), registered( false )
 	{
 	}
 
@@ -158,6 +158,8 @@ struct BackgroundTask::TaskData : public boost::noncopyable
 	std::mutex mutex; // Protects `conditionVariable` and `status`
 	std::condition_variable conditionVariable;
 	Status status;
+	// True if the task is in `activeTasks()`.
+	bool registered;
 };
 
 BackgroundTask::BackgroundTask( const Plug *subject, const Function &function )
@@ -169,7 +171,15 @@ BackgroundTask::BackgroundTask( const Plug *subject, const Function &function )
 		IECore::msg( IECore::Msg::Level::Warning, "BackgroundTask", fmt::format( "Unable to find ScriptNode for {}", subject->fullName() ) );
 	}
 
-	activeTasks().insert( ActiveTask{ this, s } );
+	// Tasks are only registered if they have a ScriptNode, since otherwise
+	// they could never be cancelled by `cancelAffectedTasks()`. This also
+	// allows tasks without a subject to be launched from any thread, since
+	// they never access the (unsynchronised) `activeTasks()` container.
+	if( s )
+	{
+		activeTasks().insert( ActiveTask{ this, s } );
+		m_taskData->registered = true;
+	}
 
 	// Enqueue task into current arena.
 	tbb::task_arena( tbb::task_arena::attach() ).enqueue(
@@ -262,7 +272,10 @@ void BackgroundTask::wait()
 			}
 		}
 	);
-	activeTasks().erase( this );
+	if( m_taskData->registered )
+	{
+		activeTasks().erase( this );
+	}
 }
 
 bool BackgroundTask::waitFor( float seconds )
@@ -290,7 +303,7 @@ bool BackgroundTask::waitFor( float seconds )
 		}
 	);
 
-	if( completed )
+	if( completed && m_taskData->registered )
 	{
 		activeTasks().erase( this );
 	}
@@ -91,3 +91,8 @@ ValuePlug::CachePolicy ComputeNode::computeCachePolicy( const ValuePlug *output
 	}
 	return ValuePlug::CachePolicy::Default;
 }
+
+IECore::InternedString ComputeNode::computeCachePartition( const ValuePlug *output ) const
+{
+	return IECore::InternedString();
+}
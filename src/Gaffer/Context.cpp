@@ -229,7 +229,7 @@ static InternedString g_frame( "frame" );
 static InternedString g_framesPerSecond( "framesPerSecond" );
 
 Context::Context()
-	:	m_changedSignal( nullptr ), m_hashValid( false ), m_canceller( nullptr )
+	:	m_changedSignal( nullptr ), m_hash( 0, 0 ), m_canceller( nullptr )
 {
 	set( g_frame, 1.0f );
 	set( g_framesPerSecond, 24.0f );
@@ -242,24 +242,24 @@ Context::Context( const Context &other )
 
 Context::Context( const Context &other, CopyMode mode )
 	:	m_changedSignal( nullptr ),
-		m_hash( other.m_hash ),
-		m_hashValid( other.m_hashValid ),
+		m_hash( 0, 0 ),
 		m_canceller( other.m_canceller )
 {
 	// Reserving one extra spot before we copy in the existing variables means that we will
 	// avoid a second allocation in the common case where we set exactly one context
-	// variable. Perhaps we should reserve two extra spots - though that is some extra memory
-	// to carry around in cases where we don't add any variables?
+	// variable. This is a no-op when the variables fit in the inline storage of `m_map`.
 	m_map.reserve( other.m_map.size() + 1 );
 
 	if( mode == CopyMode::NonOwning )
 	{
 		m_map = other.m_map;
+		m_hash = other.m_hash;
 	}
 	else
 	{
 		// We need ownership of the stored values so that we remain valid even
-		// if the source context is destroyed.
+		// if the source context is destroyed. Note that `m_hash` is accumulated
+		// by `internalSetWithOwner()` as we go.
 		m_allocMap.reserve( other.m_map.size() + 1 );
 		for( auto &i : other.m_map )
 		{
@@ -335,8 +335,8 @@ void Context::remove( const IECore::InternedString &name )
 	Map::iterator it = m_map.find( name );
 	if( it != m_map.end() )
 	{
+		updateHash( it->second.hash(), MurmurHash( 0, 0 ) );
 		m_map.erase( it );
-		m_hashValid = false;
 		if( m_changedSignal )
 		{
 			(*m_changedSignal)( this, name );
@@ -355,8 +355,8 @@ void Context::removeMatching( const StringAlgo::MatchPattern &pattern )
 	{
 		if( StringAlgo::matchMultiple( it->first, pattern ) )
 		{
+			updateHash( it->second.hash(), MurmurHash( 0, 0 ) );
 			it = m_map.erase( it );
-			m_hashValid = false;
 			if( m_changedSignal )
 			{
 				(*m_changedSignal)( this, it->first );
@@ -422,25 +422,6 @@ Context::ChangedSignal &Context::changedSignal()
 	return *m_changedSignal;
 }
 
-IECore::MurmurHash Context::hash() const
-{
-	if( m_hashValid )
-	{
-		return m_hash;
-	}
-
-	uint64_t sumH1 = 0, sumH2 = 0;
-	for( Map::const_iterator it = m_map.begin(), eIt = m_map.end(); it != eIt; ++it )
-	{
-		sumH1 += it->second.hash().h1();
-		sumH2 += it->second.hash().h2();
-	}
-
-	m_hash = MurmurHash( sumH1, sumH2 );
-	m_hashValid = true;
-	return m_hash;
-}
-
 bool Context::operator == ( const Context &other ) const
 {
 	return m_map == other.m_map;
@@ -0,0 +1,272 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+
+#include "Gaffer/Private/DiskCache.h"
+
+#include "IECore/MemoryIndexedIO.h"
+#include "IECore/VectorTypedData.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <random>
+
+using namespace IECore;
+using namespace Gaffer::Private;
+
+//////////////////////////////////////////////////////////////////////////
+// Internal utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+const std::string g_extension = ".cache";
+
+size_t costFunction( size_t fileSize )
+{
+	return fileSize;
+}
+
+void removeFile( const std::filesystem::path &path )
+{
+	std::error_code ec;
+	std::filesystem::remove( path, ec );
+}
+
+// Generates names for temporary files which are unique across all
+// processes sharing a cache directory.
+std::string temporarySuffix()
+{
+	static const unsigned processToken = std::random_device()();
+	static std::atomic_size_t g_count( 0 );
+	return fmt::format( ".{:x}.{}.tmp", processToken, g_count++ );
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// DiskCache
+//////////////////////////////////////////////////////////////////////////
+
+DiskCache::DiskCache( const std::filesystem::path &directory, size_t maxCost )
+	:	m_directory( directory ),
+		m_index(
+			Index::GetterFunction(), maxCost,
+			[this] ( const MurmurHash &key, size_t fileSize ) { removeFile( entryPath( key ) ); },
+			/* cacheErrors = */ false
+		)
+{
+	std::filesystem::create_directories( m_directory );
+
+	// Adopt entries written previously, oldest first, so that they
+	// count towards our limit, are the first to be evicted, and can be
+	// found by `get()` without searching the filesystem.
+
+	std::vector<std::pair<std::filesystem::file_time_type, std::filesystem::path>> entries;
+	for( const auto &entry : std::filesystem::recursive_directory_iterator( m_directory ) )
+	{
+		if( entry.is_regular_file() && entry.path().extension() == g_extension )
+		{
+			entries.push_back( { entry.last_write_time(), entry.path() } );
+		}
+	}
+	std::sort( entries.begin(), entries.end() );
+
+	for( const auto &[time, path] : entries )
+	{
+		MurmurHash key;
+		try
+		{
+			key = MurmurHash::fromString( path.stem().string() );
+		}
+		catch( ... )
+		{
+			// Not one of ours.
+			continue;
+		}
+		std::error_code ec;
+		const size_t fileSize = std::filesystem::file_size( path, ec );
+		if( !ec )
+		{
+			m_index.setIfUncached( key, fileSize, costFunction );
+		}
+	}
+}
+
+DiskCache::~DiskCache()
+{
+}
+
+const std::filesystem::path &DiskCache::directory() const
+{
+	return m_directory;
+}
+
+IECore::ConstObjectPtr DiskCache::get( const IECore::MurmurHash &key, size_t &bytesRead, bool searchUnindexed )
+{
+	bytesRead = 0;
+
+	if( !searchUnindexed && !m_index.cached( key ) )
+	{
+		return nullptr;
+	}
+
+	const std::filesystem::path path = entryPath( key );
+	std::ifstream file( path, std::ios::binary | std::ios::ate );
+	if( !file )
+	{
+		// Either never written, or evicted by another process.
+		m_index.erase( key );
+		return nullptr;
+	}
+
+	const std::streamsize fileSize = file.tellg();
+	file.seekg( 0 );
+
+	CharVectorDataPtr buffer = new CharVectorData;
+	buffer->writable().resize( fileSize );
+	if( !file.read( buffer->writable().data(), fileSize ) )
+	{
+		return nullptr;
+	}
+
+	ObjectPtr result;
+	try
+	{
+		MemoryIndexedIOPtr io = new MemoryIndexedIO( buffer, {}, IndexedIO::Read );
+		result = Object::load( io, "o" );
+	}
+	catch( ... )
+	{
+		// Unloadable entry. Remove it so we don't pay to read it again.
+		m_index.erase( key );
+		removeFile( path );
+		return nullptr;
+	}
+
+	// Mark as recently used, adopting the entry if it was written
+	// by another process.
+	if( !m_index.getIfCached( key ) )
+	{
+		m_index.setIfUncached( key, fileSize, costFunction );
+	}
+
+	bytesRead = fileSize;
+	return result;
+}
+
+size_t DiskCache::set( const IECore::MurmurHash &key, const IECore::Object *object )
+{
+	if( m_index.cached( key ) || !Object::isType( object->typeId() ) )
+	{
+		// Either we have it already, or we have no way of loading it again.
+		return 0;
+	}
+
+	MemoryIndexedIOPtr io = new MemoryIndexedIO( nullptr, {}, IndexedIO::Write );
+	try
+	{
+		object->save( io, "o" );
+	}
+	catch( ... )
+	{
+		return 0;
+	}
+
+	ConstCharVectorDataPtr buffer = io->buffer();
+	const std::vector<char> &bytes = buffer->readable();
+
+	// Write to a temporary file and rename it into place, so that
+	// other processes never see a partially written entry.
+
+	const std::filesystem::path path = entryPath( key );
+	const std::filesystem::path temporaryPath = path.string() + temporarySuffix();
+
+	std::error_code ec;
+	std::filesystem::create_directories( path.parent_path(), ec );
+
+	{
+		std::ofstream file( temporaryPath, std::ios::binary );
+		file.write( bytes.data(), bytes.size() );
+		if( !file )
+		{
+			file.close();
+			std::filesystem::remove( temporaryPath, ec );
+			return 0;
+		}
+	}
+
+	std::filesystem::rename( temporaryPath, path, ec );
+	if( ec )
+	{
+		std::filesystem::remove( temporaryPath, ec );
+		return 0;
+	}
+
+	m_index.setIfUncached( key, bytes.size(), costFunction );
+	return bytes.size();
+}
+
+void DiskCache::setMaxCost( size_t maxCost )
+{
+	m_index.setMaxCost( maxCost );
+}
+
+size_t DiskCache::getMaxCost() const
+{
+	return m_index.getMaxCost();
+}
+
+size_t DiskCache::currentCost() const
+{
+	return m_index.currentCost();
+}
+
+void DiskCache::clear()
+{
+	m_index.clear();
+}
+
+std::filesystem::path DiskCache::entryPath( const IECore::MurmurHash &key ) const
+{
+	// Shard into subdirectories to keep directory sizes manageable.
+	const std::string name = key.toString();
+	return m_directory / name.substr( 0, 2 ) / ( name + g_extension );
+}
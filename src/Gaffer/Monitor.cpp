@@ -119,6 +119,10 @@ const Monitor::MonitorSet &Monitor::current()
 	return *ThreadState::current().m_monitors;
 }
 
+void Monitor::cacheEvent( const Process *process, CacheEvent event, size_t bytes )
+{
+}
+
 
 bool Monitor::mightForceMonitoring()
 {
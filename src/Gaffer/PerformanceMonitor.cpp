@@ -49,8 +49,12 @@ static PerformanceMonitor::Statistics g_emptyStatistics;
 // PerformanceMonitor::Statistics
 //////////////////////////////////////////////////////////////////////////
 
-PerformanceMonitor::Statistics::Statistics( size_t hashCount, size_t computeCount, boost::chrono::nanoseconds hashDuration, boost::chrono::nanoseconds computeDuration )
-	:	hashCount( hashCount ), computeCount( computeCount ), hashDuration( hashDuration ), computeDuration( computeDuration )
+PerformanceMonitor::Statistics::Statistics(
+	size_t hashCount, size_t computeCount, boost::chrono::nanoseconds hashDuration, boost::chrono::nanoseconds computeDuration,
+	size_t diskCacheHits, size_t diskCacheMisses, size_t diskCacheBytesRead, size_t diskCacheBytesWritten
+)
+	:	hashCount( hashCount ), computeCount( computeCount ), hashDuration( hashDuration ), computeDuration( computeDuration ),
+		diskCacheHits( diskCacheHits ), diskCacheMisses( diskCacheMisses ), diskCacheBytesRead( diskCacheBytesRead ), diskCacheBytesWritten( diskCacheBytesWritten )
 {
 }
 
@@ -60,6 +64,10 @@ PerformanceMonitor::Statistics & PerformanceMonitor::Statistics::operator += ( c
 	computeCount += rhs.computeCount;
 	hashDuration += rhs.hashDuration;
 	computeDuration += rhs.computeDuration;
+	diskCacheHits += rhs.diskCacheHits;
+	diskCacheMisses += rhs.diskCacheMisses;
+	diskCacheBytesRead += rhs.diskCacheBytesRead;
+	diskCacheBytesWritten += rhs.diskCacheBytesWritten;
 	return *this;
 }
 
@@ -69,7 +77,11 @@ bool PerformanceMonitor::Statistics::operator == ( const Statistics &rhs )
 		hashCount == rhs.hashCount &&
 		computeCount == rhs.computeCount &&
 		hashDuration == rhs.hashDuration &&
-		computeDuration == rhs.computeDuration
+		computeDuration == rhs.computeDuration &&
+		diskCacheHits == rhs.diskCacheHits &&
+		diskCacheMisses == rhs.diskCacheMisses &&
+		diskCacheBytesRead == rhs.diskCacheBytesRead &&
+		diskCacheBytesWritten == rhs.diskCacheBytesWritten
 	;
 }
 
@@ -159,6 +171,24 @@ void PerformanceMonitor::processFinished( const Process *process )
 	threadData.then = now;
 }
 
+void PerformanceMonitor::cacheEvent( const Process *process, CacheEvent event, size_t bytes )
+{
+	Statistics &s = m_threadData.local().statistics[process->plug()];
+	switch( event )
+	{
+		case CacheEvent::DiskCacheHit :
+			s.diskCacheHits++;
+			s.diskCacheBytesRead += bytes;
+			break;
+		case CacheEvent::DiskCacheMiss :
+			s.diskCacheMisses++;
+			break;
+		case CacheEvent::DiskCacheWrite :
+			s.diskCacheBytesWritten += bytes;
+			break;
+	}
+}
+
 void PerformanceMonitor::collate() const
 {
 	tbb::enumerable_thread_specific<ThreadData, tbb::cache_aligned_allocator<ThreadData>, tbb::ets_key_per_instance>::iterator it, eIt;
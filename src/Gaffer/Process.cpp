@@ -155,6 +155,14 @@ const Process *Process::current()
 	return ThreadState::current().m_process;
 }
 
+void Process::cacheEvent( Monitor::CacheEvent event, size_t bytes ) const
+{
+	for( const auto &m : *m_threadState->m_monitors )
+	{
+		m->cacheEvent( this, event, bytes );
+	}
+}
+
 void Process::handleException() const
 {
 	try
@@ -0,0 +1,580 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "Gaffer/TraceMonitor.h"
+
+#include "Gaffer/Context.h"
+#include "Gaffer/Plug.h"
+#include "Gaffer/Process.h"
+#include "Gaffer/ScriptNode.h"
+#include "Gaffer/ThreadMonitor.h"
+
+#include "IECore/Exception.h"
+
+#include "boost/algorithm/string/predicate.hpp"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <fstream>
+#include <unordered_map>
+
+using namespace std;
+using namespace IECore;
+using namespace Gaffer;
+
+//////////////////////////////////////////////////////////////////////////
+// Internal utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+// A process, reconstructed from the start and finish events recorded
+// for it.
+struct Slice
+{
+	Clock::time_point start;
+	Clock::time_point end;
+	const Plug *plug;
+	InternedString processType;
+	MurmurHash contextHash;
+	const char *cacheResult;
+	// True if the start event was discarded from the buffer, in which
+	// case `start` is the time of the first event in the buffer.
+	bool truncated;
+};
+
+// A disk cache access.
+struct Instant
+{
+	Clock::time_point time;
+	const char *name;
+	size_t bytes;
+};
+
+struct ThreadTrace
+{
+	int id;
+	vector<Slice> slices;
+	vector<Instant> instants;
+};
+
+const char *g_miss = "miss";
+const char *g_diskCacheHit = "diskCacheHit";
+
+// Minimal encoder for the protobuf wire format, sufficient for writing
+// Perfetto traces without a dependency on the protobuf library.
+class ProtobufWriter
+{
+
+	public :
+
+		void varint( uint32_t field, uint64_t value )
+		{
+			key( field, 0 );
+			writeVarint( value );
+		}
+
+		void string( uint32_t field, const std::string &value )
+		{
+			key( field, 2 );
+			writeVarint( value.size() );
+			m_data += value;
+		}
+
+		void message( uint32_t field, const ProtobufWriter &message )
+		{
+			string( field, message.m_data );
+		}
+
+		const std::string &data() const
+		{
+			return m_data;
+		}
+
+	private :
+
+		void key( uint32_t field, uint32_t wireType )
+		{
+			writeVarint( ( field << 3 ) | wireType );
+		}
+
+		void writeVarint( uint64_t value )
+		{
+			while( value >= 0x80 )
+			{
+				m_data.push_back( static_cast<char>( ( value & 0x7f ) | 0x80 ) );
+				value >>= 7;
+			}
+			m_data.push_back( static_cast<char>( value ) );
+		}
+
+		std::string m_data;
+
+};
+
+// Field numbers from Perfetto's `trace_packet.proto` and `track_event.proto`.
+namespace Perfetto
+{
+
+const uint32_t g_tracePacket = 1;
+
+const uint32_t g_packetTimestamp = 8;
+const uint32_t g_packetSequenceId = 10;
+const uint32_t g_packetTrackEvent = 11;
+const uint32_t g_packetSequenceFlags = 13;
+const uint32_t g_packetTrackDescriptor = 60;
+
+const uint32_t g_trackDescriptorUUID = 1;
+const uint32_t g_trackDescriptorName = 2;
+
+const uint32_t g_trackEventDebugAnnotations = 4;
+const uint32_t g_trackEventType = 9;
+const uint32_t g_trackEventTrackUUID = 11;
+const uint32_t g_trackEventCategories = 22;
+const uint32_t g_trackEventName = 23;
+
+const uint32_t g_debugAnnotationBoolValue = 2;
+const uint32_t g_debugAnnotationUIntValue = 3;
+const uint32_t g_debugAnnotationStringValue = 6;
+const uint32_t g_debugAnnotationName = 10;
+
+const uint64_t g_typeSliceBegin = 1;
+const uint64_t g_typeSliceEnd = 2;
+const uint64_t g_typeInstant = 3;
+
+const uint64_t g_incrementalStateCleared = 1;
+
+const uint32_t g_sequenceId = 1;
+
+} // namespace Perfetto
+
+std::string escapeJSON( const std::string &s )
+{
+	std::string result;
+	result.reserve( s.size() );
+	for( char c : s )
+	{
+		switch( c )
+		{
+			case '"' :
+				result += "\\\"";
+				break;
+			case '\\' :
+				result += "\\\\";
+				break;
+			default :
+				if( static_cast<unsigned char>( c ) < 0x20 )
+				{
+					result += fmt::format( "\\u{:04x}", static_cast<unsigned char>( c ) );
+				}
+				else
+				{
+					result.push_back( c );
+				}
+		}
+	}
+	return result;
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// TraceMonitor
+//////////////////////////////////////////////////////////////////////////
+
+TraceMonitor::ThreadData::ThreadData()
+	:	id( ThreadMonitor::thisThreadId() ), next( 0 ), discarded( 0 )
+{
+}
+
+TraceMonitor::TraceMonitor( size_t maxEventsPerThread )
+	:	m_maxEventsPerThread( std::max<size_t>( maxEventsPerThread, 1 ) ), m_startTime( Clock::now() )
+{
+}
+
+TraceMonitor::~TraceMonitor()
+{
+}
+
+size_t TraceMonitor::numEvents() const
+{
+	size_t result = 0;
+	for( const auto &threadData : m_threadData )
+	{
+		result += threadData.events.size();
+	}
+	return result;
+}
+
+size_t TraceMonitor::numDiscardedEvents() const
+{
+	size_t result = 0;
+	for( const auto &threadData : m_threadData )
+	{
+		result += threadData.discarded;
+	}
+	return result;
+}
+
+void TraceMonitor::processStarted( const Process *process )
+{
+	record( process, Event::Type::ProcessStarted );
+}
+
+void TraceMonitor::processFinished( const Process *process )
+{
+	record( process, Event::Type::ProcessFinished );
+}
+
+void TraceMonitor::cacheEvent( const Process *process, CacheEvent event, size_t bytes )
+{
+	switch( event )
+	{
+		case CacheEvent::DiskCacheHit :
+			record( process, Event::Type::DiskCacheHit, bytes );
+			break;
+		case CacheEvent::DiskCacheMiss :
+			record( process, Event::Type::DiskCacheMiss, bytes );
+			break;
+		case CacheEvent::DiskCacheWrite :
+			record( process, Event::Type::DiskCacheWrite, bytes );
+			break;
+	}
+}
+
+void TraceMonitor::record( const Process *process, Event::Type type, size_t bytes )
+{
+	ThreadData &threadData = m_threadData.local();
+
+	const Plug *plug = process->plug();
+	if( threadData.plugs.insert( plug ).second )
+	{
+		threadData.plugOwners.push_back( plug );
+	}
+
+	Event event;
+	event.type = type;
+	event.time = Clock::now();
+	event.plug = plug;
+	event.processType = process->type();
+	event.bytes = bytes;
+	if( type == Event::Type::ProcessStarted || type == Event::Type::ProcessFinished )
+	{
+		event.contextHash = process->context()->hash();
+	}
+
+	if( threadData.events.size() < m_maxEventsPerThread )
+	{
+		threadData.events.push_back( event );
+	}
+	else
+	{
+		threadData.events[threadData.next] = event;
+		threadData.discarded++;
+	}
+	threadData.next = ( threadData.next + 1 ) % m_maxEventsPerThread;
+}
+
+void TraceMonitor::writeTrace( const std::string &fileName ) const
+{
+	Format format;
+	if( boost::ends_with( fileName, ".json" ) )
+	{
+		format = Format::Chrome;
+	}
+	else if( boost::ends_with( fileName, ".pftrace" ) )
+	{
+		format = Format::Perfetto;
+	}
+	else
+	{
+		throw IECore::Exception( fmt::format( "Unsupported trace file extension for \"{}\". Use \".json\" or \".pftrace\"", fileName ) );
+	}
+
+	std::ofstream stream( fileName, std::ios::binary );
+	if( !stream )
+	{
+		throw IECore::Exception( fmt::format( "Unable to open trace file \"{}\"", fileName ) );
+	}
+
+	writeTrace( stream, format );
+}
+
+void TraceMonitor::writeTrace( std::ostream &stream, Format format ) const
+{
+	// Reconstruct the processes for each thread, by matching start and
+	// finish events. Processes on a single thread are strictly nested, so
+	// this is just a matter of maintaining a stack.
+
+	vector<ThreadTrace> threadTraces;
+	for( const auto &threadData : m_threadData )
+	{
+		ThreadTrace trace;
+		trace.id = threadData.id;
+
+		const size_t numEvents = threadData.events.size();
+		const size_t first = numEvents < m_maxEventsPerThread ? 0 : threadData.next;
+
+		vector<Slice> stack;
+		for( size_t i = 0; i < numEvents; ++i )
+		{
+			const Event &event = threadData.events[(first + i) % numEvents];
+			switch( event.type )
+			{
+				case Event::Type::ProcessStarted :
+					stack.push_back( { event.time, event.time, event.plug, event.processType, event.contextHash, g_miss, false } );
+					break;
+				case Event::Type::ProcessFinished :
+					if( stack.size() )
+					{
+						Slice &slice = stack.back();
+						slice.end = event.time;
+						trace.slices.push_back( slice );
+						stack.pop_back();
+					}
+					else
+					{
+						// Start was discarded from the buffer.
+						trace.slices.push_back( {
+							threadData.events[first].time, event.time, event.plug, event.processType, event.contextHash, g_miss, true
+						} );
+					}
+					break;
+				case Event::Type::DiskCacheHit :
+					if( stack.size() )
+					{
+						stack.back().cacheResult = g_diskCacheHit;
+					}
+					trace.instants.push_back( { event.time, "diskCacheHit", event.bytes } );
+					break;
+				case Event::Type::DiskCacheMiss :
+					trace.instants.push_back( { event.time, "diskCacheMiss", event.bytes } );
+					break;
+				case Event::Type::DiskCacheWrite :
+					trace.instants.push_back( { event.time, "diskCacheWrite", event.bytes } );
+					break;
+			}
+		}
+
+		// Order slices so that parents precede their children.
+		std::sort(
+			trace.slices.begin(), trace.slices.end(),
+			[] ( const Slice &a, const Slice &b ) {
+				return a.start < b.start || ( a.start == b.start && a.end > b.end );
+			}
+		);
+
+		threadTraces.push_back( std::move( trace ) );
+	}
+
+	std::sort(
+		threadTraces.begin(), threadTraces.end(),
+		[] ( const ThreadTrace &a, const ThreadTrace &b ) { return a.id < b.id; }
+	);
+
+	// Plug names are computed once only, as they are relatively expensive.
+
+	std::unordered_map<const Plug *, std::string> plugNames;
+	auto plugName = [&plugNames] ( const Plug *plug ) -> const std::string & {
+		auto inserted = plugNames.try_emplace( plug );
+		if( inserted.second )
+		{
+			inserted.first->second = plug->relativeName( plug->ancestor<ScriptNode>() );
+		}
+		return inserted.first->second;
+	};
+
+	auto timestamp = [this] ( Clock::time_point t ) {
+		return std::chrono::duration_cast<std::chrono::nanoseconds>( t - m_startTime ).count();
+	};
+
+	if( format == Format::Chrome )
+	{
+		stream << "{\"traceEvents\":[\n";
+		bool firstEvent = true;
+		auto separator = [&firstEvent] () {
+			const char *result = firstEvent ? "" : ",\n";
+			firstEvent = false;
+			return result;
+		};
+
+		for( const auto &trace : threadTraces )
+		{
+			stream << separator() << fmt::format(
+				"{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{0},\"args\":{{\"name\":\"Thread {0}\"}}}}",
+				trace.id
+			);
+
+			for( const auto &slice : trace.slices )
+			{
+				stream << separator() << fmt::format(
+					"{{\"name\":\"{}\",\"cat\":\"{}\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":1,\"tid\":{},"
+					"\"args\":{{\"contextHash\":\"{}\",\"cache\":\"{}\"{}}}}}",
+					escapeJSON( plugName( slice.plug ) ), escapeJSON( slice.processType.string() ),
+					timestamp( slice.start ) / 1000.0, ( timestamp( slice.end ) - timestamp( slice.start ) ) / 1000.0,
+					trace.id, slice.contextHash.toString(), slice.cacheResult,
+					slice.truncated ? ",\"truncated\":true" : ""
+				);
+			}
+
+			for( const auto &instant : trace.instants )
+			{
+				stream << separator() << fmt::format(
+					"{{\"name\":\"{}\",\"cat\":\"cache\",\"ph\":\"i\",\"s\":\"t\",\"ts\":{:.3f},\"pid\":1,\"tid\":{},\"args\":{{\"bytes\":{}}}}}",
+					instant.name, timestamp( instant.time ) / 1000.0, trace.id, instant.bytes
+				);
+			}
+		}
+
+		stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+		return;
+	}
+
+	// Perfetto
+
+	bool firstPacket = true;
+	auto writePacket = [&stream, &firstPacket] ( ProtobufWriter &packet ) {
+		packet.varint( Perfetto::g_packetSequenceId, Perfetto::g_sequenceId );
+		if( firstPacket )
+		{
+			packet.varint( Perfetto::g_packetSequenceFlags, Perfetto::g_incrementalStateCleared );
+			firstPacket = false;
+		}
+		ProtobufWriter trace;
+		trace.message( Perfetto::g_tracePacket, packet );
+		stream.write( trace.data().data(), trace.data().size() );
+	};
+
+	auto stringAnnotation = [] ( ProtobufWriter &event, const std::string &name, const std::string &value ) {
+		ProtobufWriter annotation;
+		annotation.string( Perfetto::g_debugAnnotationName, name );
+		annotation.string( Perfetto::g_debugAnnotationStringValue, value );
+		event.message( Perfetto::g_trackEventDebugAnnotations, annotation );
+	};
+
+	for( const auto &trace : threadTraces )
+	{
+		const uint64_t uuid = trace.id + 1;
+		{
+			ProtobufWriter descriptor;
+			descriptor.varint( Perfetto::g_trackDescriptorUUID, uuid );
+			descriptor.string( Perfetto::g_trackDescriptorName, fmt::format( "Thread {}", trace.id ) );
+			ProtobufWriter packet;
+			packet.message( Perfetto::g_packetTrackDescriptor, descriptor );
+			writePacket( packet );
+		}
+
+		// Interleave begin, end and instant events in time order.
+
+		auto writeEnd = [&] ( Clock::time_point t ) {
+			ProtobufWriter event;
+			event.varint( Perfetto::g_trackEventType, Perfetto::g_typeSliceEnd );
+			event.varint( Perfetto::g_trackEventTrackUUID, uuid );
+			ProtobufWriter packet;
+			packet.varint( Perfetto::g_packetTimestamp, timestamp( t ) );
+			packet.message( Perfetto::g_packetTrackEvent, event );
+			writePacket( packet );
+		};
+
+		auto instantIt = trace.instants.begin();
+		auto writeInstants = [&] ( Clock::time_point t ) {
+			for( ; instantIt != trace.instants.end() && instantIt->time < t; ++instantIt )
+			{
+				ProtobufWriter event;
+				event.varint( Perfetto::g_trackEventType, Perfetto::g_typeInstant );
+				event.varint( Perfetto::g_trackEventTrackUUID, uuid );
+				event.string( Perfetto::g_trackEventCategories, "cache" );
+				event.string( Perfetto::g_trackEventName, instantIt->name );
+				ProtobufWriter annotation;
+				annotation.string( Perfetto::g_debugAnnotationName, "bytes" );
+				annotation.varint( Perfetto::g_debugAnnotationUIntValue, instantIt->bytes );
+				event.message( Perfetto::g_trackEventDebugAnnotations, annotation );
+				ProtobufWriter packet;
+				packet.varint( Perfetto::g_packetTimestamp, timestamp( instantIt->time ) );
+				packet.message( Perfetto::g_packetTrackEvent, event );
+				writePacket( packet );
+			}
+		};
+
+		vector<const Slice *> stack;
+		for( const auto &slice : trace.slices )
+		{
+			while( stack.size() && stack.back()->end <= slice.start )
+			{
+				writeInstants( stack.back()->end );
+				writeEnd( stack.back()->end );
+				stack.pop_back();
+			}
+
+			writeInstants( slice.start );
+
+			ProtobufWriter event;
+			event.varint( Perfetto::g_trackEventType, Perfetto::g_typeSliceBegin );
+			event.varint( Perfetto::g_trackEventTrackUUID, uuid );
+			event.string( Perfetto::g_trackEventCategories, slice.processType.string() );
+			event.string( Perfetto::g_trackEventName, plugName( slice.plug ) );
+			stringAnnotation( event, "contextHash", slice.contextHash.toString() );
+			stringAnnotation( event, "cache", slice.cacheResult );
+			if( slice.truncated )
+			{
+				ProtobufWriter annotation;
+				annotation.string( Perfetto::g_debugAnnotationName, "truncated" );
+				annotation.varint( Perfetto::g_debugAnnotationBoolValue, 1 );
+				event.message( Perfetto::g_trackEventDebugAnnotations, annotation );
+			}
+
+			ProtobufWriter packet;
+			packet.varint( Perfetto::g_packetTimestamp, timestamp( slice.start ) );
+			packet.message( Perfetto::g_packetTrackEvent, event );
+			writePacket( packet );
+
+			stack.push_back( &slice );
+		}
+
+		while( stack.size() )
+		{
+			writeInstants( stack.back()->end );
+			writeEnd( stack.back()->end );
+			stack.pop_back();
+		}
+
+		writeInstants( Clock::time_point::max() );
+	}
+}
@@ -40,6 +40,8 @@
 #include "Gaffer/Action.h"
 #include "Gaffer/ComputeNode.h"
 #include "Gaffer/Context.h"
+#include "Gaffer/Private/ConcurrentCache.h"
+#include "Gaffer/Private/DiskCache.h"
 #include "Gaffer/Private/IECorePreview/LRUCache.h"
 #include "Gaffer/Process.h"
 
@@ -47,11 +49,16 @@
 
 #include "boost/bind/bind.hpp"
 
-#include "tbb/enumerable_thread_specific.h"
+#include "tbb/concurrent_unordered_set.h"
+#include "tbb/spin_rw_mutex.h"
 
 #include "fmt/format.h"
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <memory>
+#include <unordered_map>
 #include <unordered_set>
 
 using namespace Gaffer;
@@ -224,21 +231,7 @@ class ValuePlug::HashProcess : public Process
 				return HashProcess( p, plug, computeNode ).run();
 			}
 
-			// Perform any pending adjustments to our thread-local cache.
-
-			ThreadData &threadData = g_threadData.local();
-			if( threadData.clearCache.load( std::memory_order_acquire ) )
-			{
-				threadData.cache.clear();
-				threadData.clearCache.store( 0, std::memory_order_release );
-			}
-
-			if( threadData.cache.getMaxCost() != g_cacheSizeLimit )
-			{
-				threadData.cache.setMaxCost( g_cacheSizeLimit );
-			}
-
-			// Then get our hash. We do this using this `acquireHash()` functor so that
+			// Get our hash. We do this using this `acquireHash()` functor so that
 			// we can repeat the process for `Checked` mode.
 
 			const bool forceMonitoring = Process::forceMonitoring( threadState, plug, staticType );
@@ -254,41 +247,28 @@ class ValuePlug::HashProcess : public Process
 					throw IECore::Exception(  "Dirty count exceeded max. Either you've left Gaffer running for 100 million years, or a strange bug is incrementing dirty counts way too fast." );
 				}
 
-				// Check for an already-cached value in our thread-local cache, and return it if we have one.
+				// Check for an already-cached value, and return it if we have one.
 				if( !forceMonitoring )
 				{
-					if( auto result = threadData.cache.getIfCached( cacheKey ) )
+					if( auto result = g_cache.getIfCached( cacheKey ) )
 					{
 						return *result;
 					}
 				}
 
-				// No value in local cache, so either compute it directly or get it via
-				// the global cache if it's expensive enough to warrant collaboration.
-				IECore::MurmurHash result;
+				// No cached value, so either compute it directly or via a collaboration
+				// if it's expensive enough to warrant it. The latter updates the cache
+				// itself.
 				if( cachePolicy == CachePolicy::Default || cachePolicy == CachePolicy::Standard )
 				{
-					result = HashProcess( p, plug, computeNode ).run();
+					const IECore::MurmurHash result = HashProcess( p, plug, computeNode ).run();
+					g_cache.setIfUncached( cacheKey, result );
+					return result;
 				}
 				else
 				{
-					std::optional<IECore::MurmurHash> cachedValue;
-					if( !forceMonitoring )
-					{
-						cachedValue = g_cache.getIfCached( cacheKey );
-					}
-					if( cachedValue )
-					{
-						result = *cachedValue;
-					}
-					else
-					{
-						result = Process::acquireCollaborativeResult<HashProcess>( cacheKey, p, plug, computeNode );
-					}
+					return Process::acquireCollaborativeResult<HashProcess>( cacheKey, p, plug, computeNode );
 				}
-				// Update local cache and return result
-				threadData.cache.setIfUncached( cacheKey, result, cacheCostFunction );
-				return result;
 			};
 
 			const HashCacheKey cacheKey( p, currentContext, p->m_dirtyCount );
@@ -330,51 +310,22 @@ class ValuePlug::HashProcess : public Process
 
 		static size_t getCacheSizeLimit()
 		{
-			return g_cacheSizeLimit;
+			return g_cache.getMaxCost();
 		}
 
-		static void setCacheSizeLimit( size_t maxEntriesPerThread )
+		static void setCacheSizeLimit( size_t maxEntries )
 		{
-			g_cacheSizeLimit = maxEntriesPerThread;
-			g_cache.setMaxCost( g_cacheSizeLimit );
+			g_cache.setMaxCost( maxEntries );
 		}
 
-		static void clearCache( bool now = false )
+		static void clearCache()
 		{
 			g_cache.clear();
-			// It's not documented explicitly, but it is safe to iterate over an
-			// `enumerable_thread_specific` while `local()` is being called on
-			// other threads, because the underlying container is a
-			// `concurrent_vector`.
-			tbb::enumerable_thread_specific<ThreadData>::iterator it, eIt;
-			for( it = g_threadData.begin(), eIt = g_threadData.end(); it != eIt; ++it )
-			{
-				if( now )
-				{
-					// Not thread-safe - caller is responsible for ensuring there
-					// are no concurrent computes.
-					it->cache.clear();
-				}
-				else
-				{
-					// We can't clear the cache now, because it is most likely
-					// in use by the owning thread. Instead we set this flag to
-					// politely request that the thread clears the cache itself
-					// at its earliest convenience - in the HashProcess constructor.
-					it->clearCache.store( 1, std::memory_order_release );
-				}
-			}
 		}
 
 		static size_t totalCacheUsage()
 		{
-			size_t usage = g_cache.currentCost();
-			tbb::enumerable_thread_specific<ThreadData>::iterator it, eIt;
-			for( it = g_threadData.begin(), eIt = g_threadData.end(); it != eIt; ++it )
-			{
-				usage += it->cache.currentCost();
-			}
-			return usage;
+			return g_cache.currentCost();
 		}
 
 		static void dirtyLegacyCache()
@@ -437,7 +388,9 @@ class ValuePlug::HashProcess : public Process
 			}
 		}
 
-		using CacheType = IECorePreview::LRUCache<HashCacheKey, IECore::MurmurHash, IECorePreview::LRUCachePolicy::Parallel>;
+		// A single cache shared by all threads, so that hashes computed on one
+		// thread are immediately available to all others.
+		using CacheType = Private::ConcurrentCache<HashCacheKey, IECore::MurmurHash>;
 		static CacheType g_cache;
 
 		static size_t cacheCostFunction( const IECore::MurmurHash &value )
@@ -452,27 +405,11 @@ class ValuePlug::HashProcess : public Process
 		static std::atomic<uint64_t> g_legacyGlobalDirtyCount;
 		static HashCacheMode g_hashCacheMode;
 
-		struct ThreadData
-		{
-			// Using a null `GetterFunction` because it will never get called, because we only ever call `getIfCached()`.
-			ThreadData() : cache( CacheType::GetterFunction(), g_cacheSizeLimit, CacheType::RemovalCallback(), /* cacheErrors = */ false ), clearCache( 0 ) {}
-			using CacheType = IECorePreview::LRUCache<HashCacheKey, IECore::MurmurHash, IECorePreview::LRUCachePolicy::Serial>;
-			CacheType cache;
-			// Flag to request that hashCache be cleared.
-			std::atomic_int clearCache;
-		};
-
-		static tbb::enumerable_thread_specific<ThreadData, tbb::cache_aligned_allocator<ThreadData>, tbb::ets_key_per_instance > g_threadData;
-		static std::atomic_size_t g_cacheSizeLimit;
-
 };
 
 const IECore::InternedString ValuePlug::HashProcess::staticType( ValuePlug::hashProcessType() );
-tbb::enumerable_thread_specific<ValuePlug::HashProcess::ThreadData, tbb::cache_aligned_allocator<ValuePlug::HashProcess::ThreadData>, tbb::ets_key_per_instance > ValuePlug::HashProcess::g_threadData;
-// Default limit corresponds to a cost of roughly 25Mb per thread.
-std::atomic_size_t ValuePlug::HashProcess::g_cacheSizeLimit( 128000 );
-// Using a null `GetterFunction` because it will never get called, because we only ever call `getIfCached()`.
-ValuePlug::HashProcess::CacheType ValuePlug::HashProcess::g_cache( CacheType::GetterFunction(), g_cacheSizeLimit, CacheType::RemovalCallback(), /* cacheErrors = */ false );
+// Default limit corresponds to roughly 64Mb, shared between all threads.
+ValuePlug::HashProcess::CacheType ValuePlug::HashProcess::g_cache( 1024 * 1024 );
 std::atomic<uint64_t> ValuePlug::HashProcess::g_legacyGlobalDirtyCount( 0 );
 ValuePlug::HashCacheMode ValuePlug::HashProcess::g_hashCacheMode( defaultHashCacheMode() );
 
@@ -500,12 +437,137 @@ class ValuePlug::ComputeProcess : public Process
 
 		static size_t cacheMemoryUsage()
 		{
-			return g_cache.currentCost();
+			size_t result = g_cache.currentCost();
+			PartitionsMutex::scoped_lock lock( g_partitionsMutex, /* write = */ false );
+			for( const auto &partition : g_partitions )
+			{
+				result += partition.second->currentCost();
+			}
+			return result;
 		}
 
 		static void clearCache()
 		{
 			g_cache.clear();
+			PartitionsMutex::scoped_lock lock( g_partitionsMutex, /* write = */ false );
+			for( const auto &partition : g_partitions )
+			{
+				partition.second->clear();
+			}
+		}
+
+		static void setCachePartitionMemoryLimit( const IECore::InternedString &partition, size_t bytes )
+		{
+			if( partition.string().empty() )
+			{
+				setCacheMemoryLimit( bytes );
+				return;
+			}
+
+			PartitionsMutex::scoped_lock lock( g_partitionsMutex, /* write = */ true );
+			auto &cache = g_partitions[partition];
+			if( cache )
+			{
+				cache->setMaxCost( bytes );
+				return;
+			}
+
+			cache = std::make_unique<CacheType>( CacheType::GetterFunction(), bytes, CacheType::RemovalCallback(), /* cacheErrors = */ false );
+			cache->setEvictionPolicy( g_cache.getEvictionPolicy() );
+			g_partitionsEnabled = true;
+		}
+
+		static size_t getCachePartitionMemoryLimit( const IECore::InternedString &partition )
+		{
+			return cache( partition ).getMaxCost();
+		}
+
+		static size_t cachePartitionMemoryUsage( const IECore::InternedString &partition )
+		{
+			return cache( partition ).currentCost();
+		}
+
+		static std::vector<IECore::InternedString> cachePartitions()
+		{
+			std::vector<IECore::InternedString> result;
+			PartitionsMutex::scoped_lock lock( g_partitionsMutex, /* write = */ false );
+			for( const auto &partition : g_partitions )
+			{
+				result.push_back( partition.first );
+			}
+			std::sort( result.begin(), result.end(), [] ( const IECore::InternedString &a, const IECore::InternedString &b ) { return a.string() < b.string(); } );
+			return result;
+		}
+
+		static void setCacheEvictionPolicy( CacheEvictionPolicy policy )
+		{
+			const CacheType::EvictionPolicy cachePolicy = policy == CacheEvictionPolicy::CostAware ? CacheType::EvictionPolicy::CostAware : CacheType::EvictionPolicy::LRU;
+			g_cache.setEvictionPolicy( cachePolicy );
+			PartitionsMutex::scoped_lock lock( g_partitionsMutex, /* write = */ false );
+			for( const auto &partition : g_partitions )
+			{
+				partition.second->setEvictionPolicy( cachePolicy );
+			}
+		}
+
+		static CacheEvictionPolicy getCacheEvictionPolicy()
+		{
+			return g_cache.getEvictionPolicy() == CacheType::EvictionPolicy::CostAware ? CacheEvictionPolicy::CostAware : CacheEvictionPolicy::LRU;
+		}
+
+		static void setDiskCacheDirectory( const std::string &directory )
+		{
+			std::shared_ptr<Private::DiskCache> diskCache;
+			if( !directory.empty() )
+			{
+				diskCache = std::make_shared<Private::DiskCache>( directory, g_diskCacheSizeLimit );
+			}
+			std::atomic_store( &g_diskCache, diskCache );
+			g_diskCacheEnabled = (bool)diskCache;
+		}
+
+		static std::string getDiskCacheDirectory()
+		{
+			const auto diskCache = std::atomic_load( &g_diskCache );
+			return diskCache ? diskCache->directory().string() : "";
+		}
+
+		static void setDiskCacheSizeLimit( size_t bytes )
+		{
+			g_diskCacheSizeLimit = bytes;
+			if( const auto diskCache = std::atomic_load( &g_diskCache ) )
+			{
+				diskCache->setMaxCost( bytes );
+			}
+		}
+
+		static size_t getDiskCacheSizeLimit()
+		{
+			return g_diskCacheSizeLimit;
+		}
+
+		static void setDiskCacheMinimumComputeTime( float seconds )
+		{
+			g_diskCacheMinimumComputeTime = seconds;
+		}
+
+		static float getDiskCacheMinimumComputeTime()
+		{
+			return g_diskCacheMinimumComputeTime;
+		}
+
+		static size_t diskCacheUsage()
+		{
+			const auto diskCache = std::atomic_load( &g_diskCache );
+			return diskCache ? diskCache->currentCost() : 0;
+		}
+
+		static void clearDiskCache()
+		{
+			if( const auto diskCache = std::atomic_load( &g_diskCache ) )
+			{
+				diskCache->clear();
+			}
 		}
 
 		static const IECore::Object *value( const ValuePlug *plug, IECore::ConstObjectPtr &owner, const IECore::MurmurHash *precomputedHash )
@@ -569,9 +631,14 @@ class ValuePlug::ComputeProcess : public Process
 			// > calling `getValueInternal()`.
 			const IECore::MurmurHash hash = precomputedHash ? *precomputedHash : p->ValuePlug::hash();
 
+			// Choose the partition of the cache that will store the value. We
+			// only query the node if partitions have been created, so as to
+			// keep the overhead of the virtual call out of the common case.
+			CacheType &cache = g_partitionsEnabled && computeNode && !p->getInput() ? ComputeProcess::cache( computeNode->computeCachePartition( p ) ) : g_cache;
+
 			if( !Process::forceMonitoring( threadState, plug, staticType ) )
 			{
-				if( auto result = g_cache.getIfCached( hash ) )
+				if( auto result = cache.getIfCached( hash ) )
 				{
 					// Move avoids unnecessary additional addRef/removeRef.
 					owner = std::move( *result );
@@ -588,8 +655,13 @@ class ValuePlug::ComputeProcess : public Process
 				// compute is in flight elsewhere. We assume the compute is
 				// lightweight enough and unlikely enough to be shared that in
 				// the worst case it's OK to do it redundantly on a few threads
-				// before it gets cached.
-				owner = ComputeProcess( p, plug, computeNode ).run();
+				// before it gets cached. The duration of the compute is only
+				// needed by the CostAware eviction policy, so we avoid the
+				// overhead of timing otherwise.
+				const bool timed = cache.getEvictionPolicy() == CacheType::EvictionPolicy::CostAware;
+				const auto startTime = timed ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+				owner = ComputeProcess( p, plug, computeNode, &hash ).run();
+				const std::chrono::nanoseconds computeDuration = timed ? std::chrono::steady_clock::now() - startTime : std::chrono::nanoseconds( 0 );
 				// Store the value in the cache, but only if it isn't there already.
 				// The check is useful because it's common for an upstream compute
 				// triggered by us to have already done the work, and calling
@@ -600,13 +672,13 @@ class ValuePlug::ComputeProcess : public Process
 				// upstream node will already have computed the same result) and the
 				// attribute data itself consists of many small objects for which
 				// computing memory usage is slow.
-				g_cache.setIfUncached( hash, owner, cacheCostFunction );
+				cache.setIfUncached( hash, owner, cacheCostFunction, computeDuration );
 				return owner.get();
 			}
 			else
 			{
 				owner = acquireCollaborativeResult<ComputeProcess>(
-					hash, p, plug, computeNode
+					cache, hash, p, plug, computeNode, &hash
 				);
 				return owner.get();
 			}
@@ -633,8 +705,10 @@ class ValuePlug::ComputeProcess : public Process
 
 		// Interface required by `Process::acquireCollaborativeResult()`.
 
-		ComputeProcess( const ValuePlug *plug, const ValuePlug *destinationPlug, const ComputeNode *computeNode )
-			:	Process( staticType, plug, destinationPlug ), m_computeNode( computeNode )
+		// If `diskCacheKey` is provided, the disk cache is consulted before computing,
+		// and updated afterwards.
+		ComputeProcess( const ValuePlug *plug, const ValuePlug *destinationPlug, const ComputeNode *computeNode, const IECore::MurmurHash *diskCacheKey = nullptr )
+			:	Process( staticType, plug, destinationPlug ), m_computeNode( computeNode ), m_diskCacheKey( diskCacheKey )
 		{
 		}
 
@@ -656,8 +730,45 @@ class ValuePlug::ComputeProcess : public Process
 					{
 						throw IECore::Exception( "Plug has no ComputeNode." );
 					}
+
+					std::shared_ptr<Private::DiskCache> diskCache;
+					if( m_diskCacheKey && g_diskCacheEnabled )
+					{
+						diskCache = std::atomic_load( &g_diskCache );
+					}
+
+					// Plugs which have been slow enough to write to the disk cache
+					// may have been written by another process too, so for those we
+					// search for entries the index doesn't know about yet. For all
+					// others, a miss in the index costs no filesystem access.
+					const DiskCachePlugKey diskCachePlugKey( m_computeNode->typeId(), valuePlug->getName().c_str() );
+					if( diskCache )
+					{
+						size_t bytesRead = 0;
+						const bool searchUnindexed = g_diskCachePlugs.count( diskCachePlugKey );
+						if( IECore::ConstObjectPtr result = diskCache->get( *m_diskCacheKey, bytesRead, searchUnindexed ) )
+						{
+							cacheEvent( Monitor::CacheEvent::DiskCacheHit, bytesRead );
+							return result;
+						}
+						cacheEvent( Monitor::CacheEvent::DiskCacheMiss );
+					}
+
+					const auto startTime = std::chrono::steady_clock::now();
 					// Cast is ok - see comment above.
 					m_computeNode->compute( const_cast<ValuePlug *>( valuePlug ), context() );
+
+					if(
+						diskCache && m_result &&
+						std::chrono::duration<float>( std::chrono::steady_clock::now() - startTime ).count() >= g_diskCacheMinimumComputeTime
+					)
+					{
+						g_diskCachePlugs.insert( diskCachePlugKey );
+						if( const size_t bytesWritten = diskCache->set( *m_diskCacheKey, m_result.get() ) )
+						{
+							cacheEvent( Monitor::CacheEvent::DiskCacheWrite, bytesWritten );
+						}
+					}
 				}
 				// The calls above should cause setValue() to be called on the result plug, which in
 				// turn will call ValuePlug::setObjectValue(), which will then store the result in
@@ -688,15 +799,69 @@ class ValuePlug::ComputeProcess : public Process
 
 	private :
 
+		// Returns the cache for the named partition, falling back to
+		// `g_cache` for the default partition and any partition that
+		// hasn't been given its own memory limit.
+		static CacheType &cache( const IECore::InternedString &partition )
+		{
+			if( !g_partitionsEnabled || partition.string().empty() )
+			{
+				return g_cache;
+			}
+
+			PartitionsMutex::scoped_lock lock( g_partitionsMutex, /* write = */ false );
+			auto it = g_partitions.find( partition );
+			// Partitions are never removed, so it is safe to return a
+			// reference after releasing the lock.
+			return it != g_partitions.end() ? *it->second : g_cache;
+		}
+
 		const ComputeNode *m_computeNode;
+		const IECore::MurmurHash *m_diskCacheKey;
 		IECore::ConstObjectPtr m_result;
 
+		using PartitionsMutex = tbb::spin_rw_mutex;
+		static PartitionsMutex g_partitionsMutex;
+		static std::unordered_map<IECore::InternedString, std::unique_ptr<CacheType>> g_partitions;
+		// Allows us to avoid locking `g_partitionsMutex` and calling
+		// `ComputeNode::computeCachePartition()` in the common case that no
+		// partitions have been created.
+		static std::atomic_bool g_partitionsEnabled;
+
+		static std::shared_ptr<Private::DiskCache> g_diskCache;
+		// Allows us to avoid the overhead of `std::atomic_load( &g_diskCache )`
+		// in the common case that the disk cache is disabled.
+		static std::atomic_bool g_diskCacheEnabled;
+		static std::atomic_size_t g_diskCacheSizeLimit;
+		static std::atomic<float> g_diskCacheMinimumComputeTime;
+
+		// Identifies a plug by the type of its node and its name, which
+		// is interned and can therefore be compared by address.
+		using DiskCachePlugKey = std::pair<IECore::TypeId, const char *>;
+		struct DiskCachePlugKeyHash
+		{
+			size_t operator()( const DiskCachePlugKey &key ) const
+			{
+				return std::hash<const char *>()( key.second ) ^ ( (size_t)key.first << 1 );
+			}
+		};
+		// Plugs whose computes have met `g_diskCacheMinimumComputeTime`.
+		static tbb::concurrent_unordered_set<DiskCachePlugKey, DiskCachePlugKeyHash> g_diskCachePlugs;
+
 };
 
 const IECore::InternedString ValuePlug::ComputeProcess::staticType( ValuePlug::computeProcessType() );
 // Using a null `GetterFunction` because it will never get called, because we only ever call `getIfCached()`.
 // Note : The default size here is overridden by `startup/Gaffer/cache.py`.
 ValuePlug::ComputeProcess::CacheType ValuePlug::ComputeProcess::g_cache( CacheType::GetterFunction(), 1024 * 1024 * 1024 * 1, CacheType::RemovalCallback(), /* cacheErrors = */ false ); // 1 gig
+ValuePlug::ComputeProcess::PartitionsMutex ValuePlug::ComputeProcess::g_partitionsMutex;
+std::unordered_map<IECore::InternedString, std::unique_ptr<ValuePlug::ComputeProcess::CacheType>> ValuePlug::ComputeProcess::g_partitions;
+std::atomic_bool ValuePlug::ComputeProcess::g_partitionsEnabled( false );
+std::shared_ptr<Private::DiskCache> ValuePlug::ComputeProcess::g_diskCache;
+std::atomic_bool ValuePlug::ComputeProcess::g_diskCacheEnabled( false );
+std::atomic_size_t ValuePlug::ComputeProcess::g_diskCacheSizeLimit( 1024ull * 1024 * 1024 * 10 ); // 10 gigs
+std::atomic<float> ValuePlug::ComputeProcess::g_diskCacheMinimumComputeTime( 0.01f );
+tbb::concurrent_unordered_set<ValuePlug::ComputeProcess::DiskCachePlugKey, ValuePlug::ComputeProcess::DiskCachePlugKeyHash> ValuePlug::ComputeProcess::g_diskCachePlugs;
 
 //////////////////////////////////////////////////////////////////////////
 // SetValueAction implementation
@@ -1156,19 +1321,89 @@ void ValuePlug::clearCache()
 	ComputeProcess::clearCache();
 }
 
+void ValuePlug::setCacheEvictionPolicy( CacheEvictionPolicy policy )
+{
+	ComputeProcess::setCacheEvictionPolicy( policy );
+}
+
+void ValuePlug::setCachePartitionMemoryLimit( const IECore::InternedString &partition, size_t bytes )
+{
+	ComputeProcess::setCachePartitionMemoryLimit( partition, bytes );
+}
+
+size_t ValuePlug::getCachePartitionMemoryLimit( const IECore::InternedString &partition )
+{
+	return ComputeProcess::getCachePartitionMemoryLimit( partition );
+}
+
+size_t ValuePlug::cachePartitionMemoryUsage( const IECore::InternedString &partition )
+{
+	return ComputeProcess::cachePartitionMemoryUsage( partition );
+}
+
+std::vector<IECore::InternedString> ValuePlug::cachePartitions()
+{
+	return ComputeProcess::cachePartitions();
+}
+
+ValuePlug::CacheEvictionPolicy ValuePlug::getCacheEvictionPolicy()
+{
+	return ComputeProcess::getCacheEvictionPolicy();
+}
+
+void ValuePlug::setDiskCacheDirectory( const std::string &directory )
+{
+	ComputeProcess::setDiskCacheDirectory( directory );
+}
+
+std::string ValuePlug::getDiskCacheDirectory()
+{
+	return ComputeProcess::getDiskCacheDirectory();
+}
+
+void ValuePlug::setDiskCacheSizeLimit( size_t bytes )
+{
+	ComputeProcess::setDiskCacheSizeLimit( bytes );
+}
+
+size_t ValuePlug::getDiskCacheSizeLimit()
+{
+	return ComputeProcess::getDiskCacheSizeLimit();
+}
+
+void ValuePlug::setDiskCacheMinimumComputeTime( float seconds )
+{
+	ComputeProcess::setDiskCacheMinimumComputeTime( seconds );
+}
+
+float ValuePlug::getDiskCacheMinimumComputeTime()
+{
+	return ComputeProcess::getDiskCacheMinimumComputeTime();
+}
+
+size_t ValuePlug::diskCacheUsage()
+{
+	return ComputeProcess::diskCacheUsage();
+}
+
+void ValuePlug::clearDiskCache()
+{
+	ComputeProcess::clearDiskCache();
+}
+
 size_t ValuePlug::getHashCacheSizeLimit()
 {
 	return HashProcess::getCacheSizeLimit();
 }
 
-void ValuePlug::setHashCacheSizeLimit( size_t maxEntriesPerThread )
+void ValuePlug::setHashCacheSizeLimit( size_t maxEntries )
 {
-	HashProcess::setCacheSizeLimit( maxEntriesPerThread );
+	HashProcess::setCacheSizeLimit( maxEntries );
 }
 
 void ValuePlug::clearHashCache( bool now )
 {
-	HashProcess::clearCache( now );
+	HashProcess::clearCache();
 }
 
 size_t ValuePlug::hashCacheTotalUsage()
@@ -36,12 +36,22 @@
 
 #include "GafferImage/Blur.h"
 
+#include "GafferImage/BufferAlgo.h"
 #include "GafferImage/FilterAlgo.h"
+#include "GafferImage/ImageAlgo.h"
 #include "GafferImage/Resample.h"
+#include "GafferImage/Sampler.h"
 
 #include "Gaffer/StringPlug.h"
 
+#include "tbb/enumerable_thread_specific.h"
+#include "tbb/parallel_for.h"
+
+#include <algorithm>
+#include <cmath>
+
 using namespace Imath;
+using namespace IECore;
 using namespace Gaffer;
 using namespace GafferImage;
 
@@ -49,6 +59,136 @@ GAFFER_NODE_DEFINE_TYPE( Blur );
 
 const char *g_blurFilterName = "smoothGaussian";
 
+//////////////////////////////////////////////////////////////////////////
+// Box filtering utilities for the Fast method
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// The number of box filter passes used to approximate the gaussian. Three
+// passes is common, but gives a noticeably pointier peak than the smooth
+// gaussian used by the Accurate method, whereas four is visually
+// indistinguishable.
+const int g_numBoxPasses = 4;
+
+// An "extended box" filter, as described in "Theoretical Foundations of Gaussian
+// Convolution by Extended Box Filtering" by Gwosdek et al. This is a box of
+// integer `radius`, with an additional fractional `weight` applied to the pixel
+// at either end. This allows the variance to be matched exactly, whereas a
+// plain box filter can only provide a discrete set of variances.
+struct BoxFilter
+{
+
+	BoxFilter( float blurRadius )
+	{
+		// The Accurate method uses weights of `exp( -5 * ( x / ( 1 + blurRadius ) )^2 )`,
+		// truncated to zero at `|x| = 1 + blurRadius`. This is a gaussian with variance
+		// `( 1 + blurRadius )^2 / 10`, and the truncation reduces that by a further 1.7%.
+		const double variance = 0.983 * ( 1.0 + blurRadius ) * ( 1.0 + blurRadius ) / 10.0;
+		// The variances of the individual passes sum to give the total.
+		const double passVariance = variance / g_numBoxPasses;
+		// Choose the largest box whose variance doesn't exceed that required,
+		// and make up the difference with the fractional end weights.
+		radius = (int)floor( 0.5 * sqrt( 12.0 * passVariance + 1.0 ) - 0.5 );
+		const double r = radius;
+		weight = ( 2.0 * r + 1.0 ) * ( passVariance - r * ( r + 1.0 ) / 3.0 ) / ( 2.0 * ( ( r + 1.0 ) * ( r + 1.0 ) - passVariance ) );
+		normalisation = 1.0 / ( 2.0 * r + 1.0 + 2.0 * weight );
+	}
+
+	// The distance at which the result of all passes is guaranteed to
+	// reach zero (for the Black bounding mode) or become constant (for
+	// the Clamp bounding mode).
+	int support() const
+	{
+		return g_numBoxPasses * ( radius + 1 );
+	}
+
+	int radius;
+	double weight;
+	double normalisation;
+
+};
+
+// Applies all passes of `filter` to `line` in place, using `scratch` as temporary
+// storage. Values beyond the ends of `line` are treated as zero, or as copies of
+// the end values if `clamp` is true. It is the caller's responsibility to pad
+// the line with `filter.support()` pixels, so that this boundary treatment is
+// exactly equivalent to filtering an infinite line.
+void boxFilterLine( std::vector<float> &line, std::vector<float> &scratch, const BoxFilter &filter, bool clamp )
+{
+	const int size = line.size();
+	const int r = filter.radius;
+	scratch.resize( size );
+
+	for( int pass = 0; pass < g_numBoxPasses; ++pass )
+	{
+		const float *in = line.data();
+		const float first = clamp ? in[0] : 0.0f;
+		const float last = clamp ? in[size-1] : 0.0f;
+		auto value = [&] ( int i ) {
+			return i < 0 ? first : ( i >= size ? last : in[i] );
+		};
+
+		// Running sum of the pixels inside the box, accumulated in double
+		// precision to avoid drift along long lines.
+		double sum = 0.0;
+		for( int i = -r; i <= r; ++i )
+		{
+			sum += value( i );
+		}
+
+		float *out = scratch.data();
+		for( int i = 0; i < size; ++i )
+		{
+			const float before = value( i - r - 1 );
+			const float after = value( i + r + 1 );
+			out[i] = ( sum + filter.weight * ( before + after ) ) * filter.normalisation;
+			sum += after - value( i - r );
+		}
+
+		line.swap( scratch );
+	}
+}
+
+// Copies the pixels at `[begin, end)` of `line` to `out`, treating values
+// beyond the ends of `line` as for `boxFilterLine()`.
+template<typename OutputIterator>
+void copyLine( const std::vector<float> &line, int begin, int end, bool clamp, OutputIterator out )
+{
+	const int size = line.size();
+	for( int i = begin; i < end; ++i, ++out )
+	{
+		if( i < 0 )
+		{
+			*out = clamp ? line.front() : 0.0f;
+		}
+		else if( i >= size )
+		{
+			*out = clamp ? line.back() : 0.0f;
+		}
+		else
+		{
+			*out = line[i];
+		}
+	}
+}
+
+// Strided iterator, used to write columns of an image.
+struct ColumnIterator
+{
+	float *p;
+	int stride;
+	float &operator*() const { return *p; }
+	ColumnIterator &operator++() { p += stride; return *this; }
+};
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// Blur
+//////////////////////////////////////////////////////////////////////////
+
 size_t Blur::g_firstPlugIndex = 0;
 
 Blur::Blur( const std::string &name )
@@ -61,11 +201,13 @@ Blur::Blur( const std::string &name )
 	addChild( new V2fPlug( "radius", Plug::In, V2f( 0 ), V2f( 0 ) ) );
 	addChild( resample->boundingModePlug()->createCounterpart( "boundingMode", Plug::In ) );
 	addChild( new BoolPlug( "expandDataWindow" ) );
+	addChild( new IntPlug( "method", Plug::In, (int)Method::Accurate, (int)Method::Accurate, (int)Method::Fast ) );
 
 	addChild( new V2fPlug( "__filterScale", Plug::Out ) );
 
 	addChild( new AtomicBox2iPlug( "__resampledDataWindow", Plug::In, Box2i(), Plug::Default & ~Plug::Serialisable ) );
 	addChild( new FloatVectorDataPlug( "__resampledChannelData", Plug::In, ImagePlug::blackTile(), Plug::Default & ~Plug::Serialisable ) );
+	addChild( new FloatVectorDataPlug( "__fastBlur", Plug::Out, ImagePlug::blackTile() ) );
 
 	addChild( resample );
 
@@ -118,44 +260,64 @@ const Gaffer::BoolPlug *Blur::expandDataWindowPlug() const
 	return getChild<BoolPlug>( g_firstPlugIndex + 2 );
 }
 
+Gaffer::IntPlug *Blur::methodPlug()
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 3 );
+}
+
+const Gaffer::IntPlug *Blur::methodPlug() const
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 3 );
+}
+
 Gaffer::V2fPlug *Blur::filterScalePlug()
 {
-	return getChild<V2fPlug>( g_firstPlugIndex + 3 );
+	return getChild<V2fPlug>( g_firstPlugIndex + 4 );
 }
 
 const Gaffer::V2fPlug *Blur::filterScalePlug() const
 {
-	return getChild<V2fPlug>( g_firstPlugIndex + 3 );
+	return getChild<V2fPlug>( g_firstPlugIndex + 4 );
 }
 
 Gaffer::AtomicBox2iPlug *Blur::resampledDataWindowPlug()
 {
-	return getChild<AtomicBox2iPlug>( g_firstPlugIndex + 4 );
+	return getChild<AtomicBox2iPlug>( g_firstPlugIndex + 5 );
 }
 
 const Gaffer::AtomicBox2iPlug *Blur::resampledDataWindowPlug() const
 {
-	return getChild<AtomicBox2iPlug>( g_firstPlugIndex + 4 );
+	return getChild<AtomicBox2iPlug>( g_firstPlugIndex + 5 );
 }
 
 Gaffer::FloatVectorDataPlug *Blur::resampledChannelDataPlug()
 {
-	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 5 );
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 6 );
 }
 
 const Gaffer::FloatVectorDataPlug *Blur::resampledChannelDataPlug() const
 {
-	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 5 );
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 6 );
+}
+
+Gaffer::FloatVectorDataPlug *Blur::fastBlurPlug()
+{
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 7 );
+}
+
+const Gaffer::FloatVectorDataPlug *Blur::fastBlurPlug() const
+{
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 7 );
 }
 
 Resample *Blur::resample()
 {
-	return getChild<Resample>( g_firstPlugIndex + 6 );
+	return getChild<Resample>( g_firstPlugIndex + 8 );
 }
 
 const Resample *Blur::resample() const
 {
-	return getChild<Resample>( g_firstPlugIndex + 6 );
+	return getChild<Resample>( g_firstPlugIndex + 8 );
 }
 
 void Blur::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
@@ -168,19 +330,31 @@ void Blur::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs )
 	)
 	{
 		outputs.push_back( outPlug()->dataWindowPlug() );
+		outputs.push_back( fastBlurPlug() );
 	}
 	else if( input->parent<V2fPlug>() == radiusPlug() )
 	{
 		outputs.push_back( filterScalePlug()->getChild<ValuePlug>( input->getName() ) );
 		outputs.push_back( outPlug()->dataWindowPlug() );
 		outputs.push_back( outPlug()->channelDataPlug() );
+		outputs.push_back( fastBlurPlug() );
 	}
 	else if(
-		input == resampledChannelDataPlug()
+		input == resampledChannelDataPlug() ||
+		input == methodPlug() ||
+		input == fastBlurPlug()
 	)
 	{
 		outputs.push_back( outPlug()->channelDataPlug() );
 	}
+	else if(
+		input == inPlug()->channelDataPlug() ||
+		input == inPlug()->dataWindowPlug() ||
+		input == boundingModePlug()
+	)
+	{
+		outputs.push_back( fastBlurPlug() );
+	}
 }
 
 void Blur::hash( const ValuePlug *output, const Context *context, IECore::MurmurHash &h ) const
@@ -191,6 +365,36 @@ void Blur::hash( const ValuePlug *output, const Context *context, IECore::Murmur
 	{
 		radiusPlug()->getChild<ValuePlug>( output->getName() )->hash( h );
 	}
+	else if( output == fastBlurPlug() )
+	{
+		Box2i inDataWindow;
+		{
+			ImagePlug::GlobalScope globalScope( context );
+			inDataWindow = inPlug()->dataWindowPlug()->getValue();
+			h.append( inDataWindow );
+			outPlug()->dataWindowPlug()->hash( h );
+			radiusPlug()->hash( h );
+			boundingModePlug()->hash( h );
+		}
+
+		// We traverse in TopToBottom order because otherwise the hash could change just based on
+		// the order in which hashes are combined
+		ImageAlgo::parallelGatherTiles(
+			inPlug(),
+			// Tile
+			[] ( const ImagePlug *imagePlug, const V2i &tileOrigin )
+			{
+				return imagePlug->channelDataPlug()->hash();
+			},
+			// Gather
+			[ &h ] ( const ImagePlug *imagePlug, const V2i &tileOrigin, const IECore::MurmurHash &tileHash )
+			{
+				h.append( tileHash );
+			},
+			inDataWindow,
+			ImageAlgo::TopToBottom
+		);
+	}
 }
 
 void Blur::compute( ValuePlug *output, const Context *context ) const
@@ -214,6 +418,130 @@ void Blur::compute( ValuePlug *output, const Context *context ) const
 		);
 		return;
 	}
+	else if( output == fastBlurPlug() )
+	{
+		Box2i inDataWindow;
+		Box2i outDataWindow;
+		V2f radius;
+		bool clamp;
+		{
+			ImagePlug::GlobalScope globalScope( context );
+			inDataWindow = inPlug()->dataWindowPlug()->getValue();
+			outDataWindow = outPlug()->dataWindowPlug()->getValue();
+			radius = radiusPlug()->getValue();
+			clamp = boundingModePlug()->getValue() == Sampler::Clamp;
+		}
+
+		// We compute the blurred channel for the whole of the output data window,
+		// first filtering horizontally into an intermediate buffer covering the rows
+		// of the input data window, and then filtering that vertically. Rows outside the
+		// input data window don't need to be filtered horizontally, because they are
+		// either black or copies of the edge rows, depending on the bounding mode.
+
+		FloatVectorDataPtr resultData = new FloatVectorData;
+		std::vector<float> &result = resultData->writable();
+		result.resize( outDataWindow.size().x * outDataWindow.size().y, 0.0f );
+
+		if( BufferAlgo::empty( inDataWindow ) || BufferAlgo::empty( outDataWindow ) )
+		{
+			static_cast<FloatVectorDataPlug *>( output )->setValue( resultData );
+			return;
+		}
+
+		// Gather the input into a single buffer.
+
+		const V2i inSize = inDataWindow.size();
+		std::vector<float> input( inSize.x * inSize.y );
+		ImageAlgo::parallelProcessTiles(
+			inPlug(),
+			[&] ( const ImagePlug *imagePlug, const V2i &tileOrigin )
+			{
+				ConstFloatVectorDataPtr tileData = imagePlug->channelDataPlug()->getValue();
+				const Box2i tileBound( tileOrigin, tileOrigin + V2i( ImagePlug::tileSize() ) );
+				const Box2i b = BufferAlgo::intersection( tileBound, inDataWindow );
+				for( int y = b.min.y; y < b.max.y; ++y )
+				{
+					std::copy(
+						tileData->readable().begin() + ImagePlug::pixelIndex( V2i( b.min.x, y ), tileOrigin ),
+						tileData->readable().begin() + ImagePlug::pixelIndex( V2i( b.max.x, y ), tileOrigin ),
+						input.begin() + ( y - inDataWindow.min.y ) * inSize.x + ( b.min.x - inDataWindow.min.x )
+					);
+				}
+			},
+			inDataWindow
+		);
+
+		const V2i outSize = outDataWindow.size();
+		const BoxFilter filterX( radius.x );
+		const BoxFilter filterY( radius.y );
+
+		const IECore::Canceller *canceller = context->canceller();
+		tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+		tbb::enumerable_thread_specific<std::vector<float>> lines;
+		tbb::enumerable_thread_specific<std::vector<float>> scratches;
+
+		// Horizontal pass, from `input` to `horizontal`. The lines are padded
+		// so that boundary effects don't reach the output data window.
+
+		std::vector<float> horizontal( outSize.x * inSize.y );
+		tbb::parallel_for(
+			tbb::blocked_range<int>( 0, inSize.y ),
+			[&] ( const tbb::blocked_range<int> &range )
+			{
+				std::vector<float> &line = lines.local();
+				std::vector<float> &scratch = scratches.local();
+				const int padding = radius.x > 0 ? filterX.support() : 0;
+				for( int y = range.begin(); y < range.end(); ++y )
+				{
+					IECore::Canceller::check( canceller );
+					const float *in = input.data() + y * inSize.x;
+					line.resize( inSize.x + 2 * padding );
+					std::fill( line.begin(), line.begin() + padding, clamp ? in[0] : 0.0f );
+					std::copy( in, in + inSize.x, line.begin() + padding );
+					std::fill( line.end() - padding, line.end(), clamp ? in[inSize.x-1] : 0.0f );
+					if( radius.x > 0 )
+					{
+						boxFilterLine( line, scratch, filterX, clamp );
+					}
+					const int begin = outDataWindow.min.x - inDataWindow.min.x + padding;
+					copyLine( line, begin, begin + outSize.x, clamp, horizontal.begin() + y * outSize.x );
+				}
+			},
+			taskGroupContext
+		);
+
+		// Vertical pass, from `horizontal` to `result`.
+
+		tbb::parallel_for(
+			tbb::blocked_range<int>( 0, outSize.x ),
+			[&] ( const tbb::blocked_range<int> &range )
+			{
+				std::vector<float> &line = lines.local();
+				std::vector<float> &scratch = scratches.local();
+				const int padding = radius.y > 0 ? filterY.support() : 0;
+				for( int x = range.begin(); x < range.end(); ++x )
+				{
+					IECore::Canceller::check( canceller );
+					line.resize( inSize.y + 2 * padding );
+					for( int y = -padding; y < inSize.y + padding; ++y )
+					{
+						const int clampedY = std::clamp( y, 0, inSize.y - 1 );
+						line[y+padding] = ( clamp || clampedY == y ) ? horizontal[clampedY * outSize.x + x] : 0.0f;
+					}
+					if( radius.y > 0 )
+					{
+						boxFilterLine( line, scratch, filterY, clamp );
+					}
+					const int begin = outDataWindow.min.y - inDataWindow.min.y + padding;
+					copyLine( line, begin, begin + outSize.y, clamp, ColumnIterator{ result.data() + x, outSize.x } );
+				}
+			},
+			taskGroupContext
+		);
+
+		static_cast<FloatVectorDataPlug *>( output )->setValue( resultData );
+		return;
+	}
 
 	FlatImageProcessor::compute( output, context );
 }
@@ -244,24 +572,91 @@ Imath::Box2i Blur::computeDataWindow( const Gaffer::Context *context, const Imag
 
 void Blur::hashChannelData( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
-	if( radiusPlug()->getValue() != V2f( 0 ) )
+	if( radiusPlug()->getValue() == V2f( 0 ) )
 	{
-		h = resampledChannelDataPlug()->hash();
+		h = inPlug()->channelDataPlug()->hash();
+	}
+	else if( (Method)methodPlug()->getValue() == Method::Fast )
+	{
+		FlatImageProcessor::hashChannelData( parent, context, h );
+		h.append( context->get<V2i>( ImagePlug::tileOriginContextName ) );
+		{
+			ImagePlug::GlobalScope globalScope( context );
+			outPlug()->dataWindowPlug()->hash( h );
+		}
+		ImagePlug::ChannelDataScope channelDataScope( context );
+		channelDataScope.remove( ImagePlug::tileOriginContextName );
+		fastBlurPlug()->hash( h );
 	}
 	else
 	{
-		h = inPlug()->channelDataPlug()->hash();
+		h = resampledChannelDataPlug()->hash();
 	}
 }
 
 IECore::ConstFloatVectorDataPtr Blur::computeChannelData( const std::string &channelName, const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent ) const
 {
-	if( radiusPlug()->getValue() != V2f( 0 ) )
+	if( radiusPlug()->getValue() == V2f( 0 ) )
 	{
-		return resampledChannelDataPlug()->getValue();
+		return inPlug()->channelDataPlug()->getValue();
+	}
+	else if( (Method)methodPlug()->getValue() == Method::Fast )
+	{
+		Box2i dataWindow;
+		{
+			ImagePlug::GlobalScope globalScope( context );
+			dataWindow = outPlug()->dataWindowPlug()->getValue();
+		}
+
+		ConstFloatVectorDataPtr blurData;
+		{
+			ImagePlug::ChannelDataScope channelDataScope( context );
+			channelDataScope.remove( ImagePlug::tileOriginContextName );
+			blurData = fastBlurPlug()->getValue();
+		}
+
+		FloatVectorDataPtr resultData = new FloatVectorData;
+		std::vector<float> &result = resultData->writable();
+		result.resize( ImagePlug::tilePixels(), 0.0f );
+
+		const Box2i tileBound( tileOrigin, tileOrigin + V2i( ImagePlug::tileSize() ) );
+		const Box2i b = BufferAlgo::intersection( tileBound, dataWindow );
+		const std::vector<float> &blur = blurData->readable();
+		const int width = dataWindow.size().x;
+		for( int y = b.min.y; y < b.max.y; ++y )
+		{
+			const size_t offset = ( y - dataWindow.min.y ) * width;
+			std::copy(
+				blur.begin() + offset + b.min.x - dataWindow.min.x,
+				blur.begin() + offset + b.max.x - dataWindow.min.x,
+				result.begin() + ImagePlug::pixelIndex( V2i( b.min.x, y ), tileOrigin )
+			);
+		}
+
+		return resultData;
 	}
 	else
 	{
-		return inPlug()->channelDataPlug()->getValue();
+		return resampledChannelDataPlug()->getValue();
 	}
 }
+
+Gaffer::ValuePlug::CachePolicy Blur::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == fastBlurPlug() )
+	{
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
+
+	return FlatImageProcessor::computeCachePolicy( output );
+}
+
+Gaffer::ValuePlug::CachePolicy Blur::hashCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == fastBlurPlug() )
+	{
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
+
+	return FlatImageProcessor::hashCachePolicy( output );
+}
@@ -62,6 +62,11 @@
 #include "boost/regex.hpp"
 #include "boost/unordered_map.hpp"
 
+#include "OpenImageIO/imageio.h"
+
+#include "fmt/format.h"
+
+#include <chrono>
 #include <thread>
 #include <unordered_map>
 
@@ -101,6 +106,116 @@ namespace
 	std::string g_emptyString( "" );
 	std::string g_outputPrefix( "output:" );
 	IECore::InternedString g_imageNameContextName( "catalogue:imageName" );
+
+	// Returns true if `fileName` contains a complete image. Images are written
+	// from top to bottom, so we check that the last row of the last part can be
+	// read. This guards against trusting files that were partially written by
+	// an interrupted save.
+	bool isCompleteImage( const std::filesystem::path &fileName )
+	{
+		std::error_code ec;
+		if( !std::filesystem::is_regular_file( fileName, ec ) || !std::filesystem::file_size( fileName, ec ) )
+		{
+			return false;
+		}
+
+		std::unique_ptr<OIIO::ImageInput> input = OIIO::ImageInput::open( fileName.string() );
+		if( !input )
+		{
+			OIIO::geterror(); // Clear error so it isn't reported elsewhere.
+			return false;
+		}
+
+		int subImage = 0;
+		while( input->seek_subimage( subImage + 1, 0 ) )
+		{
+			subImage++;
+		}
+		if( !input->seek_subimage( subImage, 0 ) )
+		{
+			return false;
+		}
+
+		const OIIO::ImageSpec spec = input->spec();
+		if( spec.deep || spec.width <= 0 || spec.height <= 0 )
+		{
+			return false;
+		}
+
+		bool result;
+		if( spec.tile_width && spec.tile_height )
+		{
+			const int yBegin = spec.y + ( ( spec.height - 1 ) / spec.tile_height ) * spec.tile_height;
+			const int yEnd = std::min( yBegin + spec.tile_height, spec.y + spec.height );
+			std::vector<float> buffer( (size_t)spec.width * ( yEnd - yBegin ) * spec.nchannels );
+			result = input->read_tiles(
+				subImage, 0, spec.x, spec.x + spec.width, yBegin, yEnd,
+				0, 1, 0, spec.nchannels, OIIO::TypeDesc::FLOAT, buffer.data()
+			);
+		}
+		else
+		{
+			std::vector<float> buffer( (size_t)spec.width * spec.nchannels );
+			result = input->read_scanlines(
+				subImage, 0, spec.y + spec.height - 1, spec.y + spec.height,
+				0, 0, spec.nchannels, OIIO::TypeDesc::FLOAT, buffer.data()
+			);
+		}
+
+		input->geterror(); // Clear error so it isn't reported elsewhere.
+		return result;
+	}
+
+	// Returns the directory images are saved to, with any substitutions
+	// applied. Returns an empty path if it can not be resolved.
+	std::filesystem::path resolvedDirectory( const Catalogue *catalogue )
+	{
+		string directory = catalogue->directoryPlug()->getValue();
+		if( const ScriptNode *script = catalogue->ancestor<ScriptNode>() )
+		{
+			directory = script->context()->substitute( directory );
+		}
+		else if( IECore::StringAlgo::hasSubstitutions( directory ) )
+		{
+			// Its possible for a Catalogue to have been removed from its script
+			// and still receive an image. If it will attempt to save that image
+			// to a file which needed the script context to resolve properly, the
+			// saving will eventually error, so we return an empty string instead.
+			// Its likely this only occurs while the node is in the process of
+			// being deleted (perhaps inside python's garbage collector).
+			return "";
+		}
+
+		return directory;
+	}
+
+	// Removes temporary files left behind by saves that were interrupted
+	// by a crash. These are named `.{stem}.{saver address}.exr` - see
+	// `AsynchronousSaver`. We leave alone any that have been modified
+	// recently, as they may belong to a save that is still in progress in
+	// another session.
+	void removeStaleTemporaryFiles( const std::filesystem::path &directory )
+	{
+		std::error_code ec;
+		if( directory.empty() || !std::filesystem::is_directory( directory, ec ) )
+		{
+			return;
+		}
+
+		static const boost::regex g_temporaryFileRegex( R"(^\..+\.0x[0-9a-fA-F]+\.exr$)" );
+		const auto staleTime = std::filesystem::file_time_type::clock::now() - std::chrono::minutes( 10 );
+		for( const auto &entry : std::filesystem::directory_iterator( directory, ec ) )
+		{
+			if(
+				entry.is_regular_file( ec ) &&
+				boost::regex_match( entry.path().filename().string(), g_temporaryFileRegex ) &&
+				entry.last_write_time( ec ) < staleTime
+			)
+			{
+				std::filesystem::remove( entry.path(), ec );
+			}
+		}
+	}
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -561,14 +676,18 @@ class Catalogue::InternalImage : public ImageNode
 			private :
 
 				AsynchronousSaver( InternalImagePtr imageCopy, const std::filesystem::path &fileName )
-					:	m_imageCopy( imageCopy )
+					:	m_imageCopy( imageCopy ), m_fileName( fileName )
 				{
 					// Set up an ImageWriter to do the actual saving.
 					// We do all graph construction here in the main thread
 					// so that the background thread only does execution.
+					// We write to a temporary file and rename it when complete,
+					// so that a file at `fileName` is always a complete image.
 					m_writer = new ImageWriter;
 					m_writer->inPlug()->setInput( m_imageCopy->outPlug() );
-					m_writer->fileNamePlug()->setValue( fileName );
+					m_writer->fileNamePlug()->setValue(
+						fileName.parent_path() / fmt::format( ".{}.{}{}", fileName.stem().string(), (const void *)this, fileName.extension().string() )
+					);
 				}
 
 				void save( WeakPtr forWrapUp )
@@ -588,13 +707,24 @@ class Catalogue::InternalImage : public ImageNode
 						}
 					);
 
-					try
-					{
-						m_writer->taskPlug()->execute();
-					}
-					catch( const std::exception &e )
+					// File names are generated from the image hash, so if a complete
+					// file already exists then it already contains this image. This is
+					// common when rerendering without changes, and we can skip
+					// the expense of writing it again.
+					if( !isCompleteImage( m_fileName ) )
 					{
-						IECore::msg( IECore::Msg::Error, "Saving Catalogue image", e.what() );
+						std::error_code ec;
+						const std::filesystem::path tempFileName = m_writer->fileNamePlug()->getValue();
+						try
+						{
+							m_writer->taskPlug()->execute();
+							std::filesystem::rename( tempFileName, m_fileName );
+						}
+						catch( const std::exception &e )
+						{
+							IECore::msg( IECore::Msg::Error, "Saving Catalogue image", e.what() );
+							std::filesystem::remove( tempFileName, ec );
+						}
 					}
 
 					// Schedule execution of wrapUp() on the UI thread,
@@ -629,7 +759,7 @@ class Catalogue::InternalImage : public ImageNode
 				{
 					// Set up the client to read from the saved image
 					client->text()->enabledPlug()->setValue( false );
-					client->fileNamePlug()->source<StringPlug>()->setValue( m_writer->fileNamePlug()->getValue() );
+					client->fileNamePlug()->source<StringPlug>()->setValue( m_fileName );
 					client->imageSwitch()->indexPlug()->setValue( 0 );
 					// But force hashChannelData and computeChannelData to be called
 					// so that we can reuse the cache entries created by the original
@@ -642,6 +772,7 @@ class Catalogue::InternalImage : public ImageNode
 				}
 
 				InternalImagePtr m_imageCopy;
+				const std::filesystem::path m_fileName;
 				ImageWriterPtr m_writer;
 
 				std::thread m_thread;
@@ -1022,29 +1153,12 @@ std::filesystem::path Catalogue::generateFileName( const Image *image ) const
 
 std::filesystem::path Catalogue::generateFileName( const ImagePlug *image ) const
 {
-	string directory = directoryPlug()->getValue();
-	if( const ScriptNode *script = ancestor<ScriptNode>() )
-	{
-		directory = script->context()->substitute( directory );
-	}
-	else if( IECore::StringAlgo::hasSubstitutions( directory ) )
-	{
-		// Its possible for a Catalogue to have been removed from its script
-		// and still receive an image. If it will attempt to save that image
-		// to a file which needed the script context to resolve properly, the
-		// saving will eventually error, so we return an empty string instead.
-		// Its likely this only occurs while the node is in the process of
-		// being deleted (perhaps inside python's garbage collector).
-		return "";
-	}
-
-	if( directory.empty() )
+	std::filesystem::path result = resolvedDirectory( this );
+	if( result.empty() )
 	{
 		return "";
 	}
 
-	std::filesystem::path result( directory );
-
 	// Hash all views of the image
 	IECore::MurmurHash h;
 	for( const std::string &v : image->viewNames()->readable() )
@@ -1237,6 +1351,12 @@ void Catalogue::imageReceived( Gaffer::Plug *plug )
 
 void Catalogue::plugSet( const Plug *plug )
 {
+	if( plug == directoryPlug() )
+	{
+		removeStaleTemporaryFiles( resolvedDirectory( this ) );
+		return;
+	}
+
 	// Enforce that only one image may have a particular output index
 	//
 	// We consider this code to enforce uniqueness to be easier than needing to sync indices during
@@ -39,11 +39,39 @@
 
 #include "GafferImage/ImageAlgo.h"
 
+#include "Gaffer/Process.h"
+
 #include "IECore/StringAlgo.h"
 
+#include <atomic>
+
 using namespace Gaffer;
 using namespace GafferImage;
 
+namespace
+{
+
+std::atomic_bool g_fusionEnabled( true );
+
+// Performs the processing for one stage of a fused chain on behalf of
+// that stage's node, so that errors and monitoring statistics are
+// attributed to the node's output rather than to the end of the chain.
+class FusedStageProcess : public Process
+{
+
+	public :
+
+		FusedStageProcess( const ChannelDataProcessor *node )
+			:	Process( ValuePlug::computeProcessType(), node->outPlug()->channelDataPlug() )
+		{
+		}
+
+		using Process::handleException;
+
+};
+
+} // namespace
+
 GAFFER_NODE_DEFINE_TYPE( ChannelDataProcessor );
 
 size_t ChannelDataProcessor::g_firstPlugIndex = 0;
@@ -102,6 +130,16 @@ const Gaffer::BoolPlug *ChannelDataProcessor::processUnpremultipliedPlug() const
 	return getChild<BoolPlug>( g_firstPlugIndex + 1 );
 }
 
+void ChannelDataProcessor::setFusionEnabled( bool enabled )
+{
+	g_fusionEnabled = enabled;
+}
+
+bool ChannelDataProcessor::getFusionEnabled()
+{
+	return g_fusionEnabled;
+}
+
 void ChannelDataProcessor::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
 {
 	ImageProcessor::affects( input, outputs );
@@ -169,8 +207,64 @@ void ChannelDataProcessor::hashChannelData( const GafferImage::ImagePlug *output
 
 IECore::ConstFloatVectorDataPtr ChannelDataProcessor::computeChannelData( const std::string &channelName, const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent ) const
 {
-	IECore::FloatVectorDataPtr outData = inPlug()->channelData( channelName, tileOrigin )->copy();
+	std::vector<const ChannelDataProcessor *> upstreamProcessors;
+	const ImagePlug *input = fusedInput( channelName, context, upstreamProcessors );
+
+	IECore::ConstFloatVectorDataPtr inData = input->channelData( channelName, tileOrigin );
+
+	float constantValue;
+	bool constant = ImagePlug::isConstantTile( inData.get(), constantValue ) && constantTileSupported( channelName, context );
+	for( auto it = upstreamProcessors.begin(), eIt = upstreamProcessors.end(); constant && it != eIt; ++it )
+	{
+		constant = (*it)->constantTileSupported( channelName, context );
+	}
+
+	IECore::FloatVectorDataPtr outData = constant ? new IECore::FloatVectorData( std::vector<float>( 1, constantValue ) ) : inData->copy();
+	for( auto it = upstreamProcessors.rbegin(), eIt = upstreamProcessors.rend(); it != eIt; ++it )
+	{
+		FusedStageProcess process( *it );
+		try
+		{
+			(*it)->processTile( channelName, context, (*it)->outPlug(), outData );
+		}
+		catch( ... )
+		{
+			process.handleException();
+		}
+	}
+
+	processTile( channelName, context, parent, outData );
+
+	if( constant )
+	{
+		return ImagePlug::constantTile( outData->readable()[0] );
+	}
+	return outData;
+}
+
+bool ChannelDataProcessor::processesConstantTiles( const Gaffer::Context *context, const std::string &channel ) const
+{
+	return false;
+}
 
+bool ChannelDataProcessor::constantTileSupported( const std::string &channelName, const Gaffer::Context *context ) const
+{
+	if( m_hasUnpremultPlug && channelName != ImageAlgo::channelNameA )
+	{
+		// Unpremultiplying requires the alpha tile, which
+		// we don't expect to be constant.
+		ImagePlug::GlobalScope globalScope( context );
+		if( processUnpremultipliedPlug()->getValue() )
+		{
+			return false;
+		}
+	}
+
+	return processesConstantTiles( context, channelName );
+}
+
+void ChannelDataProcessor::processTile( const std::string &channelName, const Gaffer::Context *context, const ImagePlug *parent, const IECore::FloatVectorDataPtr &outData ) const
+{
 	IECore::ConstStringVectorDataPtr channelNamesData;
 	bool unpremult = false;
 	bool repremultByProcessedAlpha = false;
@@ -250,5 +344,51 @@ IECore::ConstFloatVectorDataPtr ChannelDataProcessor::computeChannelData( const
 		}
 
 	}
-	return outData;
+}
+
+const ImagePlug *ChannelDataProcessor::fusedInput( const std::string &channelName, const Gaffer::Context *context, std::vector<const ChannelDataProcessor *> &upstreamProcessors ) const
+{
+	const ImagePlug *input = inPlug();
+	if( !g_fusionEnabled )
+	{
+		return input;
+	}
+
+	while( true )
+	{
+		// Follow the connections to the upstream node. We only fuse with nodes
+		// whose output is used by us alone, because otherwise we would be
+		// denying the other consumers the cached result.
+		const Plug *source = input->channelDataPlug();
+		while( const Plug *sourceInput = source->getInput() )
+		{
+			if( sourceInput->outputs().size() != 1 )
+			{
+				return input;
+			}
+			source = sourceInput;
+		}
+
+		const ChannelDataProcessor *upstream = IECore::runTimeCast<const ChannelDataProcessor>( source->node() );
+		if( !upstream || source != upstream->outPlug()->channelDataPlug() )
+		{
+			return input;
+		}
+
+		// Mirror the pass-through logic in `ImageProcessor::hash()` and
+		// `ImageProcessor::compute()`, skipping over disabled nodes entirely.
+		bool passThrough;
+		{
+			ImagePlug::GlobalScope globalScope( context );
+			passThrough = !upstream->enabled();
+		}
+		passThrough = passThrough || !upstream->channelEnabled( channelName );
+
+		if( !passThrough )
+		{
+			upstreamProcessors.push_back( upstream );
+		}
+
+		input = upstream->inPlug();
+	}
 }
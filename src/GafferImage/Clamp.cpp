@@ -259,3 +259,9 @@ void Clamp::processChannelData( const Gaffer::Context *context, const ImagePlug
 
 	}
 }
+
+bool Clamp::processesConstantTiles( const Gaffer::Context *context, const std::string &channel ) const
+{
+	// Each pixel is clamped independently.
+	return true;
+}
@@ -192,9 +192,5 @@ IECore::ConstFloatVectorDataPtr Constant::computeChannelData( const std::string
 		throw IECore::Exception( "Constant : Invalid channel: " + context->get<std::string>( ImagePlug::channelNameContextName ) );
 	}
 	const float value = colorPlug()->getChild( channelIndex )->getValue();
-
-	FloatVectorDataPtr result = new FloatVectorData;
-	result->writable().resize( ImagePlug::tileSize() * ImagePlug::tileSize(), value );
-
-	return result;
+	return ImagePlug::constantTile( value );
 }
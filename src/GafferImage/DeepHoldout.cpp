@@ -162,6 +162,18 @@ void DeepHoldout::affects( const Gaffer::Plug *input, AffectedPlugsContainer &ou
 	}
 }
 
+Gaffer::ValuePlug::CachePolicy DeepHoldout::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == intermediateInPlug()->channelDataPlug() )
+	{
+		// The intermediate channels are either passed straight through from the
+		// input, or are cheap to compute, and are read only once by the internal
+		// DeepState.
+		return ValuePlug::CachePolicy::Uncached;
+	}
+	return ImageProcessor::computeCachePolicy( output );
+}
+
 void DeepHoldout::hashChannelNames( const GafferImage::ImagePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	ImageProcessor::hashChannelNames( output, context, h );
@@ -40,6 +40,8 @@
 #include "GafferImage/ImageAlgo.h"
 #include "GafferImage/DeepState.h"
 
+#include <algorithm>
+
 using namespace std;
 using namespace Imath;
 using namespace IECore;
@@ -698,40 +700,46 @@ IECore::ConstFloatVectorDataPtr sumByWeights( const std::vector<float> &input,
 	return resultData;
 }
 
-// Given the Z and ZBack channels, and corresponding sampleOffsets, return an IntVectorData
-// a list of sample indices that would produce sorted samples.
-IECore::IntVectorDataPtr computeSampleSorting(
-	const vector<int> &sampleOffsets, const vector<float> &z, const vector<float> &zBack
-)
+// Sort key for a single sample. Samples are ordered by Z, then by ZBack, and
+// finally by their original index, so the order is total and the result
+// doesn't depend on the sorting algorithm used.
+struct SortKey
 {
-	// We compare based on the Z channel - if it is equal, compare based on ZBack
-	struct CompareDepth
+	float z;
+	float zBack;
+	int index;
+};
+
+inline bool operator < ( const SortKey &a, const SortKey &b )
+{
+	if( a.z != b.z )
+	{
+		return a.z < b.z;
+	}
+	else if( a.zBack != b.zBack )
+	{
+		return a.zBack < b.zBack;
+	}
+	else
 	{
-		const vector<float> &m_zSamples;
-		const vector<float> &m_zBackSamples;
+		// If everything is equal, preserve initial order
+		return a.index < b.index;
+	}
+}
 
-		CompareDepth( const vector<float> &zSamples, const vector<float> &zBackSamples )
-			: m_zSamples( zSamples ), m_zBackSamples( zBackSamples )
-		{}
-
-		bool operator()( int a, int b ) const
-		{
-			if( m_zSamples[a] != m_zSamples[b] )
-			{
-				return m_zSamples[a] < m_zSamples[b];
-			}
-			else if( m_zBackSamples[a] != m_zBackSamples[b] )
-			{
-				return m_zBackSamples[a] < m_zBackSamples[b];
-			}
-			else
-			{
-				// If everything is equal, preserve initial order
-				return a < b;
-			}
-		}
-	};
+// Pixels with up to this many samples are sorted with an insertion sort,
+// and larger pixels with `std::sort()`.
+const int g_maxInsertionSortSize = 32;
 
+// Given the Z and ZBack channels, and corresponding sampleOffsets, return an IntVectorData
+// a list of sample indices that would produce sorted samples. If `sortedZ` and `sortedZBack`
+// are provided, they are filled with the sorted depths, as would be produced by
+// `sortByIndices()`, but without the overhead of a separate pass.
+IECore::IntVectorDataPtr computeSampleSorting(
+	const vector<int> &sampleOffsets, const vector<float> &z, const vector<float> &zBack,
+	vector<float> *sortedZ = nullptr, vector<float> *sortedZBack = nullptr
+)
+{
 	IntVectorDataPtr resultData = new IntVectorData();
 	std::vector<int> &result = resultData->writable();
 	result.resize( sampleOffsets.back() );
@@ -740,16 +748,86 @@ IECore::IntVectorDataPtr computeSampleSorting(
 		result[i] = i;
 	}
 
-	CompareDepth compare( z, zBack );
+	if( sortedZ )
+	{
+		*sortedZ = z;
+	}
+	if( sortedZBack )
+	{
+		*sortedZBack = zBack;
+	}
+
+	// We sort keys gathered into a contiguous buffer, rather than sorting
+	// the indices directly. This keeps the comparisons local, instead of
+	// indirecting into the Z and ZBack channels for every one, and leaves
+	// us with the sorted depths as well as the indices.
+	vector<SortKey> keys;
 
 	int prevOffset = 0;
 	for( int offset : sampleOffsets )
 	{
-		if( offset > prevOffset )
+		const int n = offset - prevOffset;
+
+		// Skip pixels which are already in order, leaving the identity
+		// indices in place. This is common, since many pixels are sorted
+		// even when the tile as a whole is not.
+		bool sorted = true;
+		for( int i = prevOffset + 1; i < offset; ++i )
 		{
-			std::sort( &result[prevOffset], &result[offset], compare );
-			prevOffset = offset;
+			if( SortKey{ z[i], zBack[i], i } < SortKey{ z[i-1], zBack[i-1], i - 1 } )
+			{
+				sorted = false;
+				break;
+			}
 		}
+
+		if( !sorted )
+		{
+			keys.resize( n );
+			if( n <= g_maxInsertionSortSize )
+			{
+				for( int i = 0; i < n; ++i )
+				{
+					const SortKey key = { z[prevOffset + i], zBack[prevOffset + i], prevOffset + i };
+					int j = i;
+					for( ; j > 0 && key < keys[j-1]; --j )
+					{
+						keys[j] = keys[j-1];
+					}
+					keys[j] = key;
+				}
+			}
+			else
+			{
+				for( int i = 0; i < n; ++i )
+				{
+					keys[i] = { z[prevOffset + i], zBack[prevOffset + i], prevOffset + i };
+				}
+				std::sort( keys.begin(), keys.end() );
+			}
+
+			for( int i = 0; i < n; ++i )
+			{
+				result[prevOffset + i] = keys[i].index;
+			}
+
+			if( sortedZ )
+			{
+				for( int i = 0; i < n; ++i )
+				{
+					(*sortedZ)[prevOffset + i] = keys[i].z;
+				}
+			}
+			if( sortedZBack )
+			{
+				for( int i = 0; i < n; ++i )
+				{
+					(*sortedZBack)[prevOffset + i] = keys[i].zBack;
+				}
+			}
+		}
+
+		prevOffset = offset;
 	}
 
 	return resultData;
@@ -1109,9 +1187,25 @@ void DeepState::compute( Gaffer::ValuePlug *output, const Gaffer::Context *conte
 
 	if( !isSorted )
 	{
-		sampleSortingData = computeSampleSorting(
+		if( requestedDeepState == TargetState::Sorted )
+		{
+			sampleSortingData = computeSampleSorting(
 				sampleOffsetsData->readable(), zData->readable(), zBackData->readable()
 			);
+		}
+		else
+		{
+			// We need the sorted Z and ZBack before we can merge samples, and it is
+			// cheapest to get them at the same time as the sort indices.
+			FloatVectorDataPtr sortedZData = new FloatVectorData;
+			FloatVectorDataPtr sortedZBackData = hasZBack ? new FloatVectorData : nullptr;
+			sampleSortingData = computeSampleSorting(
+				sampleOffsetsData->readable(), zData->readable(), zBackData->readable(),
+				&sortedZData->writable(), sortedZBackData ? &sortedZBackData->writable() : nullptr
+			);
+			zData = sortedZData;
+			zBackData = hasZBack ? sortedZBackData : sortedZData;
+		}
 	}
 
 	if( requestedDeepState == TargetState::Sorted )
@@ -1124,21 +1218,6 @@ void DeepState::compute( Gaffer::ValuePlug *output, const Gaffer::Context *conte
 	}
 	else
 	{
-		if( sampleSortingData )
-		{
-			// If the input is unsorted, we need to apply the sort to Z and ZBack before
-			// we can merge samples
-			zData = sortByIndices( zData->readable(), sampleSortingData->readable() );
-			if( hasZBack )
-			{
-				zBackData = sortByIndices( zBackData->readable(), sampleSortingData->readable() );
-			}
-			else
-			{
-				zBackData = zData;
-			}
-		}
-
 		// Set up the sample merge data
 		SampleMerge sampleMerge( sampleOffsetsData->readable(),
 			hasZ ? &zData->readable() : nullptr, hasZ ? &zBackData->readable() : nullptr );
@@ -1250,6 +1329,18 @@ void DeepState::compute( Gaffer::ValuePlug *output, const Gaffer::Context *conte
 	static_cast<CompoundObjectPlug *>( output )->setValue( result );
 }
 
+Gaffer::ValuePlug::CachePolicy DeepState::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == sampleMappingPlug() )
+	{
+		// The sample mapping is needed by every channel of the tile, and those
+		// are typically computed concurrently. Collaborate so that we only sort
+		// and merge the samples once.
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
+	return ImageProcessor::computeCachePolicy( output );
+}
+
 void DeepState::hashChannelData( const GafferImage::ImagePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	ImageProcessor::hashChannelData( output, context, h );
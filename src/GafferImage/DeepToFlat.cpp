@@ -234,6 +234,17 @@ void DeepToFlat::compute( Gaffer::ValuePlug *output, const Gaffer::Context *cont
 	}
 }
 
+Gaffer::ValuePlug::CachePolicy DeepToFlat::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == intermediateChannelDataPlug() )
+	{
+		// As for DeepHoldout, these are either passed through or cheap to
+		// compute, and are read only once by the internal DeepState.
+		return ValuePlug::CachePolicy::Uncached;
+	}
+	return ImageProcessor::computeCachePolicy( output );
+}
+
 void DeepToFlat::hashChannelNames( const GafferImage::ImagePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	ImageProcessor::hashChannelNames( output, context, h );
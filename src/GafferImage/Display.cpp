@@ -164,41 +164,55 @@ class GafferDisplayDriver : public IECoreImage::DisplayDriver
 		{
 			Box2i gafferBox = m_gafferFormat.fromEXRSpace( box );
 
+			const int numChannels = channelNames().size();
+			const size_t srcRowStride = ( box.size().x + 1 ) * numChannels;
+			vector<Tile *> tiles( numChannels );
+
 			const V2i boxMinTileOrigin = ImagePlug::tileOrigin( gafferBox.min );
 			const V2i boxMaxTileOrigin = ImagePlug::tileOrigin( gafferBox.max - Imath::V2i( 1 ) );
 			for( int tileOriginY = boxMinTileOrigin.y; tileOriginY <= boxMaxTileOrigin.y; tileOriginY += ImagePlug::tileSize() )
 			{
 				for( int tileOriginX = boxMinTileOrigin.x; tileOriginX <= boxMaxTileOrigin.x; tileOriginX += ImagePlug::tileSize() )
 				{
-					for( int channelIndex = 0, numChannels = channelNames().size(); channelIndex < numChannels; ++channelIndex )
+					const V2i tileOrigin( tileOriginX, tileOriginY );
+					for( int channelIndex = 0; channelIndex < numChannels; ++channelIndex )
 					{
-						const V2i tileOrigin( tileOriginX, tileOriginY );
-						Tile * tile = getTile( tileOrigin, channelIndex );
-						if( !tile )
-						{
-							// we've been sent data outside of the data window
-							continue;
-						}
+						tiles[channelIndex] = getTile( tileOrigin, channelIndex );
+					}
+
+					if( !numChannels || !tiles[0] )
+					{
+						// we've been sent data outside of the data window
+						continue;
+					}
 
-						vector<float> &buffer = tile->backBuffer;
-						const Box2i tileBound( tileOrigin, tileOrigin + Imath::V2i( GafferImage::ImagePlug::tileSize() ) );
-						const Box2i transferBound = IECore::boxIntersection( tileBound, gafferBox );
+					const Box2i tileBound( tileOrigin, tileOrigin + Imath::V2i( GafferImage::ImagePlug::tileSize() ) );
+					const Box2i transferBound = IECore::boxIntersection( tileBound, gafferBox );
+					const int width = transferBound.size().x;
 
-						for( int y = transferBound.min.y; y<transferBound.max.y; ++y )
+					// The bucket data is interleaved, so we transfer a row at a time
+					// for all channels. This keeps the source row in cache while we
+					// deinterleave it, rather than streaming through the whole bucket
+					// once per channel.
+					for( int y = transferBound.min.y; y<transferBound.max.y; ++y )
+					{
+						const int srcY = m_gafferFormat.toEXRSpace( y );
+						const float *srcRow = data + ( srcY - box.min.y ) * srcRowStride + ( transferBound.min.x - box.min.x ) * numChannels;
+						const size_t dstIndex = ( y - tileBound.min.y ) * ImagePlug::tileSize() + transferBound.min.x - tileBound.min.x;
+						for( int channelIndex = 0; channelIndex < numChannels; ++channelIndex )
 						{
-							int srcY = m_gafferFormat.toEXRSpace( y );
-							size_t srcIndex = ( ( srcY - box.min.y ) * ( box.size().x + 1 ) + ( transferBound.min.x - box.min.x ) ) * numChannels + channelIndex;
-							size_t dstIndex = ( y - tileBound.min.y ) * ImagePlug::tileSize() + transferBound.min.x - tileBound.min.x;
-							const size_t srcEndIndex = srcIndex + transferBound.size().x * numChannels;
-							while( srcIndex < srcEndIndex )
+							const float *src = srcRow + channelIndex;
+							float *dst = tiles[channelIndex]->backBuffer.data() + dstIndex;
+							for( int x = 0; x < width; ++x )
 							{
-								buffer[dstIndex] = data[srcIndex];
-								srcIndex += numChannels;
-								dstIndex++;
+								dst[x] = src[x * numChannels];
 							}
 						}
+					}
 
-						tile->dirty = true;
+					for( int channelIndex = 0; channelIndex < numChannels; ++channelIndex )
+					{
+						tiles[channelIndex]->version.fetch_add( 1, std::memory_order_release );
 					}
 				}
 			}
@@ -252,10 +266,11 @@ class GafferDisplayDriver : public IECoreImage::DisplayDriver
 				return tile->cachedTile;
 			}
 
-			if( !tile->dirty )
+			const uint64_t version = tile->version.load( std::memory_order_acquire );
+			if( version == tile->cachedVersion )
 			{
 				// Remember that the tile value for this dataCount will always be the
-				// undirtied version.  If the tile is dirtied, we won't get the update
+				// current version.  If the tile is written again, we won't get the update
 				// until the dataCount is incremented in the dataReceived callback
 				// and we get called again
 				tile->cachedForDataCount = dataCount;
@@ -270,9 +285,12 @@ class GafferDisplayDriver : public IECoreImage::DisplayDriver
 			// to produce some visual result.  In the scenario where the value we get is half
 			// written, that means imageData() is about to call dataReceivedSignal() to trigger
 			// us again, and the incorrect value will be soon overwritten with a correct one.
+			// Because we record the version we read _before_ copying, any write that overlaps
+			// the copy bumps the version past `cachedVersion`, so the tile is guaranteed to be
+			// copied again on the next dataCount.
 			tile->cachedTile = new FloatVectorData( tile->backBuffer );
+			tile->cachedVersion = version;
 			tile->cachedForDataCount = dataCount;
-			tile->dirty = false;
 
 			// Forcing the channel data vector to precompute the hash while we're still holding
 			// lock prevents two threads from trying to compute it at the same time.
@@ -313,7 +331,7 @@ class GafferDisplayDriver : public IECoreImage::DisplayDriver
 
 		struct Tile
 		{
-			Tile(): backBuffer( ImagePlug::blackTile()->readable() ), dirty( false ), cachedTile( ImagePlug::blackTile() ), cachedForDataCount( 0 )
+			Tile(): backBuffer( ImagePlug::blackTile()->readable() ), version( 0 ), cachedTile( ImagePlug::blackTile() ), cachedVersion( 0 ), cachedForDataCount( 0 )
 			{
 			}
 
@@ -329,8 +347,9 @@ class GafferDisplayDriver : public IECoreImage::DisplayDriver
 				tbb::spin_rw_mutex::scoped_lock tileLock( other.mutex, /* write = */ false );
 
 				memcpy( &backBuffer[0], &other.backBuffer[0], backBuffer.size() * sizeof( float ) );
-				dirty = (bool)other.dirty;
+				version = other.version.load();
 				cachedTile = other.cachedTile;
+				cachedVersion = other.cachedVersion;
 
 				// Tile assignment operator is used by `Display::setDriver( copy = true )`
 				// to take a snapshot of the driver in its current state. Reset the data count
@@ -341,11 +360,13 @@ class GafferDisplayDriver : public IECoreImage::DisplayDriver
 			}
 
 			std::vector<float> backBuffer;
-			std::atomic<bool> dirty;
+			// Incremented by `imageData()` each time `backBuffer` is written.
+			std::atomic<uint64_t> version;
 			mutable tbb::spin_rw_mutex mutex;
 
-			// Use mutex to access these 2
+			// Use mutex to access these 3
 			ConstFloatVectorDataPtr cachedTile;
+			uint64_t cachedVersion; // Version of `backBuffer` that `cachedTile` was copied from
 			int cachedForDataCount;
 		};
 
@@ -392,7 +413,7 @@ GAFFER_NODE_DEFINE_TYPE( Display );
 size_t Display::g_firstPlugIndex = 0;
 
 Display::Display( const std::string &name )
-	:	ImageNode( name )
+	:	ImageNode( name ), m_dataReceivedPending( false )
 {
 	storeIndexOfNextChild( g_firstPlugIndex );
 
@@ -702,6 +723,14 @@ void Display::dataReceived()
 		return;
 	}
 
+	// Renderers send many buckets between each update on the UI thread.
+	// If we already have an update pending then it will account for this
+	// data too, so we can return without contending for the batch mutex.
+	if( m_dataReceivedPending.exchange( true ) )
+	{
+		return;
+	}
+
 	bool scheduleUpdate = false;
 	{
 		// To minimise overhead we perform updates in batches by storing
@@ -755,6 +784,9 @@ void Display::dataReceivedUI()
 			// the time we're called, so we must check.
 			if( Display *display = runTimeCast<Display>( plug->node() ) )
 			{
+				// Clear the pending flag _before_ incrementing the count, so that
+				// data received from now on schedules another update.
+				display->m_dataReceivedPending = false;
 				display->channelDataCountPlug()->setValue( display->channelDataCountPlug()->getValue() + 1 );
 			}
 		}
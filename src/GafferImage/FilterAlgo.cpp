@@ -37,6 +37,8 @@
 
 #include "GafferImage/FilterAlgo.h"
 
+#include "GafferImage/Private/RegionBuffer.h"
+
 #include "IECore/Exception.h"
 
 #include "OpenImageIO/filter.h"
@@ -377,7 +379,12 @@ float GafferImage::FilterAlgo::sampleParallelogram( Sampler &sampler, const V2f
 	return v;
 }
 
-float GafferImage::FilterAlgo::sampleBox( Sampler &sampler, const V2f &p, float dx, float dy, const OIIO::Filter2D *filter, std::vector<float> &scratchMemory )
+namespace
+{
+
+// Templated so that it can be used with both Sampler and RegionBuffer.
+template<typename S>
+float sampleBoxInternal( S &sampler, const V2f &p, float dx, float dy, const OIIO::Filter2D *filter, std::vector<float> &scratchMemory )
 {
 	float xscale = 1.0f / dx;
 	float yscale = 1.0f / dy;
@@ -451,3 +458,15 @@ float GafferImage::FilterAlgo::sampleBox( Sampler &sampler, const V2f &p, float
 
 	return v;
 }
+
+} // namespace
+
+float GafferImage::FilterAlgo::sampleBox( Sampler &sampler, const V2f &p, float dx, float dy, const OIIO::Filter2D *filter, std::vector<float> &scratchMemory )
+{
+	return sampleBoxInternal( sampler, p, dx, dy, filter, scratchMemory );
+}
+
+float GafferImage::FilterAlgo::sampleBox( const Private::RegionBuffer &regionBuffer, const V2f &p, float dx, float dy, const OIIO::Filter2D *filter, std::vector<float> &scratchMemory )
+{
+	return sampleBoxInternal( regionBuffer, p, dx, dy, filter, scratchMemory );
+}
@@ -282,6 +282,12 @@ void Grade::processChannelData( const Gaffer::Context *context, const ImagePlug
 	}
 }
 
+bool Grade::processesConstantTiles( const Gaffer::Context *context, const std::string &channel ) const
+{
+	// Each pixel is graded independently.
+	return true;
+}
+
 void Grade::parameters( size_t channelIndex, float &a, float &b, float &gamma ) const
 {
 	gamma = gammaPlug()->getChild( channelIndex )->getValue();
@@ -0,0 +1,148 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "GafferImage/Private/HalfConversion.h"
+
+#include "Imath/half.h"
+
+#include <cstdint>
+#include <cstring>
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define GAFFERIMAGE_HALFCONVERSION_F16C
+#include <immintrin.h>
+#endif
+
+using namespace Imath;
+
+//////////////////////////////////////////////////////////////////////////
+// Internal utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// We use `memcpy()` throughout because half values are not
+// necessarily aligned.
+
+void halfToFloatScalar( const char *source, size_t size, float *destination )
+{
+	for( size_t i = 0; i < size; ++i )
+	{
+		uint16_t bits;
+		memcpy( &bits, source + i * sizeof( half ), sizeof( bits ) );
+		half h;
+		h.setBits( bits );
+		destination[i] = h;
+	}
+}
+
+void floatToHalfScalar( const float *source, size_t size, char *destination )
+{
+	for( size_t i = 0; i < size; ++i )
+	{
+		const uint16_t bits = half( source[i] ).bits();
+		memcpy( destination + i * sizeof( half ), &bits, sizeof( bits ) );
+	}
+}
+
+#ifdef GAFFERIMAGE_HALFCONVERSION_F16C
+
+// We don't compile for any particular instruction set, so we compile these
+// functions specifically for F16C, and only call them if the CPU supports it.
+
+__attribute__(( target( "avx,f16c" ) ))
+void halfToFloatF16C( const char *source, size_t size, float *destination )
+{
+	size_t i = 0;
+	for( ; i + 8 <= size; i += 8 )
+	{
+		const __m128i h = _mm_loadu_si128( reinterpret_cast<const __m128i *>( source + i * sizeof( half ) ) );
+		_mm256_storeu_ps( destination + i, _mm256_cvtph_ps( h ) );
+	}
+	halfToFloatScalar( source + i * sizeof( half ), size - i, destination + i );
+}
+
+__attribute__(( target( "avx,f16c" ) ))
+void floatToHalfF16C( const float *source, size_t size, char *destination )
+{
+	size_t i = 0;
+	for( ; i + 8 <= size; i += 8 )
+	{
+		const __m128i h = _mm256_cvtps_ph( _mm256_loadu_ps( source + i ), _MM_FROUND_TO_NEAREST_INT );
+		_mm_storeu_si128( reinterpret_cast<__m128i *>( destination + i * sizeof( half ) ), h );
+	}
+	floatToHalfScalar( source + i, size - i, destination + i * sizeof( half ) );
+}
+
+#endif
+
+bool useF16C()
+{
+#ifdef GAFFERIMAGE_HALFCONVERSION_F16C
+	__builtin_cpu_init();
+	return __builtin_cpu_supports( "avx" ) && __builtin_cpu_supports( "f16c" );
+#else
+	return false;
+#endif
+}
+
+using HalfToFloatFunction = void (*)( const char *, size_t, float * );
+using FloatToHalfFunction = void (*)( const float *, size_t, char * );
+
+#ifdef GAFFERIMAGE_HALFCONVERSION_F16C
+const HalfToFloatFunction g_halfToFloat = useF16C() ? halfToFloatF16C : halfToFloatScalar;
+const FloatToHalfFunction g_floatToHalf = useF16C() ? floatToHalfF16C : floatToHalfScalar;
+#else
+const HalfToFloatFunction g_halfToFloat = halfToFloatScalar;
+const FloatToHalfFunction g_floatToHalf = floatToHalfScalar;
+#endif
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// Public functions
+//////////////////////////////////////////////////////////////////////////
+
+void GafferImage::Private::halfToFloat( const void *source, size_t size, float *destination )
+{
+	g_halfToFloat( static_cast<const char *>( source ), size, destination );
+}
+
+void GafferImage::Private::floatToHalf( const float *source, size_t size, void *destination )
+{
+	g_floatToHalf( source, size, static_cast<char *>( destination ) );
+}
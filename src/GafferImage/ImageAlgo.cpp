@@ -36,12 +36,16 @@
 
 #include "GafferImage/ImageAlgo.h"
 
+#include "Gaffer/BackgroundTask.h"
+#include "Gaffer/Process.h"
+
 #include "IECore/CompoundData.h"
 
 #include "Imath/ImathBox.h"
 
 #include "fmt/format.h"
 
+#include <atomic>
 #include <set>
 #include <regex>
 
@@ -55,6 +59,8 @@ using namespace GafferImage;
 namespace
 {
 
+std::atomic_int g_tilePrefetchRows( 1 );
+
 class CopyTile
 {
 
@@ -540,3 +546,117 @@ bool GafferImage::ImageAlgo::viewIsValid( const Gaffer::Context *context, const
 
 	return false;
 }
+
+void GafferImage::ImageAlgo::setTilePrefetchRows( int rows )
+{
+	g_tilePrefetchRows = std::max( rows, 0 );
+}
+
+int GafferImage::ImageAlgo::getTilePrefetchRows()
+{
+	return g_tilePrefetchRows;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// TilePrefetcher
+//////////////////////////////////////////////////////////////////////////
+
+ImageAlgo::Detail::TilePrefetcher::TilePrefetcher( const ImagePlug *imagePlug, const std::vector<std::string> &channelNames, const Imath::Box2i &window, TileOrder tileOrder )
+	:	m_imagePlug( imagePlug ),
+		m_channelNames( channelNames ),
+		m_range( ImagePlug::tileOrigin( window.min ), ImagePlug::tileOrigin( window.max - Imath::V2i( 1 ) ) ),
+		m_rowStep( tileOrder == BottomToTop ? ImagePlug::tileSize() : -ImagePlug::tileSize() ),
+		m_numRows( channelNames.size() ? getTilePrefetchRows() : 0 ),
+		// The first row is never prefetched, because it will be
+		// processed immediately.
+		m_nextRow( ( tileOrder == BottomToTop ? m_range.min.y : m_range.max.y ) + m_rowStep )
+{
+	const Gaffer::Process *process = Gaffer::Process::current();
+	if( process && ( process->type() == Gaffer::ValuePlug::computeProcessType() || process->type() == Gaffer::ValuePlug::hashProcessType() ) )
+	{
+		return;
+	}
+
+	if( m_numRows && m_range.min.y != m_range.max.y )
+	{
+		// Transfer the caller's context and monitors to the prefetch
+		// tasks. The context remains valid for the lifetime of the
+		// tasks, because our destructor waits for them to complete.
+		m_threadState = Gaffer::ThreadState::current();
+	}
+}
+
+ImageAlgo::Detail::TilePrefetcher::~TilePrefetcher()
+{
+	// Cancel everything first, so that waiting for one task
+	// doesn't delay the cancellation of the next.
+	for( auto &task : m_tasks )
+	{
+		task->cancel();
+	}
+	for( auto &task : m_tasks )
+	{
+		task->wait();
+	}
+}
+
+void ImageAlgo::Detail::TilePrefetcher::tileIssued( const Imath::V2i &tileOrigin )
+{
+	if( !m_threadState || tileOrigin.x != m_range.min.x )
+	{
+		// Prefetching disabled, or not the first tile in a row.
+		return;
+	}
+
+	while(
+		m_nextRow >= m_range.min.y && m_nextRow <= m_range.max.y &&
+		( m_nextRow - tileOrigin.y ) / m_rowStep <= m_numRows
+	)
+	{
+		const int y = m_nextRow;
+		// We don't pass a subject to the BackgroundTask, because we wait
+		// for completion before returning to the caller, so there is no
+		// possibility of graph edits being made concurrently.
+		m_tasks.push_back(
+			std::make_unique<Gaffer::BackgroundTask>(
+				nullptr,
+				[this, y] ( const IECore::Canceller &canceller ) {
+					prefetchRow( y, canceller );
+				}
+			)
+		);
+		m_nextRow += m_rowStep;
+	}
+}
+
+void ImageAlgo::Detail::TilePrefetcher::prefetchRow( int y, const IECore::Canceller &canceller ) const
+{
+	Gaffer::ThreadState::Scope threadStateScope( *m_threadState );
+	// Use the BackgroundTask's canceller, so that cancellation in our
+	// destructor interrupts any prefetch computes in progress.
+	const Gaffer::Context context( *Gaffer::Context::current(), canceller );
+	ImagePlug::ChannelDataScope channelDataScope( &context );
+
+	// Prefetch from right to left. The row will be processed from left to
+	// right, so this way we meet in the middle rather than duplicating work
+	// by computing the same tiles concurrently.
+	for( Imath::V2i tileOrigin( m_range.max.x, y ); tileOrigin.x >= m_range.min.x; tileOrigin.x -= ImagePlug::tileSize() )
+	{
+		channelDataScope.setTileOrigin( &tileOrigin );
+		for( const auto &channelName : m_channelNames )
+		{
+			IECore::Canceller::check( &canceller );
+			channelDataScope.setChannelName( &channelName );
+			try
+			{
+				m_imagePlug->channelDataPlug()->getValue();
+			}
+			catch( ... )
+			{
+				// Any error will be reported when the tile is processed
+				// for real, so we just abandon prefetching.
+				return;
+			}
+		}
+	}
+}
@@ -285,6 +285,23 @@ void ImageNode::compute( ValuePlug *output, const Context *context ) const
 	}
 }
 
+IECore::InternedString ImageNode::computeCachePartition( const Gaffer::ValuePlug *output ) const
+{
+	// Tiles typically account for the bulk of the memory used by an image.
+	// We keep them apart from the other image values, so that a large number
+	// of tiles can't evict the lightweight values needed to process them.
+	static const IECore::InternedString g_tilesPartition( "imageTiles" );
+	static const IECore::InternedString g_partition( "image" );
+	if( auto parent = output->parent<ImagePlug>() )
+	{
+		if( output == parent->channelDataPlug() || output == parent->sampleOffsetsPlug() )
+		{
+			return g_tilesPartition;
+		}
+	}
+	return g_partition;
+}
+
 IECore::ConstStringVectorDataPtr ImageNode::computeViewNames( const Gaffer::Context *context, const ImagePlug *parent ) const
 {
 	throw IECore::NotImplementedException( string( typeName() ) + "::computeViewNames" );
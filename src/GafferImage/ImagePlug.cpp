@@ -46,6 +46,12 @@
 #include "Gaffer/Context.h"
 #include "Gaffer/ContextAlgo.h"
 
+#include "tbb/spin_mutex.h"
+
+#include <array>
+#include <atomic>
+#include <cstring>
+
 using namespace std;
 using namespace tbb;
 using namespace Imath;
@@ -200,6 +206,93 @@ const IECore::FloatVectorData *ImagePlug::blackTile()
 	return g_blackTile.get();
 };
 
+namespace
+{
+
+// Constant tiles are stored in a direct-mapped table indexed by the bits of
+// their value. This bounds the memory used by the table, at the expense of
+// occasionally allocating a new tile when two values map to the same slot.
+struct ConstantTileSlot
+{
+	tbb::spin_mutex mutex;
+	IECore::ConstFloatVectorDataPtr tile;
+	// Mirrors `tile`, so that `isConstantTile()` can check identity
+	// without taking the lock.
+	std::atomic<const IECore::FloatVectorData *> tilePointer = nullptr;
+};
+
+const size_t g_numConstantTileSlots = 256;
+std::array<ConstantTileSlot, g_numConstantTileSlots> g_constantTileSlots;
+
+uint32_t valueBits( float value )
+{
+	uint32_t result;
+	memcpy( &result, &value, sizeof( result ) );
+	return result;
+}
+
+ConstantTileSlot &constantTileSlot( uint32_t bits )
+{
+	// Mix the exponent and high mantissa bits into the index, since
+	// those are the ones most likely to differ between common values.
+	return g_constantTileSlots[( bits ^ ( bits >> 13 ) ^ ( bits >> 23 ) ) % g_numConstantTileSlots];
+}
+
+} // namespace
+
+IECore::ConstFloatVectorDataPtr ImagePlug::constantTile( float value )
+{
+	const uint32_t bits = valueBits( value );
+	if( bits == valueBits( 0.0f ) )
+	{
+		return blackTile();
+	}
+	else if( bits == valueBits( 1.0f ) )
+	{
+		return whiteTile();
+	}
+
+	ConstantTileSlot &slot = constantTileSlot( bits );
+	tbb::spin_mutex::scoped_lock lock( slot.mutex );
+	if( !slot.tile || valueBits( slot.tile->readable()[0] ) != bits )
+	{
+		// Publish the new pointer before releasing the old tile, so
+		// that `isConstantTile()` can never see a stale pointer to
+		// memory that has been reused for another tile.
+		IECore::ConstFloatVectorDataPtr tile = new IECore::FloatVectorData( std::vector<float>( ImagePlug::tilePixels(), value ) );
+		slot.tilePointer.store( tile.get(), std::memory_order_release );
+		slot.tile.swap( tile );
+	}
+	return slot.tile;
+}
+
+bool ImagePlug::isConstantTile( const IECore::FloatVectorData *tile, float &value )
+{
+	if( tile == blackTile() )
+	{
+		value = 0.0f;
+		return true;
+	}
+	else if( tile == whiteTile() )
+	{
+		value = 1.0f;
+		return true;
+	}
+	else if( tile->readable().size() != (size_t)ImagePlug::tilePixels() )
+	{
+		return false;
+	}
+
+	const float v = tile->readable()[0];
+	const ConstantTileSlot &slot = constantTileSlot( valueBits( v ) );
+	if( slot.tilePointer.load( std::memory_order_acquire ) == tile )
+	{
+		value = v;
+		return true;
+	}
+	return false;
+}
+
 bool ImagePlug::acceptsChild( const GraphComponent *potentialChild ) const
 {
 	if( !ValuePlug::acceptsChild( potentialChild ) )
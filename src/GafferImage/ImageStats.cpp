@@ -494,15 +494,29 @@ void ImageStats::compute( ValuePlug *output, const Context *context ) const
 		float max = -std::numeric_limits<float>::infinity();
 		double sum = 0.;
 
-		const std::vector<float> &channel = channelData->readable();
-		for( int y = tileBound.min.y; y < tileBound.max.y; ++y )
+		float constantValue;
+		if( ImagePlug::isConstantTile( channelData.get(), constantValue ) )
 		{
-			for( int x = tileBound.min.x; x < tileBound.max.x; ++x )
+			if( !BufferAlgo::empty( tileBound ) )
 			{
-				float v = channel[ x + y * ImagePlug::tileSize() ];
-				min = std::min( v, min );
-				max = std::max( v, max );
-				sum += v;
+				// The sum of up to `tilePixels()` identical floats is exact
+				// in double precision, so this matches the loop below.
+				min = max = constantValue;
+				sum = double( constantValue ) * tileBound.size().x * tileBound.size().y;
+			}
+		}
+		else
+		{
+			const std::vector<float> &channel = channelData->readable();
+			for( int y = tileBound.min.y; y < tileBound.max.y; ++y )
+			{
+				for( int x = tileBound.min.x; x < tileBound.max.x; ++x )
+				{
+					float v = channel[ x + y * ImagePlug::tileSize() ];
+					min = std::min( v, min );
+					max = std::max( v, max );
+					sum += v;
+				}
 			}
 		}
 
@@ -578,17 +578,22 @@ IECore::ConstFloatVectorDataPtr ImageTransform::computeChannelData( const std::s
 
 		FloatVectorDataPtr resultData = new FloatVectorData;
 		resultData->writable().resize( ImagePlug::tileSize() * ImagePlug::tileSize() );
-		std::vector<float>::iterator pIt = resultData->writable().begin();
+		float *result = resultData->writable().data();
 
+		// Sample a row at a time, using the batch interface
+		// to the Sampler.
 		const Box2i tileBound( tileOrigin, tileOrigin + V2i( ImagePlug::tileSize() ) );
+		std::vector<V2f> positions( ImagePlug::tileSize() );
 		V2i oP;
 		for( oP.y = tileBound.min.y; oP.y < tileBound.max.y; ++oP.y )
 		{
+			std::vector<V2f>::iterator iPIt = positions.begin();
 			for( oP.x = tileBound.min.x; oP.x < tileBound.max.x; ++oP.x )
 			{
-				V2f iP = V2f( oP.x + 0.5, oP.y + 0.5 ) * samplerMatrix;
-				*pIt++ = sampler.sample( iP.x, iP.y );
+				*iPIt++ = V2f( oP.x + 0.5, oP.y + 0.5 ) * samplerMatrix;
 			}
+			sampler.sample( positions.data(), positions.size(), result );
+			result += ImagePlug::tileSize();
 		}
 
 		return resultData;
@@ -271,17 +271,19 @@ class FlatTileWriter
 	// so set the appropriate m_tilesFilled value.
 	//
 	// After flagging filled tiles, it iterates through tiles, starting at
-	// m_nextTileIndex, and for each tile, if the tile is marked as filled,
-	// write it, and if the tile does not intersect the region covered by the
-	// input tiles, write a black tile. If neither of these is the case, stop,
-	// and set m_nextTileIndex to the tile that it stopped on, which is the
-	// next tile to write.
+	// m_nextTileIndex, checking that each tile is either marked as filled,
+	// or does not intersect the region covered by the input tiles (in which
+	// case it is black). Each complete row of such tiles is then written with
+	// a single call to `write_tiles()`, and m_nextTileIndex is set to the
+	// start of the next row. Writing whole rows at once allows the ImageOutput
+	// to compress the tiles in parallel - OpenEXR does this using its own
+	// thread pool - rather than compressing them one at a time on the thread
+	// that is gathering tiles.
 	//
 	// Once all Gaffer tiles have been processed, there may still be partially
 	// unfilled tiles, which will be fine, as their unfilled areas will be
-	// black, which is what we want. So iterate over the remaining tiles, and
-	// if memory has been allocated for that tile, write it to the file, and if
-	// nothing has been allocated, write a black tile.
+	// black, which is what we want. So write all the remaining rows, using
+	// black for any tiles that have never been allocated.
 	public:
 		FlatTileWriter(
 				ImageOutputPtr out,
@@ -299,8 +301,7 @@ class FlatTileWriter
 				m_inputTilesBounds( Imath::Box2i( ImagePlug::tileOrigin( processWindow.min ), ImagePlug::tileOrigin( processWindow.max - Imath::V2i( 1 ) ) + Imath::V2i( ImagePlug::tileSize() ) ) ),
 				m_outputDataWindow( m_format.fromEXRSpace( Imath::Box2i( Imath::V2i( m_spec.x, m_spec.y ), Imath::V2i( m_spec.x + m_spec.width - 1, m_spec.y + m_spec.height - 1 ) ) ) ),
 				m_numTiles( Imath::V2i( (int)ceil( float( m_spec.width ) / m_spec.tile_width ), (int)ceil( float( m_spec.height ) / m_spec.tile_height ) ) ),
-				m_nextTileIndex( 0 ),
-				m_blackTile( nullptr )
+				m_nextTileIndex( 0 )
 		{
 			m_tilesData.resize( m_numTiles.x * m_numTiles.y );
 			m_tilesFilled.resize( m_numTiles.x * m_numTiles.y, false );
@@ -313,21 +314,11 @@ class FlatTileWriter
 
 		void finish()
 		{
-			for( size_t tileIndex = m_nextTileIndex; tileIndex < m_tilesData.size(); ++tileIndex )
+			for( size_t rowBegin = m_nextTileIndex; rowBegin < m_tilesData.size(); rowBegin += m_numTiles.x )
 			{
-				Imath::V2i tileOrigin = outTileOrigin( tileIndex );
-				if( !m_tilesData[tileIndex]->readable().empty() )
-				{
-					writeTile( tileOrigin, m_tilesData[tileIndex] );
-				}
-				else
-				{
-					// If the tileData object hasn't been resized, then
-					// we have never even tried to write data to this
-					// tile, so write the static black tile.
-					writeTile( tileOrigin, blackTile() );
-				}
+				writeTileRow( rowBegin );
 			}
+			m_nextTileIndex = m_tilesData.size();
 		}
 
 		void operator()( const ImagePlug *imagePlug, const string &channelName, const V2i &tileOrigin, ConstFloatVectorDataPtr data )
@@ -374,16 +365,6 @@ class FlatTileWriter
 
 	private:
 
-		inline ConstFloatVectorDataPtr blackTile()
-		{
-			if( m_blackTile == nullptr )
-			{
-				m_blackTile = new IECore::FloatVectorData( std::vector<float>( m_spec.tile_width * m_spec.tile_height * m_channels.size(), 0. ) );
-			}
-
-			return m_blackTile;
-		}
-
 		inline size_t outTileIndex( const Imath::V2i &tileOrigin ) const
 		{
 			return ( ( ( m_outputDataWindow.max.y - m_spec.tile_height - tileOrigin.y ) / m_spec.tile_height ) * m_numTiles.x ) + ( ( tileOrigin.x - m_outputDataWindow.min.x ) / m_spec.tile_width );
@@ -439,34 +420,60 @@ class FlatTileWriter
 			size_t tileIndex;
 			for( tileIndex = m_nextTileIndex; tileIndex < m_tilesData.size(); ++tileIndex )
 			{
-				Imath::V2i tileOrigin = outTileOrigin( tileIndex );
-
-				if( m_tilesFilled[tileIndex] )
-				{
-					writeTile( tileOrigin, m_tilesData[tileIndex] );
-					m_tilesData[tileIndex].reset();
-				}
-				else if( !BufferAlgo::intersects( m_inputTilesBounds, outTileBounds( tileIndex ) ) )
-				{
-					writeTile( tileOrigin, blackTile() );
-				}
-				else
+				if(
+					!m_tilesFilled[tileIndex] &&
+					BufferAlgo::intersects( m_inputTilesBounds, outTileBounds( tileIndex ) )
+				)
 				{
 					break;
 				}
 			}
 
-			m_nextTileIndex = tileIndex;
+			// Write all the rows that are complete. Note that m_nextTileIndex
+			// is always at the start of a row.
+			const size_t rowsEnd = ( tileIndex / m_numTiles.x ) * m_numTiles.x;
+			for( ; m_nextTileIndex < rowsEnd; m_nextTileIndex += m_numTiles.x )
+			{
+				writeTileRow( m_nextTileIndex );
+			}
 		}
 
-
-		void writeTile( const Imath::V2i &tileOrigin, ConstFloatVectorDataPtr tileData ) const
+		// Writes the row of tiles starting at `rowBegin`, releasing their data.
+		void writeTileRow( size_t rowBegin )
 		{
-			Imath::V2i exrTileOrigin = m_format.toEXRSpace( tileOrigin + Imath::V2i( 0, m_spec.tile_height - 1 ) );
+			// Copy the tiles into a single buffer for the row. Tiles which
+			// have never been allocated are left black.
+			const size_t numChannels = m_channels.size();
+			const size_t rowWidth = m_numTiles.x * m_spec.tile_width;
+			m_rowData.assign( rowWidth * m_spec.tile_height * numChannels, 0.0f );
+			for( int i = 0; i < m_numTiles.x; ++i )
+			{
+				FloatVectorDataPtr &tileData = m_tilesData[rowBegin + i];
+				if( tileData && !tileData->readable().empty() )
+				{
+					const float *tile = tileData->readable().data();
+					const size_t tileRowSize = m_spec.tile_width * numChannels;
+					for( int y = 0; y < m_spec.tile_height; ++y )
+					{
+						std::copy(
+							tile + y * tileRowSize, tile + ( y + 1 ) * tileRowSize,
+							m_rowData.begin() + ( y * rowWidth + i * m_spec.tile_width ) * numChannels
+						);
+					}
+				}
+				tileData.reset();
+			}
 
-			if( !m_out->write_tile( exrTileOrigin.x, exrTileOrigin.y, 0, TypeDesc::FLOAT, &tileData->readable()[0] ) )
+			// The tiles at the right and bottom edges may extend outside the data
+			// window, but the region we write must not.
+			const Imath::V2i exrOrigin = m_format.toEXRSpace( outTileOrigin( rowBegin ) + Imath::V2i( 0, m_spec.tile_height - 1 ) );
+			const int xEnd = m_spec.x + m_spec.width;
+			const int yEnd = std::min( exrOrigin.y + m_spec.tile_height, m_spec.y + m_spec.height );
+
+			const stride_t xStride = numChannels * sizeof( float );
+			if( !m_out->write_tiles( exrOrigin.x, xEnd, exrOrigin.y, yEnd, 0, 1, TypeDesc::FLOAT, m_rowData.data(), xStride, xStride * rowWidth ) )
 			{
-				throw IECore::Exception( fmt::format( "Could not write tile to \"{}\", error = {}", m_fileName, m_out->geterror() ) );
+				throw IECore::Exception( fmt::format( "Could not write tiles to \"{}\", error = {}", m_fileName, m_out->geterror() ) );
 			}
 		}
 
@@ -482,7 +489,7 @@ class FlatTileWriter
 		size_t m_nextTileIndex;
 		std::vector<FloatVectorDataPtr> m_tilesData;
 		std::vector<bool> m_tilesFilled;
-		ConstFloatVectorDataPtr m_blackTile;
+		std::vector<float> m_rowData;
 };
 
 class FlatScanlineWriter
@@ -2147,13 +2154,13 @@ void ImageWriter::execute() const
 			if ( part.spec.tile_width == 0 )
 			{
 				FlatScanlineWriter flatScanlineWriter( out, fileName, part.processDataWindow, part.imageFormat, part.channels );
-				ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, flatScanlineWriter, part.processDataWindow, ImageAlgo::TopToBottom );
+				ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, flatScanlineWriter, part.processDataWindow, ImageAlgo::TopToBottom, /* prefetchChannelData = */ true );
 				flatScanlineWriter.finish();
 			}
 			else
 			{
 				FlatTileWriter flatTileWriter( out, fileName, part.processDataWindow, part.imageFormat, part.channels );
-				ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, flatTileWriter, part.processDataWindow, ImageAlgo::TopToBottom );
+				ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, flatTileWriter, part.processDataWindow, ImageAlgo::TopToBottom, /* prefetchChannelData = */ true );
 				flatTileWriter.finish();
 			}
 
@@ -2173,12 +2180,12 @@ void ImageWriter::execute() const
 			if( part.spec.tile_width == 0 )
 			{
 				DeepScanlineWriter deepScanlineWriter( out, fileName, part.processDataWindow, part.imageFormat, part.channels, sampleOffsetsAccumulator.m_sampleOffsets );
-				ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, deepScanlineWriter, part.processDataWindow, ImageAlgo::TopToBottom );
+				ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, deepScanlineWriter, part.processDataWindow, ImageAlgo::TopToBottom, /* prefetchChannelData = */ true );
 			}
 			else
 			{
 				DeepTileWriter deepTileWriter( out, fileName, part.processDataWindow, part.imageFormat, part.channels, sampleOffsetsAccumulator.m_sampleOffsets );
-				ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, deepTileWriter, part.processDataWindow, ImageAlgo::TopToBottom );
+				ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, deepTileWriter, part.processDataWindow, ImageAlgo::TopToBottom, /* prefetchChannelData = */ true );
 			}
 		}
 	}
@@ -0,0 +1,408 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "GafferImage/Private/MappedEXR.h"
+
+#include "GafferImage/Private/HalfConversion.h"
+
+#include "IECore/Exception.h"
+
+#include "Imath/half.h"
+
+#include "fmt/format.h"
+
+#include <cstring>
+
+#ifndef _MSC_VER
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+using namespace Imath;
+using namespace GafferImage::Private;
+
+//////////////////////////////////////////////////////////////////////////
+// Internal utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+const int32_t g_magic = 20000630;
+const int32_t g_tiledFlag = 0x200;
+const int32_t g_nonImageFlag = 0x800;
+const int32_t g_multiPartFlag = 0x1000;
+
+const int32_t g_halfPixelType = 1;
+const int32_t g_floatPixelType = 2;
+
+const uint8_t g_noCompression = 0;
+
+// EXR files are little endian, as are all the platforms we support, so
+// we can read values directly. We use `memcpy()` because values are not
+// aligned.
+template<typename T>
+T readValue( const char *p )
+{
+	T result;
+	memcpy( &result, p, sizeof( T ) );
+	return result;
+}
+
+// Bounds-checked reading of the file header. Throws if the
+// header extends past the end of the file.
+class HeaderReader
+{
+
+	public :
+
+		HeaderReader( const char *begin, const char *end )
+			:	m_current( begin ), m_end( end )
+		{
+		}
+
+		template<typename T>
+		T read()
+		{
+			const char *p = advance( sizeof( T ) );
+			return readValue<T>( p );
+		}
+
+		std::string readString()
+		{
+			const char *terminator = static_cast<const char *>( memchr( m_current, 0, m_end - m_current ) );
+			if( !terminator )
+			{
+				throw IECore::Exception( "Unterminated string" );
+			}
+			std::string result( m_current, terminator );
+			m_current = terminator + 1;
+			return result;
+		}
+
+		// Returns a reader for the next `size` bytes, and skips past them.
+		HeaderReader subReader( size_t size )
+		{
+			const char *p = advance( size );
+			return HeaderReader( p, p + size );
+		}
+
+		const char *current() const
+		{
+			return m_current;
+		}
+
+		size_t remaining() const
+		{
+			return m_end - m_current;
+		}
+
+	private :
+
+		const char *advance( size_t size )
+		{
+			if( remaining() < size )
+			{
+				throw IECore::Exception( "Unexpected end of header" );
+			}
+			const char *result = m_current;
+			m_current += size;
+			return result;
+		}
+
+		const char *m_current;
+		const char *m_end;
+
+};
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// MappedEXR
+//////////////////////////////////////////////////////////////////////////
+
+std::unique_ptr<MappedEXR> MappedEXR::create( const std::string &fileName )
+{
+#ifdef _MSC_VER
+
+	return nullptr;
+
+#else
+
+	const int fd = open( fileName.c_str(), O_RDONLY );
+	if( fd < 0 )
+	{
+		return nullptr;
+	}
+
+	struct stat s;
+	if( fstat( fd, &s ) != 0 || s.st_size < 8 )
+	{
+		close( fd );
+		return nullptr;
+	}
+
+	void *data = mmap( nullptr, s.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+	// The mapping remains valid after the file is closed.
+	close( fd );
+	if( data == MAP_FAILED )
+	{
+		return nullptr;
+	}
+
+	std::unique_ptr<MappedEXR> result( new MappedEXR( fileName, static_cast<const char *>( data ), s.st_size ) );
+	if( !result->parseHeader() )
+	{
+		return nullptr;
+	}
+
+	return result;
+
+#endif
+}
+
+MappedEXR::MappedEXR( const std::string &fileName, const char *data, size_t size )
+	:	m_fileName( fileName ), m_data( data ), m_size( size ), m_bytesPerPixel( 0 ),
+		m_tiled( false ), m_tileSize( 0 ), m_numTilesX( 0 ), m_offsets( nullptr ), m_numOffsets( 0 )
+{
+}
+
+MappedEXR::~MappedEXR()
+{
+#ifndef _MSC_VER
+	munmap( const_cast<char *>( m_data ), m_size );
+#endif
+}
+
+const std::vector<std::string> &MappedEXR::channelNames() const
+{
+	return m_channelNames;
+}
+
+const Imath::Box2i &MappedEXR::dataWindow() const
+{
+	return m_dataWindow;
+}
+
+void MappedEXR::readScanline( size_t channelIndex, int y, int xBegin, int xEnd, float *result ) const
+{
+	const bool isHalf = m_channels[channelIndex].half;
+	const size_t bytesPerValue = isHalf ? sizeof( half ) : sizeof( float );
+	const size_t channelOffset = m_channelOffsets[channelIndex];
+
+	auto copy = [&] ( const char *source, int size ) {
+		if( isHalf )
+		{
+			halfToFloat( source, size, result );
+		}
+		else
+		{
+			memcpy( result, source, size * sizeof( float ) );
+		}
+		result += size;
+	};
+
+	if( !m_tiled )
+	{
+		// Uncompressed scanline files store one scanline per chunk,
+		// containing all the pixels for each channel in turn.
+		const int width = m_dataWindow.size().x + 1;
+		const char *c = chunk( y - m_dataWindow.min.y, sizeof( int32_t ) * 2, width * m_bytesPerPixel );
+		if( readValue<int32_t>( c ) != y )
+		{
+			throw IECore::Exception( fmt::format( "MappedEXR : Unexpected chunk for scanline {} in \"{}\"", y, m_fileName ) );
+		}
+		c += sizeof( int32_t ) * 2 + channelOffset * width;
+		copy( c + ( xBegin - m_dataWindow.min.x ) * bytesPerValue, xEnd - xBegin );
+		return;
+	}
+
+	// Tiled files store one tile per chunk, containing the pixels of each
+	// row of the tile, with each channel in turn. Tiles at the right and
+	// top of the data window are cropped to it.
+
+	const int tileY = ( y - m_dataWindow.min.y ) / m_tileSize.y;
+	const int tileMinY = m_dataWindow.min.y + tileY * m_tileSize.y;
+	const int tileHeight = std::min( m_tileSize.y, m_dataWindow.max.y + 1 - tileMinY );
+
+	int x = xBegin;
+	while( x < xEnd )
+	{
+		const int tileX = ( x - m_dataWindow.min.x ) / m_tileSize.x;
+		const int tileMinX = m_dataWindow.min.x + tileX * m_tileSize.x;
+		const int tileWidth = std::min( m_tileSize.x, m_dataWindow.max.x + 1 - tileMinX );
+
+		const char *c = chunk( tileY * m_numTilesX + tileX, sizeof( int32_t ) * 5, tileWidth * tileHeight * m_bytesPerPixel );
+		if( readValue<int32_t>( c ) != tileX || readValue<int32_t>( c + sizeof( int32_t ) ) != tileY )
+		{
+			throw IECore::Exception( fmt::format( "MappedEXR : Unexpected chunk for tile {},{} in \"{}\"", tileX, tileY, m_fileName ) );
+		}
+		c += sizeof( int32_t ) * 5 + ( ( y - tileMinY ) * m_bytesPerPixel + channelOffset ) * tileWidth;
+
+		const int size = std::min( xEnd, tileMinX + tileWidth ) - x;
+		copy( c + ( x - tileMinX ) * bytesPerValue, size );
+		x += size;
+	}
+}
+
+bool MappedEXR::parseHeader()
+{
+	try
+	{
+		HeaderReader reader( m_data, m_data + m_size );
+		if( reader.read<int32_t>() != g_magic )
+		{
+			return false;
+		}
+
+		const int32_t version = reader.read<int32_t>();
+		if( ( version & 0xff ) != 2 || version & ( g_nonImageFlag | g_multiPartFlag ) )
+		{
+			return false;
+		}
+		m_tiled = version & g_tiledFlag;
+
+		bool haveChannels = false;
+		bool haveDataWindow = false;
+		bool haveTiles = false;
+		int compression = -1;
+
+		while( true )
+		{
+			const std::string name = reader.readString();
+			if( name.empty() )
+			{
+				break;
+			}
+
+			const std::string type = reader.readString();
+			HeaderReader attribute = reader.subReader( reader.read<int32_t>() );
+
+			if( name == "channels" && type == "chlist" )
+			{
+				while( true )
+				{
+					const std::string channelName = attribute.readString();
+					if( channelName.empty() )
+					{
+						break;
+					}
+
+					const int32_t pixelType = attribute.read<int32_t>();
+					attribute.subReader( 4 ); // pLinear and reserved bytes
+					const int32_t xSampling = attribute.read<int32_t>();
+					const int32_t ySampling = attribute.read<int32_t>();
+					if( ( pixelType != g_halfPixelType && pixelType != g_floatPixelType ) || xSampling != 1 || ySampling != 1 )
+					{
+						return false;
+					}
+
+					m_channels.push_back( { channelName, pixelType == g_halfPixelType } );
+					m_channelNames.push_back( channelName );
+					m_channelOffsets.push_back( m_bytesPerPixel );
+					m_bytesPerPixel += pixelType == g_halfPixelType ? sizeof( half ) : sizeof( float );
+				}
+				haveChannels = true;
+			}
+			else if( name == "compression" && type == "compression" )
+			{
+				compression = attribute.read<uint8_t>();
+			}
+			else if( name == "dataWindow" && type == "box2i" )
+			{
+				m_dataWindow.min.x = attribute.read<int32_t>();
+				m_dataWindow.min.y = attribute.read<int32_t>();
+				m_dataWindow.max.x = attribute.read<int32_t>();
+				m_dataWindow.max.y = attribute.read<int32_t>();
+				haveDataWindow = true;
+			}
+			else if( name == "tiles" && type == "tiledesc" )
+			{
+				m_tileSize.x = attribute.read<uint32_t>();
+				m_tileSize.y = attribute.read<uint32_t>();
+				// Files with mipmap or ripmap levels store the highest resolution
+				// level first, so we can support them all.
+				const uint8_t levelMode = attribute.read<uint8_t>() & 0xf;
+				haveTiles = levelMode <= 2;
+			}
+		}
+
+		if(
+			!haveChannels || m_channels.empty() || !haveDataWindow || m_dataWindow.isEmpty() ||
+			compression != g_noCompression || ( m_tiled && ( !haveTiles || m_tileSize.x <= 0 || m_tileSize.y <= 0 ) )
+		)
+		{
+			return false;
+		}
+
+		const V2i size = m_dataWindow.size() + V2i( 1 );
+		if( m_tiled )
+		{
+			m_numTilesX = ( size.x + m_tileSize.x - 1 ) / m_tileSize.x;
+			m_numOffsets = (size_t)m_numTilesX * ( ( size.y + m_tileSize.y - 1 ) / m_tileSize.y );
+		}
+		else
+		{
+			m_numOffsets = size.y;
+		}
+
+		if( reader.remaining() / sizeof( uint64_t ) < m_numOffsets )
+		{
+			return false;
+		}
+		m_offsets = reader.current();
+	}
+	catch( const std::exception & )
+	{
+		// Malformed header. Leave it to OpenImageIO to report the error.
+		return false;
+	}
+
+	return true;
+}
+
+const char *MappedEXR::chunk( size_t index, size_t headerSize, size_t dataSize ) const
+{
+	const uint64_t offset = index < m_numOffsets ? readValue<uint64_t>( m_offsets + index * sizeof( uint64_t ) ) : m_size + 1;
+	if( offset > m_size || m_size - offset < headerSize + dataSize )
+	{
+		throw IECore::Exception( fmt::format( "MappedEXR : Invalid chunk offset in \"{}\"", m_fileName ) );
+	}
+	return m_data + offset;
+}
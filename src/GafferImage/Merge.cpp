@@ -37,6 +37,7 @@
 #include "GafferImage/Merge.h"
 
 #include "GafferImage/ImageAlgo.h"
+#include "GafferImage/Private/MergeKernels.h"
 
 #include "Gaffer/ArrayPlug.h"
 #include "Gaffer/Context.h"
@@ -44,6 +45,10 @@
 #include "IECore/BoxOps.h"
 
 #include "fmt/format.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <limits>
 
 using namespace std;
@@ -52,6 +57,14 @@ using namespace IECore;
 using namespace Gaffer;
 using namespace GafferImage;
 
+// The SIMD kernels below must produce results identical to the scalar
+// operations, so we must not allow the compiler to fuse multiplies and adds
+// differently in each. GCC doesn't contract in ISO C++ mode, but Clang does
+// by default, and enables FMA for the AVX-512 target.
+#ifdef __clang__
+#pragma STDC FP_CONTRACT OFF
+#endif
+
 namespace
 {
 
@@ -303,6 +316,279 @@ inline MergeRegion tileRegion( int i, const Box2i &boundA, const Box2i &boundB,
 	return (MergeRegion)(( InsideA * inA ) | ( InsideB * inB ));
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Span kernels
+//////////////////////////////////////////////////////////////////////////
+
+// Applies `Op` to a span of `length` pixels, writing to the merge buffers
+// `R` and `r`. When `HasA` or `HasB` is false, the corresponding inputs
+// are not read, and zero is substituted for them. The `begin` argument
+// allows this to be used to process the tail of a span that has been
+// partially processed by a SIMD kernel.
+template<typename Op, bool HasA, bool HasB>
+inline void mergeSpanScalar( const float *A, const float *B, const float *a, const float *b, float *R, float *r, int begin, int length )
+{
+	for( int j = begin; j < length; j++ )
+	{
+		const float vA = HasA ? A[j] : 0.0f;
+		const float va = HasA ? a[j] : 0.0f;
+		const float vB = HasB ? B[j] : 0.0f;
+		const float vb = HasB ? b[j] : 0.0f;
+		R[j] = Op::operate( vA, vB, va, vb );
+		r[j] = Op::operate( va, vb, va, vb );
+	}
+}
+
+#if ( defined( __GNUC__ ) || defined( __clang__ ) ) && defined( __x86_64__ )
+#define GAFFERIMAGE_MERGE_SIMD
+#endif
+
+#ifdef GAFFERIMAGE_MERGE_SIMD
+
+// The kernels below are written using the GCC/Clang vector extensions, and
+// compiled for each instruction set using the `target` attribute. All the
+// helpers are forced inline into the target-specific functions, so the
+// warnings about vector arguments changing the ABI don't apply. Note that
+// we can't restore the warnings with `diagnostic pop`, because they are
+// emitted when templates are instantiated at the end of the file.
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+#define GAFFERIMAGE_MERGE_INLINE inline __attribute__(( always_inline ))
+
+template<typename FloatType, typename IntType, typename DoubleType>
+struct Lanes
+{
+
+	using Float = FloatType;
+	using Int = IntType;
+	using Double = DoubleType;
+
+	static constexpr int size = sizeof( Float ) / sizeof( float );
+
+	static GAFFERIMAGE_MERGE_INLINE Float load( const float *p )
+	{
+		Float result;
+		std::memcpy( &result, p, sizeof( result ) );
+		return result;
+	}
+
+	static GAFFERIMAGE_MERGE_INLINE void store( float *p, Float v )
+	{
+		std::memcpy( p, &v, sizeof( v ) );
+	}
+
+	static GAFFERIMAGE_MERGE_INLINE Float splat( float f )
+	{
+		return Float{} + f;
+	}
+
+	static GAFFERIMAGE_MERGE_INLINE Float select( Int mask, Float a, Float b )
+	{
+		return (Float)( ( mask & (Int)a ) | ( ~mask & (Int)b ) );
+	}
+
+	// Several of the scalar operations are performed in double precision,
+	// due to the use of `1.` literals. We match that precisely so that
+	// results are identical whichever kernel is used.
+
+	static GAFFERIMAGE_MERGE_INLINE Double toDouble( Float f )
+	{
+		return __builtin_convertvector( f, Double );
+	}
+
+	static GAFFERIMAGE_MERGE_INLINE Float toFloat( Double d )
+	{
+		return __builtin_convertvector( d, Float );
+	}
+
+};
+
+using Float4 = float __attribute__(( vector_size( 16 ) ));
+using Int4 = int32_t __attribute__(( vector_size( 16 ) ));
+using Double4 = double __attribute__(( vector_size( 32 ) ));
+using Lanes4 = Lanes<Float4, Int4, Double4>;
+
+using Float8 = float __attribute__(( vector_size( 32 ) ));
+using Int8 = int32_t __attribute__(( vector_size( 32 ) ));
+using Double8 = double __attribute__(( vector_size( 64 ) ));
+using Lanes8 = Lanes<Float8, Int8, Double8>;
+
+using Float16 = float __attribute__(( vector_size( 64 ) ));
+using Int16 = int32_t __attribute__(( vector_size( 64 ) ));
+using Double16 = double __attribute__(( vector_size( 128 ) ));
+using Lanes16 = Lanes<Float16, Int16, Double16>;
+
+// Vector equivalents of `Op::operate()`. Each must produce results
+// bit-identical to the scalar version, including for NaNs and infinities.
+template<typename Op>
+struct LanesOp;
+
+#define GAFFERIMAGE_MERGE_LANES_OP( OP, EXPRESSION ) \
+	template<> \
+	struct LanesOp<OP> \
+	{ \
+		template<typename L> \
+		static GAFFERIMAGE_MERGE_INLINE typename L::Float operate( typename L::Float A, typename L::Float B, typename L::Float a, typename L::Float b ) \
+		{ \
+			return EXPRESSION; \
+		} \
+	};
+
+GAFFERIMAGE_MERGE_LANES_OP( OpAdd, A + B )
+GAFFERIMAGE_MERGE_LANES_OP( OpAtop, L::toFloat( L::toDouble( A * b ) + L::toDouble( B ) * ( 1. - L::toDouble( a ) ) ) )
+GAFFERIMAGE_MERGE_LANES_OP( OpDivide, L::select( A == 0.0f, L::splat( 0.0f ), A / B ) )
+GAFFERIMAGE_MERGE_LANES_OP( OpIn, A * b )
+GAFFERIMAGE_MERGE_LANES_OP( OpOut, L::toFloat( L::toDouble( A ) * ( 1. - L::toDouble( b ) ) ) )
+GAFFERIMAGE_MERGE_LANES_OP( OpMask, B * a )
+GAFFERIMAGE_MERGE_LANES_OP( OpMatte, L::toFloat( L::toDouble( A * a ) + L::toDouble( B ) * ( 1. - L::toDouble( a ) ) ) )
+GAFFERIMAGE_MERGE_LANES_OP( OpMultiply, A * B )
+GAFFERIMAGE_MERGE_LANES_OP( OpOver, L::toFloat( L::toDouble( A ) + L::toDouble( B ) * ( 1. - L::toDouble( a ) ) ) )
+GAFFERIMAGE_MERGE_LANES_OP( OpSubtract, A - B )
+GAFFERIMAGE_MERGE_LANES_OP( OpUnder, L::toFloat( L::toDouble( A ) * ( 1. - L::toDouble( b ) ) + L::toDouble( B ) ) )
+GAFFERIMAGE_MERGE_LANES_OP( OpMin, L::select( B < A, B, A ) )
+GAFFERIMAGE_MERGE_LANES_OP( OpMax, L::select( A < B, B, A ) )
+
+#undef GAFFERIMAGE_MERGE_LANES_OP
+
+template<>
+struct LanesOp<OpDifference>
+{
+	template<typename L>
+	static GAFFERIMAGE_MERGE_INLINE typename L::Float operate( typename L::Float A, typename L::Float B, typename L::Float a, typename L::Float b )
+	{
+		// Absolute value, by clearing the sign bit.
+		typename L::Float result = (typename L::Float)( (typename L::Int)( A - B ) & 0x7fffffff );
+		result = L::select( result != result, L::splat( std::numeric_limits<float>::infinity() ), result );
+		// Bitwise comparison, matching the `memcmp()` in `OpDifference`.
+		return L::select( (typename L::Int)A == (typename L::Int)B, L::splat( 0.0f ), result );
+	}
+};
+
+template<typename Op, typename L, bool HasA, bool HasB>
+GAFFERIMAGE_MERGE_INLINE void mergeSpanLanes( const float *A, const float *B, const float *a, const float *b, float *R, float *r, int length )
+{
+	const typename L::Float zero = {};
+	int j = 0;
+	for( ; j + L::size <= length; j += L::size )
+	{
+		const typename L::Float vA = HasA ? L::load( A + j ) : zero;
+		const typename L::Float va = HasA ? L::load( a + j ) : zero;
+		const typename L::Float vB = HasB ? L::load( B + j ) : zero;
+		const typename L::Float vb = HasB ? L::load( b + j ) : zero;
+		L::store( R + j, LanesOp<Op>::template operate<L>( vA, vB, va, vb ) );
+		L::store( r + j, LanesOp<Op>::template operate<L>( va, vb, va, vb ) );
+	}
+
+	mergeSpanScalar<Op, HasA, HasB>( A, B, a, b, R, r, j, length );
+}
+
+template<typename Op, bool HasA, bool HasB>
+__attribute__(( target( "sse4.2" ) )) void mergeSpanSSE42( const float *A, const float *B, const float *a, const float *b, float *R, float *r, int length )
+{
+	mergeSpanLanes<Op, Lanes4, HasA, HasB>( A, B, a, b, R, r, length );
+}
+
+template<typename Op, bool HasA, bool HasB>
+__attribute__(( target( "avx2" ) )) void mergeSpanAVX2( const float *A, const float *B, const float *a, const float *b, float *R, float *r, int length )
+{
+	mergeSpanLanes<Op, Lanes8, HasA, HasB>( A, B, a, b, R, r, length );
+}
+
+template<typename Op, bool HasA, bool HasB>
+__attribute__(( target( "avx512f" ) )) void mergeSpanAVX512( const float *A, const float *B, const float *a, const float *b, float *R, float *r, int length )
+{
+	mergeSpanLanes<Op, Lanes16, HasA, HasB>( A, B, a, b, R, r, length );
+}
+
+#undef GAFFERIMAGE_MERGE_INLINE
+
+#endif // GAFFERIMAGE_MERGE_SIMD
+
+using InstructionSet = GafferImage::Private::MergeInstructionSet;
+
+InstructionSet instructionSet()
+{
+#ifdef GAFFERIMAGE_MERGE_SIMD
+	static const InstructionSet g_instructionSet = [] {
+		__builtin_cpu_init();
+		if( __builtin_cpu_supports( "avx512f" ) )
+		{
+			return InstructionSet::AVX512;
+		}
+		else if( __builtin_cpu_supports( "avx2" ) )
+		{
+			return InstructionSet::AVX2;
+		}
+		else if( __builtin_cpu_supports( "sse4.2" ) )
+		{
+			return InstructionSet::SSE42;
+		}
+		return InstructionSet::Scalar;
+	}();
+	return g_instructionSet;
+#else
+	return InstructionSet::Scalar;
+#endif
+}
+
+// Applies `Op` to a span of pixels using the kernel for the specified
+// instruction set, which must be supported by the CPU.
+template<typename Op, bool HasA, bool HasB>
+void mergeSpan( InstructionSet instructionSet, const float *A, const float *B, const float *a, const float *b, float *R, float *r, int length )
+{
+#ifdef GAFFERIMAGE_MERGE_SIMD
+	switch( instructionSet )
+	{
+		case InstructionSet::AVX512 :
+			mergeSpanAVX512<Op, HasA, HasB>( A, B, a, b, R, r, length );
+			return;
+		case InstructionSet::AVX2 :
+			mergeSpanAVX2<Op, HasA, HasB>( A, B, a, b, R, r, length );
+			return;
+		case InstructionSet::SSE42 :
+			mergeSpanSSE42<Op, HasA, HasB>( A, B, a, b, R, r, length );
+			return;
+		case InstructionSet::Scalar :
+			break;
+	}
+#endif
+	mergeSpanScalar<Op, HasA, HasB>( A, B, a, b, R, r, 0, length );
+}
+
+// Applies `Op` to a span of pixels using the best kernel supported by the CPU.
+template<typename Op, bool HasA, bool HasB>
+void mergeSpan( const float *A, const float *B, const float *a, const float *b, float *R, float *r, int length )
+{
+	mergeSpan<Op, HasA, HasB>( instructionSet(), A, B, a, b, R, r, length );
+}
+
+struct MergeSpanFunctor
+{
+	using ReturnType = void;
+
+	template<class Op>
+	ReturnType operator()( InstructionSet instructionSet, const float *A, const float *B, const float *a, const float *b, float *R, float *r, int length )
+	{
+		if( A && B )
+		{
+			mergeSpan<Op, true, true>( instructionSet, A, B, a, b, R, r, length );
+		}
+		else if( A )
+		{
+			mergeSpan<Op, true, false>( instructionSet, A, B, a, b, R, r, length );
+		}
+		else if( B )
+		{
+			mergeSpan<Op, false, true>( instructionSet, A, B, a, b, R, r, length );
+		}
+		else
+		{
+			mergeSpan<Op, false, false>( instructionSet, A, B, a, b, R, r, length );
+		}
+	}
+
+};
+
 struct MergeFunctor
 {
 	using ReturnType = void;
@@ -381,6 +667,25 @@ struct MergeFunctor
 			return;
 		}
 
+		// If both inputs are constant over the whole tile, then so is the result,
+		// and we only need to operate on a single pixel.
+		const Box2i fullBound( V2i( 0 ), V2i( ImagePlug::tileSize() ) );
+		float constantA, constantB, constantAlphaA, constantAlphaB;
+		if(
+			boundA == fullBound && boundB == fullBound &&
+			ImagePlug::isConstantTile( channelDataA.get(), constantA ) &&
+			ImagePlug::isConstantTile( alphaDataA.get(), constantAlphaA ) &&
+			ImagePlug::isConstantTile( channelDataB.get(), constantB ) &&
+			ImagePlug::isConstantTile( alphaDataB.get(), constantAlphaB )
+		)
+		{
+			float constantR, constantAlphaR;
+			mergeSpanScalar<Op, true, true>( &constantA, &constantB, &constantAlphaA, &constantAlphaB, &constantR, &constantAlphaR, 0, 1 );
+			channelDataB = ImagePlug::constantTile( constantR );
+			alphaDataB = ImagePlug::constantTile( constantAlphaR );
+			return;
+		}
+
 		// The base layer (B) with the current result
 		const float *B = &channelDataB->readable().front();
 		const float *b = &alphaDataB->readable().front();
@@ -447,8 +752,7 @@ struct MergeFunctor
 						// the compiler probably does quite a good job of inlining Op::operate,
 						// noticing that it is a passthrough, and translating it into something memcpy'ish
 						// This structure still feels worthwhile since it's a bit more explicit about what
-						// is happening, and this structure could be useful if we pursue a bit of
-						// vectorization
+						// is happening.
 						memcpy( R, B, length * sizeof( float ) );
 						memcpy( r, b, length * sizeof( float ) );
 					}
@@ -459,14 +763,10 @@ struct MergeFunctor
 				else
 				{
 					// Outside A dataWindow, so call operator with 0 substituted for A and a
-					for( int j = 0; j < length; j++ )
-					{
-						*R = Op::operate( 0.0f, *B, 0.0f, *b );
-						*r = Op::operate( 0.0f, *b, 0.0f, *b );
-						++B; ++b;
-						++R; ++r;
-					}
+					mergeSpan<Op, false, true>( A, B, a, b, R, r, length );
 					A += length; a += length;
+					B += length; b += length;
+					R += length; r += length;
 				}
 			}
 			else if( region == InsideA )
@@ -484,27 +784,19 @@ struct MergeFunctor
 				else
 				{
 					// Outside B dataWindow, so call operator with 0 substituted for B and b
-					for( int j = 0; j < length; j++ )
-					{
-						*R = Op::operate( *A, 0.0f, *a, 0.0f );
-						*r = Op::operate( *a, 0.0f, *a, 0.0f );
-						++A; ++a;
-						++R; ++r;
-					}
+					mergeSpan<Op, true, false>( A, B, a, b, R, r, length );
+					A += length; a += length;
 					B += length; b += length;
+					R += length; r += length;
 				}
 			}
 			else
 			{
 				// Within both data windows, this is when we actually need to run the full operate()
-				for( int j = 0; j < length; j++ )
-				{
-					*R = Op::operate( *A, *B, *a, *b );
-					*r = Op::operate( *a, *b, *a, *b );
-					++A; ++a;
-					++B; ++b;
-					++R; ++r;
-				}
+				mergeSpan<Op, true, true>( A, B, a, b, R, r, length );
+				A += length; a += length;
+				B += length; b += length;
+				R += length; r += length;
 			}
 			i += length;
 		}
@@ -641,6 +933,38 @@ struct MergeDataWindowFunctor
 
 } // namespace
 
+//////////////////////////////////////////////////////////////////////////
+// Private testing API
+//////////////////////////////////////////////////////////////////////////
+
+std::vector<GafferImage::Private::MergeInstructionSet> GafferImage::Private::mergeInstructionSets()
+{
+	std::vector<MergeInstructionSet> result = { MergeInstructionSet::Scalar };
+	for( auto s : { MergeInstructionSet::SSE42, MergeInstructionSet::AVX2, MergeInstructionSet::AVX512 } )
+	{
+		// Every CPU supporting an instruction set also supports the ones before it.
+		if( s <= instructionSet() )
+		{
+			result.push_back( s );
+		}
+	}
+	return result;
+}
+
+void GafferImage::Private::mergeSpan(
+	Merge::Operation operation, MergeInstructionSet instructionSet,
+	const float *A, const float *B, const float *a, const float *b,
+	float *R, float *r, int length
+)
+{
+	const std::vector<MergeInstructionSet> supported = mergeInstructionSets();
+	if( std::find( supported.begin(), supported.end(), instructionSet ) == supported.end() )
+	{
+		throw IECore::Exception( "Instruction set not supported" );
+	}
+	dispatchOperation( operation, MergeSpanFunctor(), instructionSet, A, B, a, b, R, r, length );
+}
+
 GAFFER_NODE_DEFINE_TYPE( Merge );
 
 size_t Merge::g_firstPlugIndex = 0;
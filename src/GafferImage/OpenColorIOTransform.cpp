@@ -39,10 +39,15 @@
 #include "GafferImage/OpenColorIOAlgo.h"
 
 #include "Gaffer/Context.h"
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
 #include "Gaffer/Process.h"
 
+#include "IECore/MessageHandler.h"
 #include "IECore/SimpleTypedData.h"
 
+#include <atomic>
+#include <cstring>
+
 using namespace std;
 using namespace IECore;
 using namespace Gaffer;
@@ -69,6 +74,93 @@ struct ProcessorProcess : public Process
 InternedString ProcessorProcess::processorProcessType( "openColorIOTransform:processor" );
 InternedString ProcessorProcess::processorHashProcessType( "openColorIOTransform:processorHash" );
 
+OpenColorIOTransform::Optimization defaultOptimization()
+{
+	if( const char *e = getenv( "GAFFER_OCIO_OPTIMIZATION" ) )
+	{
+		if( !strcmp( e, "Lossless" ) )
+		{
+			return OpenColorIOTransform::Optimization::Lossless;
+		}
+		else if( !strcmp( e, "Default" ) )
+		{
+			return OpenColorIOTransform::Optimization::Default;
+		}
+		else if( !strcmp( e, "Good" ) )
+		{
+			return OpenColorIOTransform::Optimization::Good;
+		}
+		else if( !strcmp( e, "Draft" ) )
+		{
+			return OpenColorIOTransform::Optimization::Draft;
+		}
+		else
+		{
+			IECore::msg( IECore::Msg::Warning, "OpenColorIOTransform", "Invalid value for GAFFER_OCIO_OPTIMIZATION. Must be Lossless, Default, Good or Draft." );
+		}
+	}
+	return OpenColorIOTransform::Optimization::Default;
+}
+
+std::atomic<OpenColorIOTransform::Optimization> g_optimization( defaultOptimization() );
+
+OCIO_NAMESPACE::OptimizationFlags optimizationFlags( OpenColorIOTransform::Optimization optimization )
+{
+	switch( optimization )
+	{
+		case OpenColorIOTransform::Optimization::Lossless :
+			return OCIO_NAMESPACE::OPTIMIZATION_LOSSLESS;
+		case OpenColorIOTransform::Optimization::Good :
+			return OCIO_NAMESPACE::OPTIMIZATION_GOOD;
+		case OpenColorIOTransform::Optimization::Draft :
+			return OCIO_NAMESPACE::OPTIMIZATION_DRAFT;
+		default :
+			return OCIO_NAMESPACE::OPTIMIZATION_DEFAULT;
+	}
+}
+
+// Cache of CPU processors, shared by all nodes. OCIO has its own processor
+// cache, but it is guarded by a single mutex per config, and the CPU processor
+// must still be optimised and finalised for each request. Here lookups for
+// different processors proceed concurrently, and concurrent requests for the
+// same processor wait for a single thread to build it.
+
+struct CPUProcessorCacheGetterKey
+{
+
+	CPUProcessorCacheGetterKey( const OpenColorIOTransform *node, const IECore::MurmurHash &hash, OpenColorIOTransform::Optimization optimization )
+		:	node( node ), optimization( optimization ), hash( hash )
+	{
+	}
+
+	operator const IECore::MurmurHash & () const
+	{
+		return hash;
+	}
+
+	const OpenColorIOTransform *node;
+	OpenColorIOTransform::Optimization optimization;
+	IECore::MurmurHash hash;
+
+};
+
+OCIO_NAMESPACE::ConstCPUProcessorRcPtr cpuProcessorGetter( const CPUProcessorCacheGetterKey &key, size_t &cost, const IECore::Canceller *canceller )
+{
+	cost = 1;
+	OCIO_NAMESPACE::ConstProcessorRcPtr processor = key.node->processor();
+	if( !processor || processor->isNoOp() )
+	{
+		return nullptr;
+	}
+
+	return processor->getOptimizedCPUProcessor( optimizationFlags( key.optimization ) );
+}
+
+using CPUProcessorCache = IECorePreview::LRUCache<IECore::MurmurHash, OCIO_NAMESPACE::ConstCPUProcessorRcPtr, IECorePreview::LRUCachePolicy::Parallel, CPUProcessorCacheGetterKey>;
+// Errors aren't cached, since they may be due to a transient problem
+// reading a LUT referenced by the config.
+CPUProcessorCache g_cpuProcessorCache( cpuProcessorGetter, 1000, CPUProcessorCache::RemovalCallback(), /* cacheErrors = */ false );
+
 } // namespace
 
 GAFFER_NODE_DEFINE_TYPE( OpenColorIOTransform );
@@ -154,6 +246,25 @@ bool OpenColorIOTransform::affectsColorProcessor( const Gaffer::Plug *input ) co
 void OpenColorIOTransform::hashColorProcessor( const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	h.append( processorHash() );
+	h.append( (int)g_optimization.load() );
+}
+
+void OpenColorIOTransform::setOptimization( Optimization optimization )
+{
+	if( g_optimization.exchange( optimization ) == optimization )
+	{
+		return;
+	}
+
+	// The optimisation level isn't represented by a plug, so changing it
+	// doesn't dirty anything. Clear the hash cache so that previously
+	// cached hashes for `colorProcessorPlug()` are not reused.
+	ValuePlug::clearHashCache();
+}
+
+OpenColorIOTransform::Optimization OpenColorIOTransform::getOptimization()
+{
+	return g_optimization;
 }
 
 OCIO_NAMESPACE::ConstContextRcPtr OpenColorIOTransform::modifiedOCIOContext( OCIO_NAMESPACE::ConstContextRcPtr context ) const
@@ -201,14 +312,16 @@ OCIO_NAMESPACE::ConstContextRcPtr OpenColorIOTransform::modifiedOCIOContext( OCI
 
 ColorProcessor::ColorProcessorFunction OpenColorIOTransform::colorProcessor( const Gaffer::Context *context ) const
 {
-	OCIO_NAMESPACE::ConstProcessorRcPtr processor = this->processor();
-	if( !processor || processor->isNoOp() )
+	const Optimization optimization = g_optimization;
+	IECore::MurmurHash hash = processorHash();
+	hash.append( (int)optimization );
+
+	OCIO_NAMESPACE::ConstCPUProcessorRcPtr cpuProcessor = g_cpuProcessorCache.get( CPUProcessorCacheGetterKey( this, hash, optimization ) );
+	if( !cpuProcessor )
 	{
 		return ColorProcessorFunction();
 	}
 
-	OCIO_NAMESPACE::ConstCPUProcessorRcPtr cpuProcessor = processor->getDefaultCPUProcessor();
-
 	return [cpuProcessor] ( IECore::FloatVectorData *r, IECore::FloatVectorData *g, IECore::FloatVectorData *b ) {
 
 		if( !r->readable().size() )
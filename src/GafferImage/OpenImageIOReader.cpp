@@ -43,6 +43,8 @@
 #include "GafferImage/FormatPlug.h"
 #include "GafferImage/ImageAlgo.h"
 #include "GafferImage/ImageReader.h"
+#include "GafferImage/Private/HalfConversion.h"
+#include "GafferImage/Private/MappedEXR.h"
 
 #include "Gaffer/Context.h"
 #include "Gaffer/StringPlug.h"
@@ -53,18 +55,27 @@
 #include "IECore/FileSequence.h"
 #include "IECore/FileSequenceFunctions.h"
 #include "IECore/MessageHandler.h"
+#include "IECore/VectorTypedData.h"
 
 #include "OpenImageIO/imagecache.h"
 #include "OpenImageIO/deepdata.h"
 
 #include <boost/algorithm/string.hpp>
 #include "boost/bind/bind.hpp"
+#include "boost/noncopyable.hpp"
 #include "boost/regex.hpp"
 
 #include "tbb/parallel_for.h"
 #include "tbb/enumerable_thread_specific.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 OIIO_NAMESPACE_USING
 
@@ -679,6 +690,372 @@ Box2i expandToGrid( Box2i region, V2i gridOrigin, V2i gridSize )
 }
 
 
+// A pool of dedicated threads for reading pixel data from files. On network
+// filesystems reads can spend a long time waiting on I/O, and doing that on
+// the TBB worker threads stalls the compute threads. Instead, readTileBatch()
+// submits all its reads to the queue up front, and then only waits for the
+// results to arrive before copying them into tiles. Requests for vertically
+// adjacent regions of the same subimage are coalesced into a single read,
+// provided they were submitted by different requesters. The regions of a
+// single tile batch are already sized for parallelism, so merging them would
+// only serialise them.
+class IOQueue : boost::noncopyable
+{
+
+	public :
+
+		// Reads `region` into `buffer`, throwing on failure.
+		using ReadFunction = std::function<void ( const Box2i &region, float *buffer )>;
+
+		struct Request;
+		using RequestPtr = std::shared_ptr<Request>;
+
+		// Holds the requests made by a single requester, abandoning any which
+		// haven't completed when it is destroyed. The ReadFunction typically
+		// references data on the submitter's stack, so this must be used to
+		// ensure that no reads are pending if the submitter exits with an
+		// exception.
+		class RequestVector : public std::vector<RequestPtr>, boost::noncopyable
+		{
+
+			public :
+
+				RequestVector( IOQueue &queue )
+					:	m_queue( queue )
+				{
+				}
+
+				~RequestVector()
+				{
+					for( const auto &request : *this )
+					{
+						m_queue.abandon( request );
+					}
+				}
+
+			private :
+
+				IOQueue &m_queue;
+
+		};
+
+		IOQueue( size_t numThreads )
+			:	m_numThreads( numThreads ), m_runningThreads( 0 ), m_bytesInFlight( 0 )
+		{
+		}
+
+		void setNumThreads( size_t numThreads )
+		{
+			std::unique_lock<std::mutex> lock( m_mutex );
+			m_numThreads = numThreads;
+			// Wake any threads which are now surplus to requirements, so they can exit.
+			m_queueChanged.notify_all();
+		}
+
+		size_t getNumThreads() const
+		{
+			return m_numThreads;
+		}
+
+		size_t queueDepth() const
+		{
+			std::unique_lock<std::mutex> lock( m_mutex );
+			return m_queue.size();
+		}
+
+		size_t bytesInFlight() const
+		{
+			std::unique_lock<std::mutex> lock( m_mutex );
+			return m_bytesInFlight;
+		}
+
+		// Queues a read of `numChannels` float channels from `region` of a file,
+		// appending the request to `requests`. Requests are coalesced when `source`
+		// and `subImage` match and they belong to different RequestVectors.
+		void submit( RequestVector &requests, const void *source, int subImage, int numChannels, const Box2i &region, ReadFunction &&read )
+		{
+			RequestPtr request = std::make_shared<Request>();
+			request->requester = &requests;
+			request->source = source;
+			request->subImage = subImage;
+			request->numChannels = numChannels;
+			request->region = region;
+			request->read = std::move( read );
+			requests.push_back( request );
+
+			std::unique_lock<std::mutex> lock( m_mutex );
+			m_queue.push_back( request );
+			m_bytesInFlight += request->bytes();
+			// We always need at least one thread to service the request,
+			// even if `numThreads` was set to 0 after our caller checked it.
+			while( m_runningThreads < std::max<size_t>( m_numThreads, 1 ) )
+			{
+				std::thread( &IOQueue::run, this ).detach();
+				m_runningThreads++;
+			}
+			m_queueChanged.notify_one();
+		}
+
+		// Waits for `request` to complete, returning its data. Rather than block
+		// while the request is queued, the calling thread performs queued reads
+		// for the same requester itself. Throws if the read failed, or if
+		// `canceller` is cancelled first.
+		float *wait( const RequestPtr &request, const IECore::Canceller *canceller )
+		{
+			std::unique_lock<std::mutex> lock( m_mutex );
+			while( request->state != Request::State::Complete )
+			{
+				IECore::Canceller::check( canceller );
+
+				RequestPtr next;
+				if( request->state == Request::State::Queued )
+				{
+					next = request;
+				}
+				else
+				{
+					// Our request is being read by another thread. Help out with
+					// another of our requester's reads while we wait for it.
+					auto it = std::find_if(
+						m_queue.begin(), m_queue.end(),
+						[&request] ( const RequestPtr &r ) { return r->requester == request->requester; }
+					);
+					if( it == m_queue.end() )
+					{
+						m_requestCompleted.wait( lock, [&request] { return request->state == Request::State::Complete; } );
+						break;
+					}
+					next = *it;
+				}
+
+				execute( lock, takeRequests( next ) );
+			}
+
+			if( request->error )
+			{
+				std::rethrow_exception( request->error );
+			}
+			return request->data;
+		}
+
+		struct Request
+		{
+
+			size_t bytes() const
+			{
+				return numChannels * region.size().x * region.size().y * sizeof( float );
+			}
+
+			enum class State
+			{
+				Queued,
+				Reading,
+				Complete
+			};
+
+			const RequestVector *requester;
+			const void *source;
+			int subImage;
+			int numChannels;
+			Box2i region;
+			ReadFunction read;
+
+			State state = State::Queued;
+			std::shared_ptr<std::vector<float>> buffer;
+			float *data = nullptr;
+			std::exception_ptr error;
+
+		};
+
+	private :
+
+		// Removes `request` from the queue if it hasn't been started,
+		// otherwise waits for it to complete.
+		void abandon( const RequestPtr &request )
+		{
+			std::unique_lock<std::mutex> lock( m_mutex );
+			if( request->state == Request::State::Queued )
+			{
+				m_queue.erase( std::find( m_queue.begin(), m_queue.end(), request ) );
+				m_bytesInFlight -= request->bytes();
+				request->state = Request::State::Complete;
+				return;
+			}
+
+			m_requestCompleted.wait( lock, [&request] { return request->state == Request::State::Complete; } );
+		}
+
+		void run()
+		{
+			std::unique_lock<std::mutex> lock( m_mutex );
+			while( true )
+			{
+				m_queueChanged.wait( lock, [this] { return m_queue.size() || m_runningThreads > m_numThreads; } );
+				if( m_queue.empty() )
+				{
+					// Surplus to requirements.
+					m_runningThreads--;
+					return;
+				}
+
+				execute( lock, takeRequests( m_queue.front() ) );
+			}
+		}
+
+		// Removes `first` from the queue, along with any queued requests from
+		// other requesters that extend its region vertically. Must be called
+		// with `m_mutex` locked.
+		std::vector<RequestPtr> takeRequests( RequestPtr first )
+		{
+			m_queue.erase( std::find( m_queue.begin(), m_queue.end(), first ) );
+			std::vector<RequestPtr> requests = { first };
+
+			Box2i region = first->region;
+			size_t bytes = first->bytes();
+			bool extended = true;
+			while( extended && bytes < g_maxCoalescedBytes )
+			{
+				extended = false;
+				for( auto it = m_queue.begin(); it != m_queue.end(); ++it )
+				{
+					const Request &r = **it;
+					if(
+						r.source != first->source || r.subImage != first->subImage || r.numChannels != first->numChannels ||
+						r.region.min.x != region.min.x || r.region.max.x != region.max.x
+					)
+					{
+						continue;
+					}
+
+					if( r.region.min.y != region.max.y && r.region.max.y != region.min.y )
+					{
+						continue;
+					}
+
+					if( std::any_of( requests.begin(), requests.end(), [&r] ( const RequestPtr &t ) { return t->requester == r.requester; } ) )
+					{
+						continue;
+					}
+
+					region.extendBy( r.region );
+					bytes += r.bytes();
+					requests.push_back( *it );
+					m_queue.erase( it );
+					extended = true;
+					break;
+				}
+			}
+
+			for( const auto &r : requests )
+			{
+				r->state = Request::State::Reading;
+			}
+
+			return requests;
+		}
+
+		// Performs a single read covering all of `requests`, which must be
+		// vertically adjacent. Called with `lock` held, but releases it for the
+		// duration of the read.
+		void execute( std::unique_lock<std::mutex> &lock, const std::vector<RequestPtr> &requests )
+		{
+			const Request &first = *requests.front();
+			Box2i region = first.region;
+			size_t bytes = 0;
+			for( const auto &r : requests )
+			{
+				region.extendBy( r->region );
+				bytes += r->bytes();
+			}
+
+			// Perform the read without holding the lock.
+
+			lock.unlock();
+
+			auto buffer = std::make_shared<std::vector<float>>();
+			std::exception_ptr error;
+			try
+			{
+				podVectorResizeUninitialized<float>( *buffer, bytes / sizeof( float ) );
+				first.read( region, buffer->data() );
+			}
+			catch( ... )
+			{
+				error = std::current_exception();
+			}
+
+			lock.lock();
+
+			// Distribute the results. The buffer is laid out in rows of
+			// `numChannels * region.size().x` values, so each request's
+			// data is a contiguous range within it.
+
+			const size_t valuesPerRow = first.numChannels * region.size().x;
+			for( const auto &r : requests )
+			{
+				r->buffer = buffer;
+				r->data = buffer->data() + ( r->region.min.y - region.min.y ) * valuesPerRow;
+				r->error = error;
+				r->state = Request::State::Complete;
+				m_bytesInFlight -= r->bytes();
+			}
+			m_requestCompleted.notify_all();
+		}
+
+		static const size_t g_maxCoalescedBytes = 16 * 1024 * 1024;
+
+		mutable std::mutex m_mutex;
+		std::condition_variable m_queueChanged;
+		std::condition_variable m_requestCompleted;
+		std::deque<RequestPtr> m_queue;
+		std::atomic_size_t m_numThreads;
+		size_t m_runningThreads;
+		size_t m_bytesInFlight;
+
+};
+
+IOQueue &ioQueue()
+{
+	static IOQueue *q = new IOQueue( []() -> size_t {
+		const char *e = getenv( "GAFFER_IMAGE_READER_IO_THREADS" );
+		return e ? std::max( atoi( e ), 0 ) : 0;
+	}() );
+	return *q;
+}
+
+// Controls whether half channels are stored as half floats in the tile batch
+// cache. See `OpenImageIOReader::setHalfTileStorageEnabled()`.
+std::atomic_bool g_halfTileStorage( getenv( "GAFFER_IMAGE_READER_HALF_TILES" ) && strcmp( getenv( "GAFFER_IMAGE_READER_HALF_TILES" ), "1" ) == 0 );
+
+// Replaces the float tiles for any half channels with `HalfVectorData`, so that
+// they take up half the space in the cache. This is lossless, because the
+// floats were converted from half in the first place.
+void convertToHalfTiles( const ImageSpec &spec, int tileBatchNumTiles, ObjectVector *tileChannels )
+{
+	for( int channelIndex = 0; channelIndex < spec.nchannels; ++channelIndex )
+	{
+		if( spec.channelformat( channelIndex ) != TypeDesc::HALF )
+		{
+			continue;
+		}
+
+		for( int tileIndex = 0; tileIndex < tileBatchNumTiles; ++tileIndex )
+		{
+			ObjectPtr &tile = tileChannels->members()[channelIndex * tileBatchNumTiles + tileIndex];
+			if( tile.get() == ImagePlug::blackTile() )
+			{
+				continue;
+			}
+
+			const vector<float> &floatTile = static_cast<const FloatVectorData *>( tile.get() )->readable();
+			HalfVectorDataPtr halfTile = new HalfVectorData();
+			podVectorResizeUninitialized<half>( halfTile->writable(), floatTile.size() );
+			GafferImage::Private::floatToHalf( floatTile.data(), floatTile.size(), halfTile->writable().data() );
+			tile = std::move( halfTile );
+		}
+	}
+}
+
 // This class handles storing a file handle, and reading data from it in a way compatible with how we want
 // to store it on plugs.
 //
@@ -710,7 +1087,7 @@ class File
 	public:
 
 		// Create a File handle object for an image input and image spec
-		File( std::unique_ptr<ImageInput> imageInput, const std::string &infoFileName, ImageReader::ChannelInterpretation channelNaming )
+		File( std::unique_ptr<ImageInput> imageInput, const std::string &infoFileName, ImageReader::ChannelInterpretation channelNaming, std::unique_ptr<GafferImage::Private::MappedEXR> mappedEXR = nullptr )
 			: m_imageInput( std::move( imageInput ) )
 		{
 			m_viewNamesData = new StringVectorData();
@@ -932,6 +1309,31 @@ class File
 				nodeHandle.key() = ImagePlug::defaultViewName;
 				m_views.insert( std::move( nodeHandle ) );
 			}
+
+			if( mappedEXR && m_imageInput->spec( 1, 0 ).format == TypeUnknown )
+			{
+				// We can read directly from the mapped file as long as it contains the
+				// same data that OIIO would give us.
+				const ImageSpec &spec = m_imageInput->spec( 0, 0 );
+				const Box2i &dataWindow = mappedEXR->dataWindow();
+				bool compatible =
+					!spec.deep && spec.nchannels == (int)mappedEXR->channelNames().size() &&
+					spec.x == dataWindow.min.x && spec.y == dataWindow.min.y &&
+					spec.width == dataWindow.size().x + 1 && spec.height == dataWindow.size().y + 1
+				;
+				for( int i = 0; compatible && i < spec.nchannels; ++i )
+				{
+					const auto &names = mappedEXR->channelNames();
+					auto it = std::find( names.begin(), names.end(), spec.channelnames[i] );
+					compatible = it != names.end();
+					m_mappedChannelIndices.push_back( it - names.begin() );
+				}
+
+				if( compatible )
+				{
+					m_mappedEXR = std::move( mappedEXR );
+				}
+			}
 		}
 
 		// Read a chunk of data from the file, formatted as a tile batch that will be stored on the tile batch plug
@@ -1022,6 +1424,20 @@ class File
 				}
 			}
 
+			if( m_mappedEXR )
+			{
+				readMappedTiles( spec, tileBatchOrigin, view.tileBatchSize, tileChannelPointers, tileDataWindows );
+				if( g_halfTileStorage )
+				{
+					convertToHalfTiles( spec, tileBatchNumTiles, resultChannels.get() );
+				}
+
+				ObjectVectorPtr result = new ObjectVector();
+				result->members().push_back( resultChannels );
+				result->members().push_back( nullptr );
+				return result;
+			}
+
 			// Find the portion of the data window that intersects with the current tile batch,
 			// and convert it from Gaffer coordinates to file coordinates.
 			const V2i tileBatchOriginXY( tileBatchOrigin.x, tileBatchOrigin.y );
@@ -1043,13 +1459,14 @@ class File
 				strcmp( m_imageInput->format_name(), "openexr" ) == 0 &&
 				OIIO::get_int_attribute( "openexr:core" );
 
-			tbb::enumerable_thread_specific< std::vector< float > > threadBuffers;
-			tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
-
 			const std::string compression = spec.get_string_attribute( g_oiioCompression );
 
 			const V2i tileSize( spec.tile_width, spec.tile_height );
 
+			// Divide the target region into the regions we will read from the file. Each
+			// region may be processed in parallel.
+			std::vector< Box2i > fileRegions;
+
 			if( tileSize == V2i( 0 ) && ( !usingExrCore || compression == "dwab" ) )
 			{
 				// If we are using compression other than EXR, or we're using the massive 256 scanline blocks
@@ -1060,20 +1477,7 @@ class File
 				//
 				// Note this means scanline DWAB is a very poor match for our compute model in Gaffer.
 				// Tiled DWAB works great though.
-
-				if( spec.deep )
-				{
-					deepRects.resize( 1 );
-					deepRectsData.resize( 1 );
-				}
-
-				std::vector<float> buffer;
-				processFileRegionScanline(
-					spec, tileBatchOrigin, fileTargetRegion, buffer,
-					view.tileBatchSize, tileChannelPointers, tileDataWindows,
-					deepRectsData.size() ? &deepRectsData[0] : nullptr,
-					deepRects.size() ? &deepRects[0] : nullptr, tileOffsetPointers
-				);
+				fileRegions.push_back( fileTargetRegion );
 			}
 			else if( tileSize == V2i( 0 ) )
 			{
@@ -1110,58 +1514,26 @@ class File
 				// Compute how many batches are needed to cover the size of the target region
 				const int numScanlineBatches = ( fileTargetRegion.max.y - scanlineBatchOffset + scanlineBatch - 1 ) / scanlineBatch;
 
-				if( spec.deep )
+				for( int i = 0; i < numScanlineBatches; i++ )
 				{
-					deepRects.resize( numScanlineBatches );
-					deepRectsData.resize( numScanlineBatches );
+					const int y = i * scanlineBatch + scanlineBatchOffset;
+					const int yEnd = std::min( y + scanlineBatch, fileTargetRegion.max.y );
+
+					fileRegions.push_back(
+						Box2i(
+							Imath::V2i( fileTargetRegion.min.x, y ),
+							Imath::V2i( fileTargetRegion.max.x, yEnd )
+						)
+					);
 				}
-
-				tbb::parallel_for(
-					tbb::blocked_range<int>( 0, numScanlineBatches ),
-					[&] ( const tbb::blocked_range<int> &range )
-					{
-						std::vector<float> &buffer = threadBuffers.local();
-						for( int i = range.begin(); i < range.end(); i++ )
-						{
-							const int y = i * scanlineBatch + scanlineBatchOffset;
-							const int yEnd = std::min( y + scanlineBatch, fileTargetRegion.max.y );
-
-							const Box2i batchRect(
-								Imath::V2i( fileTargetRegion.min.x, y ),
-								Imath::V2i( fileTargetRegion.max.x, yEnd )
-							);
-
-							processFileRegionScanline(
-								spec, tileBatchOrigin, batchRect, buffer,
-								view.tileBatchSize, tileChannelPointers, tileDataWindows,
-								deepRectsData.size() ? &deepRectsData[i] : nullptr,
-								deepRects.size() ? &deepRects[i] : nullptr, tileOffsetPointers
-							);
-						}
-					},
-					taskGroupContext
-				);
 			}
 			else if( !usingExrCore )
 			{
 				// A tiled image that we can't use our threading on
 
-				if( spec.deep )
-				{
-					deepRects.resize( 1 );
-					deepRectsData.resize( 1 );
-				}
-
 				// Round the target region coordinates outwards to the tile boundaries in the file
 				const Box2i fileTileRegion = expandToGrid( fileTargetRegion, fileDataOrigin, tileSize );
-
-				std::vector<float> buffer;
-				processFileRegionTiled(
-					spec, tileBatchOrigin, BufferAlgo::intersection( fileTileRegion, fileDataWindow ), buffer,
-					view.tileBatchSize, tileChannelPointers, tileDataWindows,
-					deepRectsData.size() ? &deepRectsData[0] : nullptr,
-					deepRects.size() ? &deepRects[0] : nullptr, tileOffsetPointers
-				);
+				fileRegions.push_back( BufferAlgo::intersection( fileTileRegion, fileDataWindow ) );
 			}
 			else
 			{
@@ -1174,33 +1546,88 @@ class File
 
 				const unsigned int numFileTiles = fileTileCounts.x * fileTileCounts.y;
 
+				for( unsigned int i = 0; i < numFileTiles; i++ )
+				{
+					// For a tiled image, each tile can be it's own batch of processing, so we
+					// get good parallelism.
+					const V2i fileTile = fileTileRegion.min + V2i( i % fileTileCounts.x, i / fileTileCounts.x ) * tileSize;
+					fileRegions.push_back(
+						BufferAlgo::intersection( fileDataWindow, Imath::Box2i (
+							Imath::V2i( fileTile.x, fileTile.y ),
+							Imath::V2i( fileTile.x + tileSize.x, fileTile.y + tileSize.y )
+						) )
+					);
+				}
+			}
+
+			tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+
+			if( !spec.deep && ioQueue().getNumThreads() )
+			{
+				// Submit all the reads up front, so that the I/O threads can service them
+				// concurrently while we wait, and then copy the results into the tiles.
+				IOQueue::RequestVector requests( ioQueue() );
+				for( const auto &fileRegion : fileRegions )
+				{
+					ioQueue().submit(
+						requests, this, tileBatchOrigin.z, spec.nchannels, fileRegion,
+						[this, &spec, subImage = tileBatchOrigin.z] ( const Box2i &region, float *buffer ) {
+							readRegion( spec, subImage, region, buffer );
+						}
+					);
+				}
+
+				tbb::parallel_for(
+					tbb::blocked_range<size_t>( 0, requests.size() ),
+					[&] ( const tbb::blocked_range<size_t> &range )
+					{
+						for( size_t i = range.begin(); i < range.end(); i++ )
+						{
+							blitOIIORectToTileBatch(
+								spec.nchannels, ioQueue().wait( requests[i], c->canceller() ),
+								flopDisplayWindow( fileRegions[i], spec ),
+								view.tileBatchSize, tileBatchOrigin, tileChannelPointers,
+								tileDataWindows
+							);
+						}
+					},
+					taskGroupContext
+				);
+			}
+			else
+			{
 				if( spec.deep )
 				{
-					deepRects.resize( numFileTiles );
-					deepRectsData.resize( numFileTiles );
+					deepRects.resize( fileRegions.size() );
+					deepRectsData.resize( fileRegions.size() );
 				}
 
+				tbb::enumerable_thread_specific< std::vector< float > > threadBuffers;
 				tbb::parallel_for(
-					tbb::blocked_range<int>( 0, numFileTiles ),
-					[&] ( const tbb::blocked_range<int> &range )
+					tbb::blocked_range<size_t>( 0, fileRegions.size() ),
+					[&] ( const tbb::blocked_range<size_t> &range )
 					{
 						std::vector<float> &buffer = threadBuffers.local();
-						for( int i = range.begin(); i < range.end(); i++ )
+						for( size_t i = range.begin(); i < range.end(); i++ )
 						{
-							// For a tiled image, each tile can be it's own batch of processing, so we
-							// get good parallelism.
-							const V2i fileTile = fileTileRegion.min + V2i( i % fileTileCounts.x, i / fileTileCounts.x ) * tileSize;
-							const Box2i batchRect = BufferAlgo::intersection( fileDataWindow, Imath::Box2i (
-								Imath::V2i( fileTile.x, fileTile.y ),
-								Imath::V2i( fileTile.x + tileSize.x, fileTile.y + tileSize.y )
-							) );
-
-							processFileRegionTiled(
-								spec, tileBatchOrigin, batchRect, buffer,
-								view.tileBatchSize, tileChannelPointers, tileDataWindows,
-								deepRectsData.size() ? &deepRectsData[i] : nullptr,
-								deepRects.size() ? &deepRects[i] : nullptr, tileOffsetPointers
-							);
+							if( tileSize == V2i( 0 ) )
+							{
+								processFileRegionScanline(
+									spec, tileBatchOrigin, fileRegions[i], buffer,
+									view.tileBatchSize, tileChannelPointers, tileDataWindows,
+									deepRectsData.size() ? &deepRectsData[i] : nullptr,
+									deepRects.size() ? &deepRects[i] : nullptr, tileOffsetPointers
+								);
+							}
+							else
+							{
+								processFileRegionTiled(
+									spec, tileBatchOrigin, fileRegions[i], buffer,
+									view.tileBatchSize, tileChannelPointers, tileDataWindows,
+									deepRectsData.size() ? &deepRectsData[i] : nullptr,
+									deepRects.size() ? &deepRects[i] : nullptr, tileOffsetPointers
+								);
+							}
 						}
 					},
 					taskGroupContext
@@ -1270,6 +1697,11 @@ class File
 
 			}
 
+			if( !spec.deep && g_halfTileStorage )
+			{
+				convertToHalfTiles( spec, tileBatchNumTiles, resultChannels.get() );
+			}
+
 			ObjectVectorPtr result = new ObjectVector();
 			result->members().resize( 2 );
 			result->members()[0] = resultChannels;
@@ -1304,6 +1736,90 @@ class File
 			}
 		}
 
+		// Copies the pixels for a tile batch directly from `m_mappedEXR` into the tiles.
+		void readMappedTiles(
+			const ImageSpec &spec, const V3i &tileBatchOrigin, const V2i &tileBatchSize,
+			const std::vector< float* > &tileChannelPointers, const std::vector< Box2i > &tileDataWindows
+		) const
+		{
+			const int tileBatchNumTiles = tileBatchSize.x * tileBatchSize.y;
+
+			tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+			tbb::parallel_for(
+				tbb::blocked_range<int>( 0, tileBatchNumTiles * spec.nchannels ),
+				[&] ( const tbb::blocked_range<int> &range )
+				{
+					for( int i = range.begin(); i < range.end(); i++ )
+					{
+						float *tile = tileChannelPointers[i];
+						if( !tile )
+						{
+							// Black tile outside the data window.
+							continue;
+						}
+
+						const int tileIndex = i % tileBatchNumTiles;
+						const Box2i &tileDataWindow = tileDataWindows[tileIndex];
+						const V2i tileOrigin =
+							V2i( tileBatchOrigin.x, tileBatchOrigin.y ) +
+							V2i( tileIndex % tileBatchSize.x, tileIndex / tileBatchSize.x ) * ImagePlug::tileSize()
+						;
+						const size_t channelIndex = m_mappedChannelIndices[i / tileBatchNumTiles];
+
+						for( int y = 0; y < ImagePlug::tileSize(); y++ )
+						{
+							float *row = tile + y * ImagePlug::tileSize();
+							if( y < tileDataWindow.min.y || y >= tileDataWindow.max.y )
+							{
+								std::fill( row, row + ImagePlug::tileSize(), 0.0f );
+								continue;
+							}
+
+							std::fill( row, row + tileDataWindow.min.x, 0.0f );
+							std::fill( row + tileDataWindow.max.x, row + ImagePlug::tileSize(), 0.0f );
+
+							// Flip from Gaffer's Y-up coordinates to the file's Y-down ones.
+							const int fileY = spec.full_y + spec.full_y + spec.full_height - ( tileOrigin.y + y ) - 1;
+							m_mappedEXR->readScanline(
+								channelIndex, fileY,
+								tileOrigin.x + tileDataWindow.min.x, tileOrigin.x + tileDataWindow.max.x,
+								row + tileDataWindow.min.x
+							);
+						}
+					}
+				},
+				taskGroupContext
+			);
+		}
+
+		// Reads all channels of `regionRect` (in file coordinates) into `buffer`,
+		// which must be large enough to hold them.
+		void readRegion( const ImageSpec &spec, int subImage, const Box2i &regionRect, float *buffer )
+		{
+			// Tell OIIO to do the actual read/decompress to the buffer
+			if( spec.tile_width == 0 && spec.tile_height == 0 )
+			{
+				if( !m_imageInput->read_scanlines(
+					subImage, 0,
+					regionRect.min.y, regionRect.max.y, 0, 0, spec.nchannels, TypeDesc::FLOAT, buffer
+				) )
+				{
+					handleOIIOError( "Failed to read scanlines", flopDisplayWindow( regionRect, spec ) );
+				}
+			}
+			else
+			{
+				if( !m_imageInput->read_tiles(
+					subImage, 0,
+					regionRect.min.x, regionRect.max.x, regionRect.min.y, regionRect.max.y,
+					0, 1, 0, spec.nchannels, TypeDesc::FLOAT, buffer
+				) )
+				{
+					handleOIIOError( "Failed to read tiles", flopDisplayWindow( regionRect, spec ) );
+				}
+			}
+		}
+
 		void processFileRegionScanline(
 			const ImageSpec &spec, const V3i &tileBatchOrigin, const Box2i &regionRect, std::vector<float> &buffer,
 			const V2i &tileBatchSize, std::vector< float* > &tileChannelPointers,
@@ -1319,14 +1835,7 @@ class File
 					buffer, spec.nchannels * regionRect.size().x * regionRect.size().y
 				);
 
-				// Tell OIIO to do the actual read/decompress to the temp buffer
-				if( !m_imageInput->read_scanlines(
-					tileBatchOrigin.z, 0,
-					regionRect.min.y, regionRect.max.y, 0, 0, spec.nchannels, TypeDesc::FLOAT, &buffer[0]
-				) )
-				{
-					handleOIIOError( "Failed to read scanlines", gafferRegionRect );
-				}
+				readRegion( spec, tileBatchOrigin.z, regionRect, &buffer[0] );
 
 				// Copy the data from the temp buffer to whatever tiles it belongs in
 				blitOIIORectToTileBatch(
@@ -1375,15 +1884,7 @@ class File
 					buffer, spec.nchannels * regionRect.size().x * regionRect.size().y
 				);
 
-				// Tell OIIO to do the actual read/decompress to the temp buffer
-				if( ! m_imageInput->read_tiles(
-					tileBatchOrigin.z, 0,
-					regionRect.min.x, regionRect.max.x, regionRect.min.y, regionRect.max.y,
-					0, 1, 0, spec.nchannels, TypeDesc::FLOAT, &buffer[0]
-				) )
-				{
-					handleOIIOError( "Failed to read tiles", gafferRegionRect );
-				}
+				readRegion( spec, tileBatchOrigin.z, regionRect, &buffer[0] );
 
 				// Copy the data from the temp buffer to whatever tiles it belongs in
 				blitOIIORectToTileBatch(
@@ -1565,6 +2066,9 @@ class File
 		std::unique_ptr<ImageInput> m_imageInput;
 		StringVectorDataPtr m_viewNamesData;
 		std::map<std::string, std::unique_ptr< View > > m_views;
+		std::unique_ptr<GafferImage::Private::MappedEXR> m_mappedEXR;
+		// Maps from OIIO channel index to MappedEXR channel index.
+		std::vector<size_t> m_mappedChannelIndices;
 };
 
 using FilePtr = std::shared_ptr<File>;
@@ -1578,6 +2082,8 @@ struct CacheEntry
 };
 
 
+std::atomic_bool g_memoryMapping( getenv( "GAFFER_IMAGE_READER_MEMORY_MAPPING" ) && strcmp( getenv( "GAFFER_IMAGE_READER_MEMORY_MAPPING" ), "1" ) == 0 );
+
 CacheEntry fileCacheGetter( const std::pair< std::string, ImageReader::ChannelInterpretation> &fileNameAndChannelInterpretation, size_t &cost, const IECore::Canceller *canceller )
 {
 	cost = 1;
@@ -1600,7 +2106,13 @@ CacheEntry fileCacheGetter( const std::pair< std::string, ImageReader::ChannelIn
 		return result;
 	}
 
-	result.file.reset( new File( std::move( imageInput ), fileName, fileNameAndChannelInterpretation.second ) );
+	std::unique_ptr<GafferImage::Private::MappedEXR> mappedEXR;
+	if( g_memoryMapping && strcmp( imageInput->format_name(), "openexr" ) == 0 )
+	{
+		mappedEXR = GafferImage::Private::MappedEXR::create( fileName );
+	}
+
+	result.file.reset( new File( std::move( imageInput ), fileName, fileNameAndChannelInterpretation.second, std::move( mappedEXR ) ) );
 
 	return result;
 }
@@ -1753,6 +2265,63 @@ size_t OpenImageIOReader::getOpenFilesLimit()
 	return fileCache()->getMaxCost();
 }
 
+void OpenImageIOReader::setOpenFilesEvictionPolicy( Gaffer::ValuePlug::CacheEvictionPolicy policy )
+{
+	fileCache()->setEvictionPolicy(
+		policy == ValuePlug::CacheEvictionPolicy::CostAware ? FileHandleCache::EvictionPolicy::CostAware : FileHandleCache::EvictionPolicy::LRU
+	);
+}
+
+Gaffer::ValuePlug::CacheEvictionPolicy OpenImageIOReader::getOpenFilesEvictionPolicy()
+{
+	return fileCache()->getEvictionPolicy() == FileHandleCache::EvictionPolicy::CostAware ? ValuePlug::CacheEvictionPolicy::CostAware : ValuePlug::CacheEvictionPolicy::LRU;
+}
+
+void OpenImageIOReader::setIOThreads( size_t numThreads )
+{
+	ioQueue().setNumThreads( numThreads );
+}
+
+size_t OpenImageIOReader::getIOThreads()
+{
+	return ioQueue().getNumThreads();
+}
+
+void OpenImageIOReader::setMemoryMappingEnabled( bool enabled )
+{
+	if( enabled != g_memoryMapping.exchange( enabled ) )
+	{
+		// Files are mapped when they are opened, so we must
+		// reopen them all for the change to take effect.
+		fileCache()->clear();
+	}
+}
+
+bool OpenImageIOReader::getMemoryMappingEnabled()
+{
+	return g_memoryMapping;
+}
+
+void OpenImageIOReader::setHalfTileStorageEnabled( bool enabled )
+{
+	g_halfTileStorage = enabled;
+}
+
+bool OpenImageIOReader::getHalfTileStorageEnabled()
+{
+	return g_halfTileStorage;
+}
+
+size_t OpenImageIOReader::ioQueueDepth()
+{
+	return ioQueue().queueDepth();
+}
+
+size_t OpenImageIOReader::ioBytesInFlight()
+{
+	return ioQueue().bytesInFlight();
+}
+
 size_t OpenImageIOReader::supportedExtensions( std::vector<std::string> &extensions )
 {
 	std::string attr;
@@ -2229,6 +2798,16 @@ IECore::ConstFloatVectorDataPtr OpenImageIOReader::computeChannelData( const std
 			tileBatch->members()[0]
 	)->members()[ subIndex ];
 
+	if( auto halfTile = IECore::runTimeCast< const HalfVectorData >( curTileChannel.get() ) )
+	{
+		// Stored as half by `convertToHalfTiles()`. Our channel data isn't
+		// cached, so this conversion is the only copy of the float data.
+		FloatVectorDataPtr result = new FloatVectorData();
+		podVectorResizeUninitialized<float>( result->writable(), halfTile->readable().size() );
+		GafferImage::Private::halfToFloat( halfTile->readable().data(), halfTile->readable().size(), result->writable().data() );
+		return result;
+	}
+
 	return IECore::runTimeCast< const FloatVectorData >( curTileChannel );
 }
 
@@ -201,4 +201,43 @@ void Premultiply::processChannelData( const Gaffer::Context *context, const Imag
 	}
 }
 
+bool Premultiply::processesConstantTiles( const Gaffer::Context *context, const std::string &channel ) const
+{
+	std::string alphaChannel;
+	ConstStringVectorDataPtr inChannelNamesPtr;
+	bool useDeepVisibility;
+	bool deep;
+	{
+		ImagePlug::GlobalScope c( context );
+		alphaChannel = alphaChannelPlug()->getValue();
+		inChannelNamesPtr = inPlug()->channelNamesPlug()->getValue();
+		useDeepVisibility = useDeepVisibilityPlug()->getValue();
+		deep = inPlug()->deepPlug()->getValue();
+	}
+
+	if( deep )
+	{
+		return false;
+	}
+	else if( useDeepVisibility || channel == alphaChannel )
+	{
+		// Flat image passed through unchanged.
+		return true;
+	}
+
+	const std::vector<std::string> &inChannelNames = inChannelNamesPtr->readable();
+	if( std::find( inChannelNames.begin(), inChannelNames.end(), alphaChannel ) == inChannelNames.end() )
+	{
+		// Leave processChannelData() to report the error.
+		return false;
+	}
+
+	// Uniform if multiplying by uniform alpha.
+	ImagePlug::ChannelDataScope channelDataScope( context );
+	channelDataScope.setChannelName( &alphaChannel );
+	ConstFloatVectorDataPtr aData = inPlug()->channelDataPlug()->getValue();
+	float alpha;
+	return ImagePlug::isConstantTile( aData.get(), alpha );
+}
+
 } // namespace GafferImage
@@ -36,6 +36,7 @@
 
 #include "GafferImage/RankFilter.h"
 
+#include "GafferImage/Private/RegionBuffer.h"
 #include "GafferImage/Sampler.h"
 
 #include "Gaffer/Context.h"
@@ -49,6 +50,7 @@ using namespace Imath;
 using namespace IECore;
 using namespace Gaffer;
 using namespace GafferImage;
+using namespace GafferImage::Private;
 
 GAFFER_NODE_DEFINE_TYPE( RankFilter );
 
@@ -208,16 +210,15 @@ public:
 	{
 	}
 
-	inline void sampleRow( int rowIndex, Sampler &sampler, const Box2i &rowBound )
+	inline void sampleRow( int rowIndex, const RegionBuffer &regionBuffer, const Box2i &rowBound )
 	{
 		// Store the maximum value of the given row
 		float r = -infinity;
-		sampler.visitPixels( rowBound,
-			[&r] ( float v, int x, int y )
-			{
-				r = std::max( r, v );
-			}
-		);
+		const float *values = regionBuffer.pixel( rowBound.min.x, rowBound.min.y );
+		for( int i = 0, e = rowBound.size().x; i < e; ++i )
+		{
+			r = std::max( r, values[i] );
+		}
 		m_values[rowIndex] = r;
 	}
 
@@ -250,16 +251,15 @@ public:
 	{
 	}
 
-	inline void sampleRow( int rowIndex, Sampler &sampler, const Box2i &rowBound )
+	inline void sampleRow( int rowIndex, const RegionBuffer &regionBuffer, const Box2i &rowBound )
 	{
 		// Store the minimum value of the given row
 		float r = infinity;
-		sampler.visitPixels( rowBound,
-			[&r] ( float v, int x, int y )
-			{
-				r = std::min( r, v );
-			}
-		);
+		const float *values = regionBuffer.pixel( rowBound.min.x, rowBound.min.y );
+		for( int i = 0, e = rowBound.size().x; i < e; ++i )
+		{
+			r = std::min( r, values[i] );
+		}
 		m_values[rowIndex] = r;
 	}
 
@@ -362,24 +362,18 @@ public:
 		}
 	}
 
-	inline void sampleRow( int rowIndex, Sampler &sampler, const Box2i &rowBound )
+	inline void sampleRow( int rowIndex, const RegionBuffer &regionBuffer, const Box2i &rowBound )
 	{
 		// Find the chunk of pixels in m_sortedRows corresponding to this row
 		float *currentRow = &m_sortedRows[ m_size.x * rowIndex ];
 
 		// Grab the row of pixels into the buffer
-		float *writePos = currentRow;
-		sampler.visitPixels( rowBound,
-			[&writePos] ( float v, int x, int y )
-			{
-				if( std::isnan( v ) )
-				{
-					v = -infinity;
-				}
-				*writePos = v;
-				writePos++;
-			}
-		);
+		const float *values = regionBuffer.pixel( rowBound.min.x, rowBound.min.y );
+		for( int i = 0; i < m_size.x; ++i )
+		{
+			const float v = values[i];
+			currentRow[i] = std::isnan( v ) ? -infinity : v;
+		}
 
 		// Sort the new row
 		//
@@ -570,6 +564,328 @@ private:
 	std::vector< MaxHeap::handle_type > m_maxHeapHandles;
 };
 
+// The buffers above all do work proportional to the radius for every pixel, which
+// becomes very slow for large radii. For those we use the following algorithms instead,
+// which process a whole tile at a time.
+//
+// Erode and dilate are separable, so we first compute the minimum or maximum of each
+// row of the support, and then the minimum or maximum of those results in each column.
+// Each 1D pass uses the algorithm from "A fast algorithm for local minimum and maximum
+// filters on rectangular and octagonal kernels" by van Herk, and "Computing 2-D min,
+// median, and max filters" by Gil and Werman. This divides the line into blocks the
+// size of the window, and computes running results forwards and backwards within each
+// block. Any window then spans at most two blocks, and its result can be found by
+// combining one value from each, for a cost per pixel that is independent of the radius.
+
+template<typename Op>
+void vanHerkGilWerman( const float *in, int inStride, int outSize, int windowSize, float *out, int outStride, std::vector<float> &forwards, std::vector<float> &backwards )
+{
+	const int inSize = outSize + windowSize - 1;
+	forwards.resize( inSize );
+	backwards.resize( inSize );
+
+	const Op op;
+	for( int blockStart = 0; blockStart < inSize; blockStart += windowSize )
+	{
+		const int blockEnd = std::min( blockStart + windowSize, inSize );
+
+		float v = forwards[blockStart] = in[blockStart * inStride];
+		for( int i = blockStart + 1; i < blockEnd; ++i )
+		{
+			v = forwards[i] = op( v, in[i * inStride] );
+		}
+
+		v = backwards[blockEnd - 1] = in[(blockEnd - 1) * inStride];
+		for( int i = blockEnd - 2; i >= blockStart; --i )
+		{
+			v = backwards[i] = op( v, in[i * inStride] );
+		}
+	}
+
+	for( int i = 0; i < outSize; ++i )
+	{
+		out[i * outStride] = op( backwards[i], forwards[i + windowSize - 1] );
+	}
+}
+
+struct MinOp
+{
+	float operator()( float a, float b ) const { return std::min( a, b ); }
+	// The value used in place of NaN, so that NaNs are ignored, matching RankMinBuffer.
+	static float nanReplacement() { return infinity; }
+};
+
+struct MaxOp
+{
+	float operator()( float a, float b ) const { return std::max( a, b ); }
+	static float nanReplacement() { return -infinity; }
+};
+
+template<typename Op>
+void processTileSeparable( const RegionBuffer &regionBuffer, const V2i &radius, const Box2i &tileBound, vector<float> &result, const Canceller *canceller )
+{
+	const V2i tileSize = tileBound.size();
+	const V2i windowSize = 2 * radius + V2i( 1 );
+
+	// Horizontal pass, reducing each input row to the width of the tile.
+
+	const int numRows = tileSize.y + windowSize.y - 1;
+	std::vector<float> rows( numRows * tileSize.x );
+	std::vector<float> line( tileSize.x + windowSize.x - 1 );
+	std::vector<float> forwards, backwards;
+
+	for( int i = 0; i < numRows; ++i )
+	{
+		IECore::Canceller::check( canceller );
+
+		const float *values = regionBuffer.pixel( tileBound.min.x - radius.x, tileBound.min.y - radius.y + i );
+		for( size_t x = 0; x < line.size(); ++x )
+		{
+			line[x] = std::isnan( values[x] ) ? Op::nanReplacement() : values[x];
+		}
+
+		vanHerkGilWerman<Op>( line.data(), 1, tileSize.x, windowSize.x, rows.data() + i * tileSize.x, 1, forwards, backwards );
+	}
+
+	// Vertical pass, from `rows` into `result`.
+
+	for( int x = 0; x < tileSize.x; ++x )
+	{
+		IECore::Canceller::check( canceller );
+		vanHerkGilWerman<Op>( rows.data() + x, tileSize.x, tileSize.y, windowSize.y, result.data() + x, tileSize.x, forwards, backwards );
+	}
+}
+
+// For the median, we use a sliding histogram as described in "Median Filtering in Constant Time" by
+// Perreault and Hébert, and "A fast two-dimensional median filtering algorithm" by Huang et al. These
+// rely on a histogram with a fixed number of bins, which we don't have for floating point data. So we
+// first sort all the pixels needed by the tile, and convert each pixel to its rank within them. The
+// histogram is then indexed by rank, with a second level of coarse bins so that the median can be
+// found quickly. As the support slides to the next pixel, we remove one row of pixels from the histogram
+// and add another, and then move the median up or down to rebalance it. This avoids the cost of sorting
+// every row of every pixel's support, which dominates the RankMedianBuffer for large radii.
+//
+// Unlike Perreault and Hébert, we don't maintain a histogram per column, because with a histogram of the
+// same size as the support, the per-column histograms would cost more to combine than the pixels they
+// summarise. So the cost per pixel is proportional to the radius, but with a far smaller constant than
+// for the RankMedianBuffer.
+
+// Sorts `values`, checking for cancellation periodically. We sort runs of `runLength` elements first,
+// and then merge them, so that each individual operation is short enough to give prompt cancellation.
+void sortCancellably( std::vector<float> &values, size_t runLength, const Canceller *canceller )
+{
+	const size_t size = values.size();
+	for( size_t begin = 0; begin < size; begin += runLength )
+	{
+		IECore::Canceller::check( canceller );
+		std::sort( values.begin() + begin, values.begin() + std::min( begin + runLength, size ) );
+	}
+
+	for( size_t width = runLength; width < size; width *= 2 )
+	{
+		for( size_t begin = 0; begin + width < size; begin += 2 * width )
+		{
+			IECore::Canceller::check( canceller );
+			std::inplace_merge( values.begin() + begin, values.begin() + begin + width, values.begin() + std::min( begin + 2 * width, size ) );
+		}
+	}
+}
+
+class RankHistogram
+{
+
+	public :
+
+		RankHistogram( size_t numRanks, int count )
+			:	m_fine( numRanks, 0 ), m_coarse( numRanks / g_coarseSize + 1, 0 ),
+				m_target( count / 2 ), m_median( 0 ), m_below( 0 )
+		{
+		}
+
+		void add( uint32_t rank )
+		{
+			m_fine[rank]++;
+			m_coarse[rank / g_coarseSize]++;
+			m_below += rank < m_median;
+		}
+
+		void remove( uint32_t rank )
+		{
+			m_fine[rank]--;
+			m_coarse[rank / g_coarseSize]--;
+			m_below -= rank < m_median;
+		}
+
+		// Returns the rank of the median. Must only be called when the histogram
+		// contains exactly the `count` passed to the constructor.
+		uint32_t median()
+		{
+			// We maintain `m_below` as the number of values with a rank lower than
+			// `m_median`. The median is the rank where there are no more than `m_target`
+			// values below it, but more than `m_target` values at or below it. Move
+			// downwards or upwards until that is true, skipping whole coarse bins where
+			// possible.
+
+			while( m_below > m_target )
+			{
+				const uint32_t coarse = m_median / g_coarseSize;
+				if( m_median % g_coarseSize == 0 && coarse > 0 && m_below - m_coarse[coarse-1] > m_target )
+				{
+					m_below -= m_coarse[coarse-1];
+					m_median -= g_coarseSize;
+				}
+				else
+				{
+					m_median--;
+					m_below -= m_fine[m_median];
+				}
+			}
+
+			while( m_below + m_fine[m_median] <= m_target )
+			{
+				const uint32_t coarse = m_median / g_coarseSize;
+				if( m_median % g_coarseSize == 0 && m_below + m_coarse[coarse] <= m_target )
+				{
+					m_below += m_coarse[coarse];
+					m_median += g_coarseSize;
+				}
+				else
+				{
+					m_below += m_fine[m_median];
+					m_median++;
+				}
+			}
+
+			return m_median;
+		}
+
+	private :
+
+		static constexpr uint32_t g_coarseSize = 64;
+
+		std::vector<int> m_fine;
+		std::vector<int> m_coarse;
+		const int m_target;
+		uint32_t m_median;
+		int m_below;
+
+};
+
+void processTileHistogramMedian( const RegionBuffer &regionBuffer, const V2i &radius, const Box2i &tileBound, vector<float> &result, const Canceller *canceller )
+{
+	// Gather all the values needed by the tile.
+
+	const Box2i inputBound( tileBound.min - radius, tileBound.max + radius );
+	const V2i inputSize = inputBound.size();
+
+	std::vector<float> values( inputSize.x * inputSize.y );
+	for( int y = 0; y < inputSize.y; ++y )
+	{
+		IECore::Canceller::check( canceller );
+		const float *row = regionBuffer.pixel( inputBound.min.x, inputBound.min.y + y );
+		float *out = values.data() + y * inputSize.x;
+		for( int x = 0; x < inputSize.x; ++x )
+		{
+			// Treat NaN as negative infinity, matching RankMedianBuffer.
+			out[x] = std::isnan( row[x] ) ? -infinity : row[x];
+		}
+	}
+
+	// Convert them to ranks.
+
+	std::vector<float> sortedValues = values;
+	sortCancellably( sortedValues, inputSize.x, canceller );
+	sortedValues.erase( std::unique( sortedValues.begin(), sortedValues.end() ), sortedValues.end() );
+
+	std::vector<uint32_t> ranks( values.size() );
+	for( int y = 0; y < inputSize.y; ++y )
+	{
+		IECore::Canceller::check( canceller );
+		for( int i = y * inputSize.x, e = i + inputSize.x; i < e; ++i )
+		{
+			ranks[i] = std::lower_bound( sortedValues.begin(), sortedValues.end(), values[i] ) - sortedValues.begin();
+		}
+	}
+
+	// Slide the support over the tile. We move down the first column, up the second
+	// and so on, so that every step only needs to update one row of the histogram.
+	// Coordinates are relative to `inputBound`, so the support for output pixel `p`
+	// covers `[p, p + 2 * radius]`.
+
+	const V2i windowSize = 2 * radius + V2i( 1 );
+	const V2i tileSize = tileBound.size();
+	RankHistogram histogram( sortedValues.size(), windowSize.x * windowSize.y );
+
+	auto updateRow = [&] ( int y, int xBegin, bool add ) {
+		const uint32_t *r = ranks.data() + y * inputSize.x + xBegin;
+		for( int i = 0; i < windowSize.x; ++i )
+		{
+			add ? histogram.add( r[i] ) : histogram.remove( r[i] );
+		}
+	};
+
+	auto updateColumn = [&] ( int x, int yBegin, bool add ) {
+		const uint32_t *r = ranks.data() + yBegin * inputSize.x + x;
+		for( int i = 0; i < windowSize.y; ++i )
+		{
+			add ? histogram.add( r[i * inputSize.x] ) : histogram.remove( r[i * inputSize.x] );
+		}
+	};
+
+	for( int y = 0; y < windowSize.y; ++y )
+	{
+		updateRow( y, 0, true );
+	}
+
+	for( int x = 0; x < tileSize.x; ++x )
+	{
+		const bool down = x % 2 == 0;
+		int y = down ? 0 : tileSize.y - 1;
+		if( x > 0 )
+		{
+			updateColumn( x - 1, y, false );
+			updateColumn( x + windowSize.x - 1, y, true );
+		}
+
+		for( int i = 0; i < tileSize.y; ++i )
+		{
+			IECore::Canceller::check( canceller );
+			if( i > 0 )
+			{
+				if( down )
+				{
+					updateRow( y - 1, x, false );
+					updateRow( y + windowSize.y - 1, x, true );
+				}
+				else
+				{
+					updateRow( y + windowSize.y, x, false );
+					updateRow( y, x, true );
+				}
+			}
+
+			result[ImagePlug::pixelIndex( tileBound.min + V2i( x, y ), tileBound.min )] = sortedValues[histogram.median()];
+			y += down ? 1 : -1;
+		}
+	}
+}
+
+
+// Returns true if `processTileHistogramMedian()` should be used in preference
+// to `processTile<RankMedianBuffer>()`. The histogram has a higher fixed cost
+// per tile, so is only faster when the support contains enough pixels. It also
+// needs several values per input pixel, so we avoid it when the input region
+// for the tile would be enormous.
+bool useHistogramMedian( const V2i &radius )
+{
+	const V2i windowSize = 2 * radius + V2i( 1 );
+	const V2i inputSize = windowSize + V2i( ImagePlug::tileSize() - 1 );
+	return
+		(int64_t)windowSize.x * windowSize.y >= 64 &&
+		(int64_t)inputSize.x * inputSize.y <= ( 1 << 22 )
+	;
+}
+
 inline int positiveModulo( int a, int d )
 {
 	return ( ( a % d ) + d ) % d;
@@ -578,7 +894,7 @@ inline int positiveModulo( int a, int d )
 // Fill in an accumulator buffer of the appropriate type, and then step it through each pixel, outputting
 // the result for each pixel in the tile.
 template< class Buffer >
-void processTile( Sampler &sampler, const V2i &radius, const Box2i &tileBound, vector<float> &result, const Canceller *canceller )
+void processTile( const RegionBuffer &regionBuffer, const V2i &radius, const Box2i &tileBound, vector<float> &result, const Canceller *canceller )
 {
 	V2i s = 2 * radius + V2i( 1 );
 	Buffer buffer( s );
@@ -596,7 +912,7 @@ void processTile( Sampler &sampler, const V2i &radius, const Box2i &tileBound, v
 		// that will be filled on the first iteration of the for loop below.
 		while( rowBound.min.y < tileBound.min.y + radius.y )
 		{
-			buffer.sampleRow( positiveModulo( rowBound.min.y, s.y ), sampler, rowBound );
+			buffer.sampleRow( positiveModulo( rowBound.min.y, s.y ), regionBuffer, rowBound );
 			rowBound.min.y++;
 			rowBound.max.y++;
 		}
@@ -606,7 +922,7 @@ void processTile( Sampler &sampler, const V2i &radius, const Box2i &tileBound, v
 			IECore::Canceller::check( canceller );
 
 			// Replace one row of the buffer with the next row
-			buffer.sampleRow( positiveModulo( rowBound.min.y, s.y ), sampler, rowBound );
+			buffer.sampleRow( positiveModulo( rowBound.min.y, s.y ), regionBuffer, rowBound );
 
 			// We now have a buffer with all the row data for this pixel, we can get the result for this pixel
 			result[ ImagePlug::pixelIndex( p, tileBound.min ) ] = buffer.currentResult();
@@ -619,7 +935,7 @@ void processTile( Sampler &sampler, const V2i &radius, const Box2i &tileBound, v
 }
 
 template< class Buffer >
-void processTileIndices( Sampler &sampler, const V2i &radius, const Box2i &tileBound, vector<V2i> &result, const Canceller *canceller )
+void processTileIndices( const RegionBuffer &regionBuffer, const V2i &radius, const Box2i &tileBound, vector<V2i> &result, const Canceller *canceller )
 {
 	V2i s = 2 * radius + V2i( 1 );
 	Buffer buffer( s );
@@ -632,7 +948,7 @@ void processTileIndices( Sampler &sampler, const V2i &radius, const Box2i &tileB
 		// Initialize buffer to start this column
 		while( rowBound.min.y < tileBound.min.y + radius.y )
 		{
-			buffer.sampleRow( positiveModulo( rowBound.min.y, s.y ), sampler, rowBound );
+			buffer.sampleRow( positiveModulo( rowBound.min.y, s.y ), regionBuffer, rowBound );
 			rowBound.min.y++;
 			rowBound.max.y++;
 		}
@@ -643,7 +959,7 @@ void processTileIndices( Sampler &sampler, const V2i &radius, const Box2i &tileB
 			IECore::Canceller::check( canceller );
 
 			// Find the result for this pixel, same as in processTile() above
-			buffer.sampleRow( positiveModulo( rowBound.min.y, s.y ), sampler, rowBound );
+			buffer.sampleRow( positiveModulo( rowBound.min.y, s.y ), regionBuffer, rowBound );
 			float resultValue = buffer.currentResult();
 
 			Imath::Box2i rescanBound( p + V2i( -radius ), p + V2i( radius.x + 1, -radius.y + 1 ) );
@@ -680,7 +996,7 @@ void processTileIndices( Sampler &sampler, const V2i &radius, const Box2i &tileB
 				{
 					if( buffer.rowContainsResult( positiveModulo( rescanBound.min.y, s.y ), resultValue ) )
 					{
-						sampler.visitPixels( rescanBound,
+						regionBuffer.visitPixels( rescanBound,
 							[p, resultValue, &r, &closestMatch] ( float v, int x, int y )
 							{
 								if(
@@ -760,7 +1076,7 @@ void RankFilter::compute( Gaffer::ValuePlug *output, const Gaffer::Context *cont
 		const Box2i tileBound( tileOrigin, tileOrigin + V2i( ImagePlug::tileSize() ) );
 		const Box2i inputBound( tileBound.min - radius, tileBound.max + radius );
 
-		Sampler sampler(
+		const RegionBuffer regionBuffer(
 			inPlug(),
 			// This plug should only be evaluated with channel name already set to the driver channel
 			context->get<std::string>( ImagePlug::channelNameContextName ),
@@ -771,13 +1087,13 @@ void RankFilter::compute( Gaffer::ValuePlug *output, const Gaffer::Context *cont
 		switch( m_mode )
 		{
 			case MedianRank:
-				processTileIndices<RankMedianBuffer>( sampler, radius, tileBound, result, context->canceller() );
+				processTileIndices<RankMedianBuffer>( regionBuffer, radius, tileBound, result, context->canceller() );
 				break;
 			case ErodeRank:
-				processTileIndices<RankMinBuffer>( sampler, radius, tileBound, result, context->canceller() );
+				processTileIndices<RankMinBuffer>( regionBuffer, radius, tileBound, result, context->canceller() );
 				break;
 			case DilateRank:
-				processTileIndices<RankMaxBuffer>( sampler, radius, tileBound, result, context->canceller() );
+				processTileIndices<RankMaxBuffer>( regionBuffer, radius, tileBound, result, context->canceller() );
 				break;
 		}
 
@@ -838,7 +1154,7 @@ IECore::ConstFloatVectorDataPtr RankFilter::computeChannelData( const std::strin
 	const Box2i tileBound( tileOrigin, tileOrigin + V2i( ImagePlug::tileSize() ) );
 	const Box2i inputBound( tileBound.min - radius, tileBound.max + radius );
 
-	Sampler sampler(
+	const RegionBuffer regionBuffer(
 		inPlug(),
 		channelName,
 		inputBound,
@@ -868,7 +1184,7 @@ IECore::ConstFloatVectorDataPtr RankFilter::computeChannelData( const std::strin
 			{
 				const V2i &offset = *offsetsIt++;
 				V2i sourcePixel = p + offset;
-				result.push_back( sampler.sample( sourcePixel.x, sourcePixel.y ) );
+				result.push_back( regionBuffer.sample( sourcePixel.x, sourcePixel.y ) );
 			}
 		}
 
@@ -880,13 +1196,20 @@ IECore::ConstFloatVectorDataPtr RankFilter::computeChannelData( const std::strin
 	switch( m_mode )
 	{
 		case MedianRank:
-			processTile<RankMedianBuffer>( sampler, radius, tileBound, result, context->canceller() );
+			if( useHistogramMedian( radius ) )
+			{
+				processTileHistogramMedian( regionBuffer, radius, tileBound, result, context->canceller() );
+			}
+			else
+			{
+				processTile<RankMedianBuffer>( regionBuffer, radius, tileBound, result, context->canceller() );
+			}
 			break;
 		case ErodeRank:
-			processTile<RankMinBuffer>( sampler, radius, tileBound, result, context->canceller() );
+			processTileSeparable<MinOp>( regionBuffer, radius, tileBound, result, context->canceller() );
 			break;
 		case DilateRank:
-			processTile<RankMaxBuffer>( sampler, radius, tileBound, result, context->canceller() );
+			processTileSeparable<MaxOp>( regionBuffer, radius, tileBound, result, context->canceller() );
 			break;
 	}
 
@@ -0,0 +1,219 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "GafferImage/Private/RegionBuffer.h"
+
+#include "IECore/Canceller.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+using namespace std;
+using namespace Imath;
+using namespace IECore;
+using namespace Gaffer;
+using namespace GafferImage;
+using namespace GafferImage::Private;
+
+namespace
+{
+
+V2i regionSize( const Box2i &region )
+{
+	return BufferAlgo::empty( region ) ? V2i( 0 ) : region.size();
+}
+
+} // namespace
+
+RegionBuffer::RegionBuffer( const GafferImage::ImagePlug *plug, const std::string &channelName, const Imath::Box2i &region, Sampler::BoundingMode boundingMode )
+	:	m_region( region ), m_width( regionSize( region ).x ), m_data( m_width * regionSize( region ).y, 0.0f )
+{
+	Box2i dataWindow;
+	{
+		ImagePlug::GlobalScope c( Context::current() );
+		if( plug->deepPlug()->getValue() )
+		{
+			throw IECore::Exception( "RegionBuffer does not support deep image data" );
+		}
+		dataWindow = plug->dataWindowPlug()->getValue();
+	}
+
+	if( m_data.empty() || BufferAlgo::empty( dataWindow ) )
+	{
+		// Even in Clamp mode, there is nothing to clamp to, so
+		// everything is black, as it is for the Sampler.
+		return;
+	}
+
+	// The columns we can copy directly from the input, and the
+	// columns we clamp to on either side of them. If `copyMinX >= copyMaxX`
+	// then there are no columns to copy and we must be clamping everything.
+
+	const int copyMinX = std::max( m_region.min.x, dataWindow.min.x );
+	const int copyMaxX = std::min( m_region.max.x, dataWindow.max.x );
+	if( boundingMode == Sampler::Black && copyMinX >= copyMaxX )
+	{
+		return;
+	}
+
+	// Range of input tiles that we need in X.
+
+	const int tileMinX = ImagePlug::tileOrigin( V2i( std::clamp( m_region.min.x, dataWindow.min.x, dataWindow.max.x - 1 ), 0 ) ).x;
+	const int tileMaxX = ImagePlug::tileOrigin( V2i( std::clamp( m_region.max.x - 1, dataWindow.min.x, dataWindow.max.x - 1 ), 0 ) ).x + ImagePlug::tileSize();
+	vector<ConstFloatVectorDataPtr> tiles( ( tileMaxX - tileMinX ) / ImagePlug::tileSize() );
+	int tilesOriginY = std::numeric_limits<int>::min();
+
+	auto inputPixel = [&] ( int x, int y ) -> const float * {
+		const V2i tileOrigin = ImagePlug::tileOrigin( V2i( x, y ) );
+		ConstFloatVectorDataPtr &tile = tiles[( tileOrigin.x - tileMinX ) / ImagePlug::tileSize()];
+		if( !tile )
+		{
+			tile = plug->channelData( channelName, tileOrigin );
+		}
+		return tile->readable().data() + ImagePlug::pixelIndex( V2i( x, y ), tileOrigin );
+	};
+
+	int previousInputY = std::numeric_limits<int>::min();
+	const IECore::Canceller *canceller = Context::current()->canceller();
+	for( int y = m_region.min.y; y < m_region.max.y; ++y )
+	{
+		IECore::Canceller::check( canceller );
+
+		int inputY = y;
+		if( boundingMode == Sampler::Clamp )
+		{
+			inputY = std::clamp( y, dataWindow.min.y, dataWindow.max.y - 1 );
+		}
+		else if( y < dataWindow.min.y || y >= dataWindow.max.y )
+		{
+			continue;
+		}
+
+		float *out = m_data.data() + ( y - m_region.min.y ) * m_width;
+		if( inputY == previousInputY )
+		{
+			// Clamping, and we already have the row we need.
+			memcpy( out, out - m_width, m_width * sizeof( float ) );
+			continue;
+		}
+		previousInputY = inputY;
+
+		const int inputTileOriginY = ImagePlug::tileOrigin( V2i( 0, inputY ) ).y;
+		if( inputTileOriginY != tilesOriginY )
+		{
+			// Moved on to the next row of tiles. Release the previous
+			// tiles so we don't hold more than necessary.
+			std::fill( tiles.begin(), tiles.end(), nullptr );
+			tilesOriginY = inputTileOriginY;
+		}
+
+		// Copy spans from each tile.
+
+		for( int x = copyMinX; x < copyMaxX; )
+		{
+			const int spanEnd = std::min( copyMaxX, ImagePlug::tileOrigin( V2i( x, 0 ) ).x + ImagePlug::tileSize() );
+			memcpy( out + ( x - m_region.min.x ), inputPixel( x, inputY ), ( spanEnd - x ) * sizeof( float ) );
+			x = spanEnd;
+		}
+
+		if( boundingMode == Sampler::Black )
+		{
+			continue;
+		}
+
+		// Clamp either side.
+
+		if( m_region.min.x < dataWindow.min.x )
+		{
+			std::fill(
+				out, out + ( std::min( m_region.max.x, dataWindow.min.x ) - m_region.min.x ),
+				*inputPixel( dataWindow.min.x, inputY )
+			);
+		}
+
+		if( m_region.max.x > dataWindow.max.x )
+		{
+			const int fillBegin = std::max( m_region.min.x, dataWindow.max.x );
+			std::fill(
+				out + ( fillBegin - m_region.min.x ), out + m_width,
+				*inputPixel( dataWindow.max.x - 1, inputY )
+			);
+		}
+	}
+}
+
+void RegionBuffer::sample( const Imath::V2f *positions, size_t count, float *result ) const
+{
+	constexpr size_t batchSize = 64;
+	float xf[batchSize];
+	float yf[batchSize];
+	size_t index[batchSize];
+	float v00[batchSize];
+	float v10[batchSize];
+	float v01[batchSize];
+	float v11[batchSize];
+
+	for( size_t begin = 0; begin < count; begin += batchSize )
+	{
+		const size_t n = std::min( batchSize, count - begin );
+		const V2f *p = positions + begin;
+
+		for( size_t i = 0; i < n; ++i )
+		{
+			int xi, yi;
+			xf[i] = OIIO::floorfrac( p[i].x - 0.5, &xi );
+			yf[i] = OIIO::floorfrac( p[i].y - 0.5, &yi );
+			assert( BufferAlgo::contains( m_region, V2i( xi, yi ) ) );
+			assert( BufferAlgo::contains( m_region, V2i( xi + 1, yi + 1 ) ) );
+			index[i] = ( yi - m_region.min.y ) * m_width + ( xi - m_region.min.x );
+		}
+
+		for( size_t i = 0; i < n; ++i )
+		{
+			const float *d = m_data.data() + index[i];
+			v00[i] = d[0];
+			v10[i] = d[1];
+			v01[i] = d[m_width];
+			v11[i] = d[m_width + 1];
+		}
+
+		for( size_t i = 0; i < n; ++i )
+		{
+			result[begin + i] = OIIO::bilerp( v00[i], v10[i], v01[i], v11[i], xf[i], yf[i] );
+		}
+	}
+}
@@ -40,6 +40,7 @@
 #include "GafferImage/DeepPixelAccessor.h"
 #include "GafferImage/ImageAlgo.h"
 #include "GafferImage/FilterAlgo.h"
+#include "GafferImage/Private/RegionBuffer.h"
 #include "GafferImage/Sampler.h"
 
 #include "Gaffer/Context.h"
@@ -235,13 +236,9 @@ inline std::pair< int, int > filterSupport( const float filterRadius, const int
 }
 
 // Precomputes all the filter weights for a whole row or column of a tile. For separable
-// filters these weights can then be reused across all rows/columns in the same tile.
-/// \todo The weights computed for a particular tile could also be reused for all
-/// tiles in the same tile column or row. We could achieve this by outputting
-/// the weights on an internal plug, and using Gaffer's caching to ensure they are
-/// only computed once and then reused. At the time of writing, profiles indicate that
-/// accessing pixels via the Sampler is the main bottleneck, but once that is optimised
-/// perhaps cached filter weights could have a benefit.
+// filters these weights can then be reused across all rows/columns in the same tile, and
+// we output them on an internal plug so that they are also reused by all tiles in the
+// same tile column or row, and by all channels.
 void filterWeights1D( const OIIO::Filter2D *filter, const float inputFilterScale, const float filterRadius, const int x, const float ratio, const float offset, Passes pass, std::vector<int> &supportRanges, std::vector<float> &weights )
 {
 	weights.reserve( ( 2 * ceilf( filterRadius ) + 1 ) * ImagePlug::tileSize() );
@@ -385,6 +382,18 @@ struct ContributionElement
 	float weight;
 };
 
+// The result of `filterWeights1D()`, as stored on the filter weights plugs.
+class FilterWeightsData : public IECore::Data
+{
+public:
+	std::vector<int> supportRanges;
+	std::vector<float> weights;
+	// The sum of the weights for each output pixel.
+	std::vector<float> totals;
+};
+
+IE_CORE_DECLAREPTR( FilterWeightsData )
+
 class DeepResampleData : public IECore::Data
 {
 public:
@@ -1075,6 +1084,8 @@ Resample::Resample( const std::string &name )
 	addChild( new ImagePlug( "__horizontalPass", Plug::Out ) );
 	addChild( new ImagePlug( "__tidyIn", Plug::In, Plug::Default & ~Plug::Serialisable ) );
 	addChild( new ObjectPlug( "__deepResampleData", Gaffer::Plug::Out, IECore::NullObject::defaultNullObject() ) );
+	addChild( new ObjectPlug( "__horizontalFilterWeights", Gaffer::Plug::Out, IECore::NullObject::defaultNullObject() ) );
+	addChild( new ObjectPlug( "__verticalFilterWeights", Gaffer::Plug::Out, IECore::NullObject::defaultNullObject() ) );
 
 
 	// We don't ever want to change these, so we make pass-through connections.
@@ -1202,6 +1213,26 @@ const ObjectPlug *Resample::deepResampleDataPlug() const
 	return getChild<ObjectPlug>( g_firstPlugIndex + 9 );
 }
 
+ObjectPlug *Resample::horizontalFilterWeightsPlug()
+{
+	return getChild<ObjectPlug>( g_firstPlugIndex + 10 );
+}
+
+const ObjectPlug *Resample::horizontalFilterWeightsPlug() const
+{
+	return getChild<ObjectPlug>( g_firstPlugIndex + 10 );
+}
+
+ObjectPlug *Resample::verticalFilterWeightsPlug()
+{
+	return getChild<ObjectPlug>( g_firstPlugIndex + 11 );
+}
+
+const ObjectPlug *Resample::verticalFilterWeightsPlug() const
+{
+	return getChild<ObjectPlug>( g_firstPlugIndex + 11 );
+}
+
 void Resample::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
 {
 	ImageProcessor::affects( input, outputs );
@@ -1229,13 +1260,25 @@ void Resample::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outpu
 		input == debugPlug() ||
 		input == filterDeepPlug() ||
 		input == inPlug()->deepPlug() ||
-		input == deepResampleDataPlug()
+		input == deepResampleDataPlug() ||
+		input == horizontalFilterWeightsPlug() ||
+		input == verticalFilterWeightsPlug()
 	)
 	{
 		outputs.push_back( outPlug()->channelDataPlug() );
 		outputs.push_back( horizontalPassPlug()->channelDataPlug() );
 	}
 
+	if(
+		input == matrixPlug() ||
+		input == filterPlug() ||
+		input->parent<V2fPlug>() == filterScalePlug()
+	)
+	{
+		outputs.push_back( horizontalFilterWeightsPlug() );
+		outputs.push_back( verticalFilterWeightsPlug() );
+	}
+
 	if(
 		input == inPlug()->channelNamesPlug() ||
 		input == inPlug()->dataWindowPlug() ||
@@ -1268,6 +1311,38 @@ void Resample::hash( const Gaffer::ValuePlug *output, const Gaffer::Context *con
 {
 	ImageProcessor::hash( output, context, h );
 
+	if( output == horizontalFilterWeightsPlug() || output == verticalFilterWeightsPlug() )
+	{
+		V2f ratio, offset;
+		V2f inputFilterScale( 0 );
+		{
+			ImagePlug::GlobalScope s( context );
+			ratioAndOffset( matrixPlug()->getValue(), ratio, offset );
+			filterAndScale( filterPlug()->getValue(), ratio, inputFilterScale );
+			inputFilterScale *= filterScalePlug()->getValue();
+		}
+
+		filterPlug()->hash( h );
+		// The default filter depends on the ratio in both axes, so we
+		// must hash both.
+		h.append( ratio );
+
+		const V2i tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
+		if( output == horizontalFilterWeightsPlug() )
+		{
+			h.append( inputFilterScale.x );
+			h.append( offset.x );
+			h.append( tileOrigin.x );
+		}
+		else
+		{
+			h.append( inputFilterScale.y );
+			h.append( offset.y );
+			h.append( tileOrigin.y );
+		}
+		return;
+	}
+
 	if( output != deepResampleDataPlug() )
 	{
 		return;
@@ -1362,6 +1437,54 @@ void Resample::compute( Gaffer::ValuePlug *output, const Gaffer::Context *contex
 {
 	ImageProcessor::compute( output, context );
 
+	if( output == horizontalFilterWeightsPlug() || output == verticalFilterWeightsPlug() )
+	{
+		V2f ratio, offset;
+		V2f inputFilterScale( 0 );
+		const OIIO::Filter2D *filter = nullptr;
+		{
+			ImagePlug::GlobalScope s( context );
+			ratioAndOffset( matrixPlug()->getValue(), ratio, offset );
+			filter = filterAndScale( filterPlug()->getValue(), ratio, inputFilterScale );
+			inputFilterScale *= filterScalePlug()->getValue();
+		}
+
+		if( !filter )
+		{
+			throw IECore::Exception( "No filter weights for nearest filter" );
+		}
+
+		const V2f filterRadius = inputFilterRadius( filter, inputFilterScale );
+		const V2i tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
+
+		FilterWeightsDataPtr result = new FilterWeightsData;
+		if( output == horizontalFilterWeightsPlug() )
+		{
+			filterWeights1D( filter, inputFilterScale.x, filterRadius.x, tileOrigin.x, ratio.x, offset.x, Horizontal, result->supportRanges, result->weights );
+		}
+		else
+		{
+			filterWeights1D( filter, inputFilterScale.y, filterRadius.y, tileOrigin.y, ratio.y, offset.y, Vertical, result->supportRanges, result->weights );
+		}
+
+		// Sum the weights for each pixel, in the same order they will be
+		// applied in, so that the normalised result is unchanged.
+		result->totals.reserve( ImagePlug::tileSize() );
+		std::vector<float>::const_iterator wIt = result->weights.begin();
+		for( size_t i = 0; i < result->supportRanges.size(); i += 2 )
+		{
+			float total = 0.0f;
+			for( int j = result->supportRanges[i]; j < result->supportRanges[i+1]; ++j )
+			{
+				total += *wIt++;
+			}
+			result->totals.push_back( total );
+		}
+
+		static_cast<ObjectPlug *>( output )->setValue( result );
+		return;
+	}
+
 	if( output != deepResampleDataPlug() )
 	{
 		return;
@@ -2165,95 +2288,113 @@ IECore::ConstFloatVectorDataPtr Resample::computeChannelData( const std::string
 		// it is cached for use in the vertical pass. The HorizontalPass
 		// debug mode causes this pass to be output directly for inspection.
 
-		// Pixels in the same column share the same support ranges and filter weights, so
-		// we precompute the weights now to avoid repeating work later.
-		std::vector<int> supportRanges;
-		std::vector<float> weights;
-		filterWeights1D( filter, inputFilterScale.x, filterRadius.x, tileBound.min.x, ratio.x, offset.x, Horizontal, supportRanges, weights );
-
-		V2i oP; // output pixel position
-
-		for( oP.y = tileBound.min.y; oP.y < tileBound.max.y; ++oP.y )
+		// Pixels in the same column share the same support ranges and filter weights,
+		// as do all tiles in the same tile column.
+		ConstFilterWeightsDataPtr filterWeights;
 		{
-			Canceller::check( context->canceller() );
+			ImagePlug::ChannelDataScope filterWeightsScope( context );
+			filterWeightsScope.remove( ImagePlug::channelNameContextName );
+			const V2i filterWeightsOrigin( tileOrigin.x, 0 );
+			filterWeightsScope.setTileOrigin( &filterWeightsOrigin );
+			filterWeights = boost::static_pointer_cast<const FilterWeightsData>( horizontalFilterWeightsPlug()->getValue() );
+		}
 
-			std::vector<int>::const_iterator supportIt = supportRanges.begin();
-			std::vector<float>::const_iterator wIt = weights.begin();
-			for( oP.x = tileBound.min.x; oP.x < tileBound.max.x; ++oP.x )
+		// Gather the input into a buffer with each column stored contiguously, so that
+		// we can filter all rows of the tile at once, in an inner loop which vectorises.
+		// Each pixel still accumulates its weighted inputs in the same order, so the
+		// result is identical to filtering one pixel at a time.
+
+		const int tileSize = ImagePlug::tileSize();
+		std::vector<float> columns( ir.size().x * tileSize );
+		sampler.visitPixels(
+			ir,
+			[&columns, &ir, &tileSize]( float cur, int x, int y )
 			{
-				float v = 0.0f;
-				float totalW = 0.0f;
+				columns[( x - ir.min.x ) * tileSize + y - ir.min.y] = cur;
+			}
+		);
 
-				sampler.visitPixels( Imath::Box2i(
-						Imath::V2i( *supportIt, oP.y ),
-						Imath::V2i( *( supportIt + 1 ), oP.y + 1 )
-					),
-					[&wIt, &v, &totalW]( float cur, int x, int y )
-					{
-						const float w = *wIt++;
-						v += w * cur;
-						totalW += w;
-					}
-				);
+		std::vector<float> v( tileSize );
+		std::vector<int>::const_iterator supportIt = filterWeights->supportRanges.begin();
+		std::vector<float>::const_iterator wIt = filterWeights->weights.begin();
+		std::vector<float>::const_iterator totalIt = filterWeights->totals.begin();
 
-				supportIt += 2;
+		for( int x = 0; x < tileSize; ++x )
+		{
+			Canceller::check( context->canceller() );
 
-				if( totalW != 0.0f )
+			std::fill( v.begin(), v.end(), 0.0f );
+			for( int iX = *supportIt; iX < *( supportIt + 1 ); ++iX )
+			{
+				const float w = *wIt++;
+				const float *column = &columns[( iX - ir.min.x ) * tileSize];
+				for( int y = 0; y < tileSize; ++y )
 				{
-					*pIt = v / totalW;
+					v[y] += w * column[y];
 				}
+			}
 
-				++pIt;
+			if( *totalIt != 0.0f )
+			{
+				for( int y = 0; y < tileSize; ++y )
+				{
+					result[y * tileSize + x] = v[y] / *totalIt;
+				}
 			}
+
+			supportIt += 2;
+			++totalIt;
 		}
 	}
 	else if( passes == Vertical )
 	{
-		V2i oP; // output pixel position
+		// Pixels in the same row share the same support ranges and filter weights,
+		// as do all tiles in the same tile row.
+		ConstFilterWeightsDataPtr filterWeights;
+		{
+			ImagePlug::ChannelDataScope filterWeightsScope( context );
+			filterWeightsScope.remove( ImagePlug::channelNameContextName );
+			const V2i filterWeightsOrigin( 0, tileOrigin.y );
+			filterWeightsScope.setTileOrigin( &filterWeightsOrigin );
+			filterWeights = boost::static_pointer_cast<const FilterWeightsData>( verticalFilterWeightsPlug()->getValue() );
+		}
 
-		// Pixels in the same row share the same support ranges and filter weights, so
-		// we precompute the weights now to avoid repeating work later.
-		std::vector<int> supportRanges;
-		std::vector<float> weights;
-		filterWeights1D( filter, inputFilterScale.y, filterRadius.y, tileBound.min.y, ratio.y, offset.y, Vertical, supportRanges, weights );
+		// Gather the input into a buffer of contiguous rows, so that we can filter
+		// a whole row of the tile at once, as for the horizontal pass above.
 
-		std::vector<int>::const_iterator supportIt = supportRanges.begin();
-		std::vector<float>::const_iterator rowWeightsIt = weights.begin();
+		const int tileSize = ImagePlug::tileSize();
+		const Private::RegionBuffer rows( horizontalPassPlug(), channelName, ir, boundingMode );
 
-		for( oP.y = tileBound.min.y; oP.y < tileBound.max.y; ++oP.y )
+		std::vector<float> v( tileSize );
+		std::vector<int>::const_iterator supportIt = filterWeights->supportRanges.begin();
+		std::vector<float>::const_iterator wIt = filterWeights->weights.begin();
+		std::vector<float>::const_iterator totalIt = filterWeights->totals.begin();
+
+		for( int y = 0; y < tileSize; ++y )
 		{
 			Canceller::check( context->canceller() );
 
-			for( oP.x = tileBound.min.x; oP.x < tileBound.max.x; ++oP.x )
+			std::fill( v.begin(), v.end(), 0.0f );
+			for( int iY = *supportIt; iY < *( supportIt + 1 ); ++iY )
 			{
-				float v = 0.0f;
-				float totalW = 0.0f;
-
-				std::vector<float>::const_iterator wIt = rowWeightsIt;
-
-				sampler.visitPixels( Imath::Box2i(
-						Imath::V2i( oP.x, *supportIt ),
-						Imath::V2i( oP.x + 1, *(supportIt + 1) )
-					),
-					[&wIt, &v, &totalW]( float cur, int x, int y )
-					{
-						const float w = *wIt++;
-						v += w * cur;
-						totalW += w;
-					}
-				);
-
-
-				if( totalW != 0.0f )
+				const float w = *wIt++;
+				const float *row = rows.row( iY );
+				for( int x = 0; x < tileSize; ++x )
 				{
-					*pIt = v / totalW;
+					v[x] += w * row[x];
 				}
+			}
 
-				++pIt;
+			if( *totalIt != 0.0f )
+			{
+				for( int x = 0; x < tileSize; ++x )
+				{
+					result[y * tileSize + x] = v[x] / *totalIt;
+				}
 			}
 
-			rowWeightsIt += (*(supportIt + 1)) - (*supportIt);
 			supportIt += 2;
+			++totalIt;
 		}
 	}
 
@@ -38,6 +38,8 @@
 
 #include "GafferImage/ImageAlgo.h"
 
+#include <limits>
+
 using namespace IECore;
 using namespace Imath;
 using namespace Gaffer;
@@ -129,6 +131,83 @@ void Sampler::populate()
 	);
 }
 
+void Sampler::sample( const Imath::V2f *positions, size_t count, float *result )
+{
+	constexpr size_t batchSize = 64;
+	int xi[batchSize];
+	int yi[batchSize];
+	float xf[batchSize];
+	float yf[batchSize];
+	float v00[batchSize];
+	float v10[batchSize];
+	float v01[batchSize];
+	float v11[batchSize];
+
+	constexpr int tileLowMask = ImagePlug::tileSize() - 1;
+
+	// Consecutive positions usually fall within the same tile,
+	// so we keep the most recent one to avoid the lookup in
+	// `cachedData()`.
+	V2i currentTileOrigin( std::numeric_limits<int>::min() );
+	const float *currentTile = nullptr;
+
+	for( size_t begin = 0; begin < count; begin += batchSize )
+	{
+		const size_t n = std::min( batchSize, count - begin );
+		const V2f *p = positions + begin;
+
+		// Split into integer and fractional parts, exactly as
+		// `sample( float, float )` does.
+		for( size_t i = 0; i < n; ++i )
+		{
+			xf[i] = OIIO::floorfrac( p[i].x - 0.5, &xi[i] );
+			yf[i] = OIIO::floorfrac( p[i].y - 0.5, &yi[i] );
+		}
+
+		// Fetch the four pixels surrounding each position.
+		for( size_t i = 0; i < n; ++i )
+		{
+			const int x = xi[i];
+			const int y = yi[i];
+			if(
+				( x & tileLowMask ) != tileLowMask &&
+				( y & tileLowMask ) != tileLowMask &&
+				x >= m_dataWindow.min.x && x < m_dataWindow.max.x - 1 &&
+				y >= m_dataWindow.min.y && y < m_dataWindow.max.y - 1
+			)
+			{
+				// All four pixels are in the same tile, and inside the
+				// data window.
+				const V2i tileOrigin( x & ~tileLowMask, y & ~tileLowMask );
+				if( tileOrigin != currentTileOrigin )
+				{
+					int tilePixelIndex;
+					cachedData( tileOrigin, currentTile, tilePixelIndex );
+					currentTileOrigin = tileOrigin;
+				}
+				const float *t = currentTile + ( x & tileLowMask ) + ( ( y & tileLowMask ) << ImagePlug::tileSizeLog2() );
+				v00[i] = t[0];
+				v10[i] = t[1];
+				v01[i] = t[ImagePlug::tileSize()];
+				v11[i] = t[ImagePlug::tileSize() + 1];
+			}
+			else
+			{
+				v00[i] = sample( x, y );
+				v10[i] = sample( x + 1, y );
+				v01[i] = sample( x, y + 1 );
+				v11[i] = sample( x + 1, y + 1 );
+			}
+		}
+
+		// Interpolate.
+		for( size_t i = 0; i < n; ++i )
+		{
+			result[begin + i] = OIIO::bilerp( v00[i], v10[i], v01[i], v11[i], xf[i], yf[i] );
+		}
+	}
+}
+
 void Sampler::hash( IECore::MurmurHash &h ) const
 {
 	for ( int x = m_cacheWindow.min.x; x < m_cacheWindow.max.x; x += GafferImage::ImagePlug::tileSize() )
@@ -137,4 +137,34 @@ void Unpremultiply::processChannelData( const Gaffer::Context *context, const Im
 	}
 }
 
+bool Unpremultiply::processesConstantTiles( const Gaffer::Context *context, const std::string &channel ) const
+{
+	std::string alphaChannel;
+	ConstStringVectorDataPtr inChannelNamesPtr;
+	{
+		ImagePlug::GlobalScope c( context );
+		alphaChannel = alphaChannelPlug()->getValue();
+		inChannelNamesPtr = inPlug()->channelNamesPlug()->getValue();
+	}
+
+	if( channel == alphaChannel )
+	{
+		return true;
+	}
+
+	const std::vector<std::string> &inChannelNames = inChannelNamesPtr->readable();
+	if( std::find( inChannelNames.begin(), inChannelNames.end(), alphaChannel ) == inChannelNames.end() )
+	{
+		// Leave processChannelData() to report the error.
+		return false;
+	}
+
+	// Uniform if dividing by uniform alpha.
+	ImagePlug::ChannelDataScope channelDataScope( context );
+	channelDataScope.setChannelName( &alphaChannel );
+	ConstFloatVectorDataPtr aData = inPlug()->channelDataPlug()->getValue();
+	float alpha;
+	return ImagePlug::isConstantTile( aData.get(), alpha );
+}
+
 } // namespace GafferImage
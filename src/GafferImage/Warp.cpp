@@ -37,6 +37,7 @@
 #include "GafferImage/Warp.h"
 
 #include "GafferImage/FilterAlgo.h"
+#include "GafferImage/Private/RegionBuffer.h"
 #include "GafferImage/Sampler.h"
 
 #include "Gaffer/Context.h"
@@ -72,6 +73,23 @@ namespace
 		}
 	}
 
+	// Returns true if we should gather `tileInputBound` into a RegionBuffer
+	// rather than sample it via a Sampler. The RegionBuffer is much quicker
+	// to sample from, but must fetch every pixel in the bound, whereas the
+	// Sampler only fetches tiles as they are needed. Tiles of the output
+	// typically sample a bound not much larger than the tile itself, but
+	// for extreme distortions the samples may be sparsely scattered over a
+	// far larger area.
+	bool useRegionBuffer( const Box2i &tileInputBound )
+	{
+		if( BufferAlgo::empty( tileInputBound ) )
+		{
+			return false;
+		}
+		const V2i size = tileInputBound.size();
+		return (int64_t)size.x * size.y <= 16 * ImagePlug::tileSize() * ImagePlug::tileSize();
+	}
+
 	ConstObjectPtr computeEngineIfTileValid( ImagePlug::ChannelDataScope &tileScope, const ObjectPlug *plug, const Box2i &dataWindow, const V2i &tileOrigin )
 	{
 		if( BufferAlgo::intersects( dataWindow, Box2i( tileOrigin, tileOrigin + V2i( ImagePlug::tileSize() ) ) ) )
@@ -589,6 +607,14 @@ void Warp::compute( Gaffer::ValuePlug *output, const Gaffer::Context *context )
 			V2i( (int)ceilf( inputBound.min.x - 0.5 ), (int)ceilf( inputBound.min.y - 0.5 ) ),
 			V2i( (int)floorf( inputBound.max.x - 0.5 ) + 1, (int)floorf( inputBound.max.y - 0.5 ) + 1 ) );
 
+		if( !filter && !BufferAlgo::empty( inputPixelBound ) )
+		{
+			// Bilinear interpolation reads the pixels either side of the
+			// input position, which may be outside the filter support.
+			inputPixelBound.min -= V2i( 1 );
+			inputPixelBound.max += V2i( 1 );
+		}
+
 		CompoundObjectPtr sampleRegions = new CompoundObject();
 		sampleRegions->members()[ g_tileInputBoundName ] = new Box2iData( inputPixelBound );
 		sampleRegions->members()[ g_pixelInputPositionsName ] = pixelInputPositionsData;
@@ -677,38 +703,73 @@ IECore::ConstFloatVectorDataPtr Warp::computeChannelData( const std::string &cha
 
 	const Box2i validPixelsRelativeToTile( dataWindow.min - tileOrigin, dataWindow.max - tileOrigin );
 
-	Sampler sampler(
-		inPlug(),
-		channelName,
-		tileInputBound,
-		(Sampler::BoundingMode)boundingModePlug()->getValue()
-	);
+	auto warp = [&] ( auto &sampler ) {
 
-	std::vector<float> scratchMemory;
-	int i = 0;
-	V2i oP;
-	for( oP.y = 0; oP.y < ImagePlug::tileSize(); ++oP.y )
-	{
-		for( oP.x = 0; oP.x < ImagePlug::tileSize(); ++oP.x, ++i )
+		if( !filter )
 		{
-			float v = 0;
-			if( BufferAlgo::contains( validPixelsRelativeToTile , oP ) )
+			// Gather all the positions to be sampled, so that the
+			// sampler can process them as a batch.
+			std::vector<V2f> positions;
+			std::vector<int> indices;
+			positions.reserve( ImagePlug::tilePixels() );
+			indices.reserve( ImagePlug::tilePixels() );
+
+			int i = 0;
+			V2i oP;
+			for( oP.y = 0; oP.y < ImagePlug::tileSize(); ++oP.y )
 			{
-				const V2f &input = pixelInputPositions[i];
-				if( input != Engine::black )
+				for( oP.x = 0; oP.x < ImagePlug::tileSize(); ++oP.x, ++i )
 				{
-					if( filter )
+					if( BufferAlgo::contains( validPixelsRelativeToTile , oP ) && pixelInputPositions[i] != Engine::black )
 					{
-						v = FilterAlgo::sampleBox( sampler, input, pixelInputDerivatives[i].x, pixelInputDerivatives[i].y, filter, scratchMemory );
+						positions.push_back( pixelInputPositions[i] );
+						indices.push_back( i );
 					}
-					else
+				}
+			}
+
+			std::vector<float> values( positions.size() );
+			sampler.sample( positions.data(), positions.size(), values.data() );
+
+			result.resize( ImagePlug::tilePixels(), 0.0f );
+			for( size_t j = 0; j < indices.size(); ++j )
+			{
+				result[indices[j]] = values[j];
+			}
+			return;
+		}
+
+		std::vector<float> scratchMemory;
+		int i = 0;
+		V2i oP;
+		for( oP.y = 0; oP.y < ImagePlug::tileSize(); ++oP.y )
+		{
+			for( oP.x = 0; oP.x < ImagePlug::tileSize(); ++oP.x, ++i )
+			{
+				float v = 0;
+				if( BufferAlgo::contains( validPixelsRelativeToTile , oP ) )
+				{
+					const V2f &input = pixelInputPositions[i];
+					if( input != Engine::black )
 					{
-						v = sampler.sample( input.x, input.y );
+						v = FilterAlgo::sampleBox( sampler, input, pixelInputDerivatives[i].x, pixelInputDerivatives[i].y, filter, scratchMemory );
 					}
 				}
+				result.push_back( v );
 			}
-			result.push_back( v );
 		}
+	};
+
+	const Sampler::BoundingMode boundingMode = (Sampler::BoundingMode)boundingModePlug()->getValue();
+	if( useRegionBuffer( tileInputBound ) )
+	{
+		const Private::RegionBuffer regionBuffer( inPlug(), channelName, tileInputBound, boundingMode );
+		warp( regionBuffer );
+	}
+	else
+	{
+		Sampler sampler( inPlug(), channelName, tileInputBound, boundingMode );
+		warp( sampler );
 	}
 
 
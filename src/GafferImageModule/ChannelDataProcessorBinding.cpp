@@ -51,7 +51,12 @@ using namespace GafferImage;
 void GafferImageModule::bindChannelDataProcessor()
 {
 
-	DependencyNodeClass<ChannelDataProcessor>();
+	DependencyNodeClass<ChannelDataProcessor>()
+		.def( "setFusionEnabled", &ChannelDataProcessor::setFusionEnabled )
+		.staticmethod( "setFusionEnabled" )
+		.def( "getFusionEnabled", &ChannelDataProcessor::getFusionEnabled )
+		.staticmethod( "getFusionEnabled" )
+	;
 	DependencyNodeClass<Grade>();
 	DependencyNodeClass<Clamp>();
 	DependencyNodeClass<Premultiply>();
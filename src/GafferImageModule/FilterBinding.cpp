@@ -50,7 +50,15 @@ using namespace GafferImage;
 
 void GafferImageModule::bindFilters()
 {
-	DependencyNodeClass<Blur>();
+	{
+		scope s = DependencyNodeClass<Blur>();
+
+		enum_<Blur::Method>( "Method" )
+			.value( "Accurate", Blur::Method::Accurate )
+			.value( "Fast", Blur::Method::Fast )
+		;
+	}
+
 	DependencyNodeClass<RankFilter>( nullptr, no_init );
 	DependencyNodeClass<Median>();
 	DependencyNodeClass<Dilate>();
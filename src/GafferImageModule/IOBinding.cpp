@@ -134,6 +134,26 @@ void GafferImageModule::bindIO()
 			.staticmethod( "setOpenFilesLimit" )
 			.def( "getOpenFilesLimit", &OpenImageIOReader::getOpenFilesLimit )
 			.staticmethod( "getOpenFilesLimit" )
+			.def( "setOpenFilesEvictionPolicy", &OpenImageIOReader::setOpenFilesEvictionPolicy )
+			.staticmethod( "setOpenFilesEvictionPolicy" )
+			.def( "getOpenFilesEvictionPolicy", &OpenImageIOReader::getOpenFilesEvictionPolicy )
+			.staticmethod( "getOpenFilesEvictionPolicy" )
+			.def( "setIOThreads", &OpenImageIOReader::setIOThreads )
+			.staticmethod( "setIOThreads" )
+			.def( "getIOThreads", &OpenImageIOReader::getIOThreads )
+			.staticmethod( "getIOThreads" )
+			.def( "setMemoryMappingEnabled", &OpenImageIOReader::setMemoryMappingEnabled )
+			.staticmethod( "setMemoryMappingEnabled" )
+			.def( "getMemoryMappingEnabled", &OpenImageIOReader::getMemoryMappingEnabled )
+			.staticmethod( "getMemoryMappingEnabled" )
+			.def( "setHalfTileStorageEnabled", &OpenImageIOReader::setHalfTileStorageEnabled )
+			.staticmethod( "setHalfTileStorageEnabled" )
+			.def( "getHalfTileStorageEnabled", &OpenImageIOReader::getHalfTileStorageEnabled )
+			.staticmethod( "getHalfTileStorageEnabled" )
+			.def( "ioQueueDepth", &OpenImageIOReader::ioQueueDepth )
+			.staticmethod( "ioQueueDepth" )
+			.def( "ioBytesInFlight", &OpenImageIOReader::ioBytesInFlight )
+			.staticmethod( "ioBytesInFlight" )
 			.def( "supportedExtensions", &supportedExtensions<OpenImageIOReader> )
 			.staticmethod( "supportedExtensions" )
 		;
@@ -145,7 +145,7 @@ void parallelGatherTiles1( const GafferImage::ImagePlug &image, object pythonTil
 	);
 }
 
-void parallelGatherTiles2( const GafferImage::ImagePlug &image, object pythonChannelNames, object pythonTileFunctor, object pythonGatherFunctor, const Imath::Box2i &window, ImageAlgo::TileOrder tileOrder )
+void parallelGatherTiles2( const GafferImage::ImagePlug &image, object pythonChannelNames, object pythonTileFunctor, object pythonGatherFunctor, const Imath::Box2i &window, ImageAlgo::TileOrder tileOrder, bool prefetchChannelData )
 {
 	vector<string> channelNames;
 	boost::python::container_utils::extend_container( channelNames, pythonChannelNames );
@@ -169,7 +169,8 @@ void parallelGatherTiles2( const GafferImage::ImagePlug &image, object pythonCha
 		},
 
 		window,
-		tileOrder
+		tileOrder,
+		prefetchChannelData
 
 	);
 }
@@ -239,10 +240,14 @@ void GafferImageModule::bindImageAlgo()
 			boost::python::arg( "tileFunctor" ),
 			boost::python::arg( "gatherFunctor" ),
 			boost::python::arg( "window" ) = Imath::Box2i(),
-			boost::python::arg( "tileOrder" ) = ImageAlgo::Unordered
+			boost::python::arg( "tileOrder" ) = ImageAlgo::Unordered,
+			boost::python::arg( "prefetchChannelData" ) = false
 		)
 	);
 
+	def( "setTilePrefetchRows", &ImageAlgo::setTilePrefetchRows );
+	def( "getTilePrefetchRows", &ImageAlgo::getTilePrefetchRows );
+
 	def( "image", &imageWrapper, ( boost::python::arg( "viewName" ) = object() ) );
 	def( "imageHash", &imageHashWrapper, ( boost::python::arg( "viewName" ) = object() ) );
 	def( "tiles", &tilesWrapper, ( boost::python::arg( "_copy" ) = true, boost::python::arg( "viewName" ) = object() ) );
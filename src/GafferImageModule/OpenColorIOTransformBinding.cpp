@@ -88,12 +88,24 @@ void GafferImageModule::bindOpenColorIOTransform()
 	GafferBindings::DependencyNodeClass<Saturation>();
 
 	{
-		scope s = GafferBindings::DependencyNodeClass<OpenColorIOTransform>();
+		scope s = GafferBindings::DependencyNodeClass<OpenColorIOTransform>()
+			.def( "setOptimization", &OpenColorIOTransform::setOptimization )
+			.staticmethod( "setOptimization" )
+			.def( "getOptimization", &OpenColorIOTransform::getOptimization )
+			.staticmethod( "getOptimization" )
+		;
 
 		enum_<OpenColorIOTransform::Direction>( "Direction" )
 			.value( "Forward", OpenColorIOTransform::Forward )
 			.value( "Inverse", OpenColorIOTransform::Inverse )
 		;
+
+		enum_<OpenColorIOTransform::Optimization>( "Optimization" )
+			.value( "Lossless", OpenColorIOTransform::Optimization::Lossless )
+			.value( "Default", OpenColorIOTransform::Optimization::Default )
+			.value( "Good", OpenColorIOTransform::Optimization::Good )
+			.value( "Draft", OpenColorIOTransform::Optimization::Draft )
+		;
 	}
 
 	GafferBindings::DependencyNodeClass<ColorSpace>();
@@ -45,12 +45,19 @@
 #include "GafferImage/ImagePlug.h"
 #include "GafferImage/Format.h"
 #include "GafferImage/Sampler.h"
+#include "GafferImage/Private/MergeKernels.h"
 
 #include "Gaffer/Node.h"
 
 #include "IECorePython/RefCountedBinding.h"
 #include "IECorePython/ScopedGILRelease.h"
 
+#include "IECore/VectorTypedData.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
 using namespace boost::python;
 using namespace boost::placeholders;
 using namespace Gaffer;
@@ -158,6 +165,121 @@ void validateVisitPixels( GafferImage::Sampler &sampler, const Imath::Box2i &reg
 	}
 }
 
+void validateBatchSample( GafferImage::Sampler &sampler, const IECore::V2fVectorData *positionsData )
+{
+	const std::vector<Imath::V2f> &positions = positionsData->readable();
+	std::vector<float> result( positions.size() );
+	sampler.sample( positions.data(), positions.size(), result.data() );
+
+	for( size_t i = 0; i < positions.size(); ++i )
+	{
+		const float expectedValue = sampler.sample( positions[i].x, positions[i].y );
+		if( result[i] != expectedValue && !( std::isnan( result[i] ) && std::isnan( expectedValue ) ) )
+		{
+			throw IECore::Exception( fmt::format(
+				"Batch sample returned incorrect value for position {},{} - expected {} received {}",
+				positions[i].x, positions[i].y, expectedValue, result[i]
+			) );
+		}
+	}
+}
+
+bool identicalMergeResults( float a, float b )
+{
+	// NaN payloads are not significant, but everything else must match
+	// bit for bit, including the sign of zero.
+	return ( std::isnan( a ) && std::isnan( b ) ) || std::memcmp( &a, &b, sizeof( float ) ) == 0;
+}
+
+void testMergeKernels()
+{
+	const float inf = std::numeric_limits<float>::infinity();
+	const float nan = std::numeric_limits<float>::quiet_NaN();
+	const std::vector<float> edgeValues = {
+		0.0f, -0.0f, 1.0f, -1.0f, 0.5f, 0.25f, 2.0f, 3.7f,
+		std::numeric_limits<float>::denorm_min(), std::numeric_limits<float>::min(),
+		std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest(),
+		inf, -inf, nan, -nan
+	};
+
+	// Inputs covering every pair of edge values for colour and alpha, with
+	// the pairs arranged differently in each so that colour/alpha pairs vary
+	// too.
+	const size_t numValues = edgeValues.size();
+	const size_t size = numValues * numValues * 4;
+	std::vector<float> A( size ), B( size ), a( size ), b( size );
+	for( size_t i = 0; i < size; ++i )
+	{
+		A[i] = edgeValues[i % numValues];
+		B[i] = edgeValues[( i / numValues ) % numValues];
+		a[i] = edgeValues[( i / 3 ) % numValues];
+		b[i] = edgeValues[( i / 7 ) % numValues];
+	}
+
+	// Spans of every length up to and beyond the widest vector, starting at
+	// a variety of alignments, plus one long span.
+	std::vector<std::pair<int, int>> spans = { { 0, (int)size } };
+	for( int begin = 0; begin < 4; ++begin )
+	{
+		for( int length = 0; length <= 40; ++length )
+		{
+			spans.push_back( { begin, length } );
+		}
+	}
+
+	const std::vector<Private::MergeInstructionSet> instructionSets = Private::mergeInstructionSets();
+	std::vector<float> expectedR( size ), expectedr( size ), R( size ), r( size );
+
+	for( int operation = Merge::Add; operation <= Merge::Max; ++operation )
+	{
+		for( int inputs = 1; inputs < 4; ++inputs )
+		{
+			const bool hasA = inputs & 1;
+			const bool hasB = inputs & 2;
+			for( const auto &[begin, length] : spans )
+			{
+				Private::mergeSpan(
+					(Merge::Operation)operation, Private::MergeInstructionSet::Scalar,
+					hasA ? A.data() + begin : nullptr, hasB ? B.data() + begin : nullptr,
+					hasA ? a.data() + begin : nullptr, hasB ? b.data() + begin : nullptr,
+					expectedR.data(), expectedr.data(), length
+				);
+
+				for( auto instructionSet : instructionSets )
+				{
+					// Fill the outputs with a sentinel so we can check that
+					// nothing is written beyond the end of the span.
+					std::fill( R.begin(), R.end(), 12345.0f );
+					std::fill( r.begin(), r.end(), 12345.0f );
+					Private::mergeSpan(
+						(Merge::Operation)operation, instructionSet,
+						hasA ? A.data() + begin : nullptr, hasB ? B.data() + begin : nullptr,
+						hasA ? a.data() + begin : nullptr, hasB ? b.data() + begin : nullptr,
+						R.data(), r.data(), length
+					);
+
+					for( int i = 0; i < (int)size; ++i )
+					{
+						const bool inSpan = i < length;
+						if(
+							!identicalMergeResults( R[i], inSpan ? expectedR[i] : 12345.0f ) ||
+							!identicalMergeResults( r[i], inSpan ? expectedr[i] : 12345.0f )
+						)
+						{
+							throw IECore::Exception( fmt::format(
+								"Merge kernel {} for operation {} (hasA {}, hasB {}) differs from scalar at index {} of span {},{} : "
+								"expected {},{} received {},{}",
+								(int)instructionSet, operation, hasA, hasB, i, begin, length,
+								inSpan ? expectedR[i] : 12345.0f, inSpan ? expectedr[i] : 12345.0f, R[i], r[i]
+							) );
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
 } // namespace
 
 BOOST_PYTHON_MODULE( _GafferImageTest )
@@ -170,4 +292,6 @@ BOOST_PYTHON_MODULE( _GafferImageTest )
 	def( "connectProcessTilesToPlugDirtiedSignal", &connectProcessTilesToPlugDirtiedSignal );
 	def( "testEditableScopeForFormat", &testEditableScopeForFormat );
 	def( "validateVisitPixels", &validateVisitPixels );
+	def( "validateBatchSample", &validateBatchSample );
+	def( "testMergeKernels", &testMergeKernels );
 }
@@ -45,6 +45,7 @@
 #include "Gaffer/PerformanceMonitor.h"
 #include "Gaffer/Plug.h"
 #include "Gaffer/ThreadMonitor.h"
+#include "Gaffer/TraceMonitor.h"
 #include "Gaffer/VTuneMonitor.h"
 
 #include "IECorePython/RefCountedBinding.h"
@@ -64,8 +65,10 @@ namespace
 std::string repr( PerformanceMonitor::Statistics &s )
 {
 	return fmt::format(
-		"Gaffer.PerformanceMonitor.Statistics( hashCount = {}, computeCount = {}, hashDuration = {}, computeDuration = {} )",
-			s.hashCount, s.computeCount, s.hashDuration.count(), s.computeDuration.count()
+		"Gaffer.PerformanceMonitor.Statistics( hashCount = {}, computeCount = {}, hashDuration = {}, computeDuration = {}, "
+		"diskCacheHits = {}, diskCacheMisses = {}, diskCacheBytesRead = {}, diskCacheBytesWritten = {} )",
+			s.hashCount, s.computeCount, s.hashDuration.count(), s.computeDuration.count(),
+			s.diskCacheHits, s.diskCacheMisses, s.diskCacheBytesRead, s.diskCacheBytesWritten
 	);
 }
 
@@ -73,10 +76,17 @@ PerformanceMonitor::Statistics *statisticsConstructor(
 	size_t hashCount,
 	size_t computeCount,
 	boost::chrono::nanoseconds::rep hashDuration,
-	boost::chrono::nanoseconds::rep computeDuration
+	boost::chrono::nanoseconds::rep computeDuration,
+	size_t diskCacheHits,
+	size_t diskCacheMisses,
+	size_t diskCacheBytesRead,
+	size_t diskCacheBytesWritten
 )
 {
-	return new PerformanceMonitor::Statistics( hashCount, computeCount, boost::chrono::nanoseconds( hashDuration ), boost::chrono::nanoseconds( computeDuration ) );
+	return new PerformanceMonitor::Statistics(
+		hashCount, computeCount, boost::chrono::nanoseconds( hashDuration ), boost::chrono::nanoseconds( computeDuration ),
+		diskCacheHits, diskCacheMisses, diskCacheBytesRead, diskCacheBytesWritten
+	);
 }
 
 boost::chrono::nanoseconds::rep getHashDuration( PerformanceMonitor::Statistics &s )
@@ -199,6 +209,12 @@ dict threadMonitorCombinedStatisticsWrapper( const ThreadMonitor &monitor )
 	return processesPerThreadToPython( monitor.combinedStatistics() );
 }
 
+void traceMonitorWriteTraceWrapper( const TraceMonitor &monitor, const std::string &fileName )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	monitor.writeTrace( fileName );
+}
+
 } // namespace
 
 void GafferModule::bindMonitor()
@@ -283,7 +299,11 @@ void GafferModule::bindMonitor()
 						arg( "hashCount" ) = 0,
 						arg( "computeCount" ) = 0,
 						arg( "hashDuration" ) = 0,
-						arg( "computeDuration" ) = 0
+						arg( "computeDuration" ) = 0,
+						arg( "diskCacheHits" ) = 0,
+						arg( "diskCacheMisses" ) = 0,
+						arg( "diskCacheBytesRead" ) = 0,
+						arg( "diskCacheBytesWritten" ) = 0
 					)
 				)
 			)
@@ -291,6 +311,10 @@ void GafferModule::bindMonitor()
 			.def_readwrite( "computeCount", &PerformanceMonitor::Statistics::computeCount )
 			.add_property( "hashDuration", &getHashDuration, &setHashDuration )
 			.add_property( "computeDuration", &getComputeDuration, &setComputeDuration )
+			.def_readwrite( "diskCacheHits", &PerformanceMonitor::Statistics::diskCacheHits )
+			.def_readwrite( "diskCacheMisses", &PerformanceMonitor::Statistics::diskCacheMisses )
+			.def_readwrite( "diskCacheBytesRead", &PerformanceMonitor::Statistics::diskCacheBytesRead )
+			.def_readwrite( "diskCacheBytesWritten", &PerformanceMonitor::Statistics::diskCacheBytesWritten )
 			.def( self == self )
 			.def( self != self )
 			.def( "__repr__", &repr )
@@ -332,6 +356,15 @@ void GafferModule::bindMonitor()
 		;
 	}
 
+	{
+		IECorePython::RefCountedClass<TraceMonitor, Monitor>( "TraceMonitor" )
+			.def( init<size_t>( arg( "maxEventsPerThread" ) = 100000 ) )
+			.def( "numEvents", &TraceMonitor::numEvents )
+			.def( "numDiscardedEvents", &TraceMonitor::numDiscardedEvents )
+			.def( "writeTrace", &traceMonitorWriteTraceWrapper, arg( "fileName" ) )
+		;
+	}
+
 #ifdef GAFFER_VTUNE
 	{
 		scope s = IECorePython::RefCountedClass<VTuneMonitor, Monitor>( "VTuneMonitor" )
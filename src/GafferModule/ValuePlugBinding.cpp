@@ -103,6 +103,15 @@ void hash2( ValuePlug *plug, IECore::MurmurHash &h )
 	plug->hash( h);
 }
 
+boost::python::list cachePartitions()
+{
+	boost::python::list result;
+	for( const auto &partition : ValuePlug::cachePartitions() )
+	{
+		result.append( partition.string() );
+	}
+	return result;
+}
 
 } // namespace
 
@@ -133,6 +142,34 @@ void GafferModule::bindValuePlug()
 		.staticmethod( "cacheMemoryUsage" )
 		.def( "clearCache", &ValuePlug::clearCache )
 		.staticmethod( "clearCache" )
+		.def( "setCachePartitionMemoryLimit", &ValuePlug::setCachePartitionMemoryLimit )
+		.staticmethod( "setCachePartitionMemoryLimit" )
+		.def( "getCachePartitionMemoryLimit", &ValuePlug::getCachePartitionMemoryLimit )
+		.staticmethod( "getCachePartitionMemoryLimit" )
+		.def( "cachePartitionMemoryUsage", &ValuePlug::cachePartitionMemoryUsage )
+		.staticmethod( "cachePartitionMemoryUsage" )
+		.def( "cachePartitions", &cachePartitions )
+		.staticmethod( "cachePartitions" )
+		.def( "setCacheEvictionPolicy", &ValuePlug::setCacheEvictionPolicy )
+		.staticmethod( "setCacheEvictionPolicy" )
+		.def( "getCacheEvictionPolicy", &ValuePlug::getCacheEvictionPolicy )
+		.staticmethod( "getCacheEvictionPolicy" )
+		.def( "setDiskCacheDirectory", &ValuePlug::setDiskCacheDirectory )
+		.staticmethod( "setDiskCacheDirectory" )
+		.def( "getDiskCacheDirectory", &ValuePlug::getDiskCacheDirectory )
+		.staticmethod( "getDiskCacheDirectory" )
+		.def( "setDiskCacheSizeLimit", &ValuePlug::setDiskCacheSizeLimit )
+		.staticmethod( "setDiskCacheSizeLimit" )
+		.def( "getDiskCacheSizeLimit", &ValuePlug::getDiskCacheSizeLimit )
+		.staticmethod( "getDiskCacheSizeLimit" )
+		.def( "setDiskCacheMinimumComputeTime", &ValuePlug::setDiskCacheMinimumComputeTime )
+		.staticmethod( "setDiskCacheMinimumComputeTime" )
+		.def( "getDiskCacheMinimumComputeTime", &ValuePlug::getDiskCacheMinimumComputeTime )
+		.staticmethod( "getDiskCacheMinimumComputeTime" )
+		.def( "diskCacheUsage", &ValuePlug::diskCacheUsage )
+		.staticmethod( "diskCacheUsage" )
+		.def( "clearDiskCache", &ValuePlug::clearDiskCache )
+		.staticmethod( "clearDiskCache" )
 		.def( "getHashCacheSizeLimit", &ValuePlug::getHashCacheSizeLimit )
 		.staticmethod( "getHashCacheSizeLimit" )
 		.def( "setHashCacheSizeLimit", &ValuePlug::setHashCacheSizeLimit )
@@ -155,6 +192,11 @@ void GafferModule::bindValuePlug()
 		.value( "Legacy", ValuePlug::HashCacheMode::Legacy )
 	;
 
+	enum_<ValuePlug::CacheEvictionPolicy>( "CacheEvictionPolicy" )
+		.value( "LRU", ValuePlug::CacheEvictionPolicy::LRU )
+		.value( "CostAware", ValuePlug::CacheEvictionPolicy::CostAware )
+	;
+
 	enum_<ValuePlug::CachePolicy>( "CachePolicy" )
 		.value( "Uncached", ValuePlug::CachePolicy::Uncached )
 		.value( "Standard", ValuePlug::CachePolicy::Standard )
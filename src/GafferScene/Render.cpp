@@ -372,19 +372,16 @@ void Render::executeInternal( bool flushCaches ) const
 	{
 		// Now we have generated the scene, flush Cortex and Gaffer caches to
 		// provide more memory to the renderer. We limit this to the `execute`
-		// and `dispatch` applications for two reasons :
-		//
-		// - In a GUI application, we don't want to clear the caches because
-		//   we'll probably benefit from using them again later.
-		// - In `execute` and `dispatch` we know we're not executing concurrently
-		//   with anything else, and can therefore pass `now = true` to
-		//   `clearHashCache()` safely.
+		// and `dispatch` applications, because in a GUI application we don't
+		// want to clear the caches - we'll probably benefit from using them
+		// again later.
 		auto *application = ancestor<ApplicationRoot>();
 		if( application && ( application->getName() == "execute" || application->getName() == "dispatch" ) )
 		{
+			// The hash cache isn't cleared, because it uses fixed-size
+			// storage, so clearing it wouldn't free any memory.
 			ObjectPool::defaultObjectPool()->clear();
 			ValuePlug::clearCache();
-			ValuePlug::clearHashCache( /* now = */ true );
 		}
 	}
 
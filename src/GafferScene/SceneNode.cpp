@@ -438,6 +438,24 @@ Gaffer::ValuePlug::CachePolicy SceneNode::computeCachePolicy( const Gaffer::Valu
 	return ComputeNode::computeCachePolicy( output );
 }
 
+IECore::InternedString SceneNode::computeCachePartition( const Gaffer::ValuePlug *output ) const
+{
+	// Objects typically account for the bulk of the memory used by a scene.
+	// We keep them apart from the other scene values, so that a large
+	// number of objects can't evict the lightweight values required to
+	// traverse the scene.
+	static const IECore::InternedString g_objectsPartition( "sceneObjects" );
+	static const IECore::InternedString g_partition( "scene" );
+	if( auto parent = output->parent<ScenePlug>() )
+	{
+		if( output == parent->objectPlug() )
+		{
+			return g_objectsPartition;
+		}
+	}
+	return g_partition;
+}
+
 IECore::MurmurHash SceneNode::hashOfTransformedChildBounds( const ScenePath &path, const ScenePlug *out, const IECore::InternedStringVectorData *childNamesData ) const
 {
 	ScenePlug::PathScope pathScope( Context::current(), &path );
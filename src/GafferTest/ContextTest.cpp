@@ -46,6 +46,7 @@
 
 #include "boost/lexical_cast.hpp"
 #include "tbb/parallel_for.h"
+#include <functional>
 #include <random>
 #include <unordered_set>
 
@@ -324,6 +325,48 @@ void GafferTest::testContextCopyPerformance( int numEntries, int entrySize )
 
 }
 
+void GafferTest::testEditableScopePerformance( int numEntries, int depth )
+{
+	ContextPtr baseContext = new Context();
+	for( int i = 0; i < numEntries; i++ )
+	{
+		baseContext->set( InternedString( i ), std::string( 10, 'x') );
+	}
+
+	Context::Scope baseScope( baseContext.get() );
+
+	// Mimics the nested scopes pushed and popped when computes call
+	// upstream computes, with each scope editing a single variable and
+	// hashing the result, as is done by ValuePlug's HashCacheKey.
+	std::vector<InternedString> names;
+	for( int i = 0; i < depth; i++ )
+	{
+		names.push_back( "scope" + std::to_string( i ) );
+	}
+
+	std::function<void ( int, int )> push = [&names, &push]( int level, int value ) {
+		if( level == (int)names.size() )
+		{
+			return;
+		}
+		Context::EditableScope scope( ThreadState::current() );
+		scope.set( names[level], &value );
+		scope.context()->hash();
+		push( level + 1, value );
+	};
+
+	tbb::parallel_for(
+		tbb::blocked_range<int>( 0, 1000000 ),
+		[&push]( const tbb::blocked_range<int> &r )
+		{
+			for( int i = r.begin(); i != r.end(); ++i )
+			{
+				push( 0, i );
+			}
+		}
+	);
+}
+
 void GafferTest::testCopyEditableScope()
 {
 	ContextPtr copy;
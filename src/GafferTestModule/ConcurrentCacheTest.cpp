@@ -0,0 +1,411 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "boost/python.hpp"
+
+#include "ConcurrentCacheTest.h"
+
+#include "GafferTest/Assert.h"
+
+#include "Gaffer/Private/ConcurrentCache.h"
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
+
+#include "IECorePython/ScopedGILRelease.h"
+
+#include "IECore/MurmurHash.h"
+
+#include "tbb/enumerable_thread_specific.h"
+#include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+using namespace Gaffer::Private;
+using namespace boost::python;
+
+namespace
+{
+
+void testConcurrentCache()
+{
+	using Cache = ConcurrentCache<IECore::MurmurHash, IECore::MurmurHash>;
+	Cache cache( 1000 );
+	GAFFERTEST_ASSERTEQUAL( cache.getMaxCost(), 1000 );
+	GAFFERTEST_ASSERTEQUAL( cache.currentCost(), 0 );
+
+	const IECore::MurmurHash key = IECore::MurmurHash().append( 1 );
+	const IECore::MurmurHash value = IECore::MurmurHash().append( 2 );
+
+	GAFFERTEST_ASSERT( !cache.getIfCached( key ) );
+	GAFFERTEST_ASSERT( cache.setIfUncached( key, value ) );
+	GAFFERTEST_ASSERT( !cache.setIfUncached( key, IECore::MurmurHash() ) );
+	GAFFERTEST_ASSERT( *cache.getIfCached( key ) == value );
+	GAFFERTEST_ASSERTEQUAL( cache.currentCost(), 1 );
+
+	cache.clear();
+	GAFFERTEST_ASSERT( !cache.getIfCached( key ) );
+	GAFFERTEST_ASSERTEQUAL( cache.currentCost(), 0 );
+	GAFFERTEST_ASSERT( cache.setIfUncached( key, value ) );
+	GAFFERTEST_ASSERT( *cache.getIfCached( key ) == value );
+
+	// Overfilling the cache should keep the number of entries bounded
+	// by the capacity, which is rounded up to the next power of two.
+
+	for( int i = 0; i < 100000; ++i )
+	{
+		const IECore::MurmurHash h = IECore::MurmurHash().append( i );
+		cache.setIfUncached( h, h );
+	}
+	GAFFERTEST_ASSERT( cache.currentCost() <= 1024 );
+	GAFFERTEST_ASSERT( cache.currentCost() > 500 );
+
+	// Resizing discards everything.
+
+	cache.setMaxCost( 10000 );
+	GAFFERTEST_ASSERTEQUAL( cache.getMaxCost(), 10000 );
+	GAFFERTEST_ASSERTEQUAL( cache.currentCost(), 0 );
+
+	// And a size of zero disables caching.
+
+	cache.setMaxCost( 0 );
+	GAFFERTEST_ASSERT( !cache.setIfUncached( key, value ) );
+	GAFFERTEST_ASSERT( !cache.getIfCached( key ) );
+	GAFFERTEST_ASSERTEQUAL( cache.currentCost(), 0 );
+}
+
+void testConcurrentCacheConcurrency( int numIterations, int numValues, int maxCost, int clearFrequency, int resizeFrequency )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+
+	using Cache = ConcurrentCache<IECore::MurmurHash, IECore::MurmurHash>;
+	Cache cache( maxCost );
+
+	// Values are derived from the keys, so we can detect any torn reads
+	// caused by concurrent writes.
+	auto valueForKey = [] ( const IECore::MurmurHash &key ) {
+		return IECore::MurmurHash( key ).append( "value" );
+	};
+
+	tbb::parallel_for(
+		tbb::blocked_range<int>( 0, numIterations ),
+		[&]( const tbb::blocked_range<int> &r ) {
+			for( int i = r.begin(); i != r.end(); ++i )
+			{
+				const IECore::MurmurHash key = IECore::MurmurHash().append( i % numValues );
+				if( auto value = cache.getIfCached( key ) )
+				{
+					GAFFERTEST_ASSERT( *value == valueForKey( key ) );
+				}
+				else
+				{
+					cache.setIfUncached( key, valueForKey( key ) );
+				}
+
+				if( clearFrequency && ( i % clearFrequency == 0 ) )
+				{
+					cache.clear();
+				}
+				if( resizeFrequency && ( i % resizeFrequency == 0 ) )
+				{
+					cache.setMaxCost( ( i / resizeFrequency ) % 2 ? maxCost / 2 : maxCost );
+				}
+			}
+		}
+	);
+}
+
+// Hash cache benchmark
+// ====================
+//
+// Simulates the hash cache accesses made by a parallel traversal of a deep
+// scene generated by a chain of nodes. Each location has one plug per node
+// for each of `childNames`, `transform` and `attributes`. The hash for a plug
+// depends on the hash of the same plug on the upstream node, and for
+// `attributes`, on the hash at the parent location too, in the same way as
+// attribute inheritance via `ScenePlug::fullAttributes()`. Parent locations
+// are shared between the tasks that traverse sibling locations, which will
+// often run on different threads.
+
+// Mirrors the key used by `ValuePlug::HashProcess`.
+struct HashCacheKey
+{
+	const void *plug;
+	IECore::MurmurHash contextHash;
+	uint64_t dirtyCount;
+
+	bool operator == ( const HashCacheKey &other ) const
+	{
+		return other.plug == plug && other.contextHash == contextHash && dirtyCount == other.dirtyCount;
+	}
+};
+
+size_t hash_value( const HashCacheKey &key )
+{
+	size_t result = 0;
+	boost::hash_combine( result, key.plug );
+	boost::hash_combine( result, key.contextHash );
+	boost::hash_combine( result, key.dirtyCount );
+	return result;
+}
+
+// A single cache shared by all threads.
+struct SharedHashCache
+{
+
+	SharedHashCache( size_t maxEntries )
+		:	m_cache( maxEntries )
+	{
+	}
+
+	std::optional<IECore::MurmurHash> getIfCached( const HashCacheKey &key )
+	{
+		return m_cache.getIfCached( key );
+	}
+
+	void setIfUncached( const HashCacheKey &key, const IECore::MurmurHash &value )
+	{
+		m_cache.setIfUncached( key, value );
+	}
+
+	ConcurrentCache<HashCacheKey, IECore::MurmurHash> m_cache;
+
+};
+
+// A serial LRUCache per thread, as used by `ValuePlug::HashProcess`
+// previously.
+struct PerThreadHashCache
+{
+
+	using Cache = IECorePreview::LRUCache<HashCacheKey, IECore::MurmurHash, IECorePreview::LRUCachePolicy::Serial>;
+
+	PerThreadHashCache( size_t maxEntries )
+		:	m_maxEntries( maxEntries )
+	{
+	}
+
+	std::optional<IECore::MurmurHash> getIfCached( const HashCacheKey &key )
+	{
+		return cache().getIfCached( key );
+	}
+
+	void setIfUncached( const HashCacheKey &key, const IECore::MurmurHash &value )
+	{
+		cache().setIfUncached( key, value, []( const IECore::MurmurHash & ) { return 1; } );
+	}
+
+	Cache &cache()
+	{
+		std::unique_ptr<Cache> &c = m_caches.local();
+		if( !c )
+		{
+			c = std::make_unique<Cache>( Cache::GetterFunction(), m_maxEntries, Cache::RemovalCallback(), /* cacheErrors = */ false );
+		}
+		return *c;
+	}
+
+	const size_t m_maxEntries;
+	tbb::enumerable_thread_specific<std::unique_ptr<Cache>> m_caches;
+
+};
+
+struct Location
+{
+	IECore::MurmurHash hash;
+	const Location *parent;
+};
+
+struct Counts
+{
+	size_t hits = 0;
+	size_t misses = 0;
+};
+
+template<typename Cache>
+struct HashCacheBenchmark
+{
+
+	HashCacheBenchmark( Cache &cache, int depth, int branchingFactor, int numNodes )
+		:	m_cache( cache ), m_depth( depth ), m_branchingFactor( branchingFactor ), m_numNodes( numNodes ),
+			m_plugs( numNodes * g_numPlugs )
+	{
+	}
+
+	void traverse()
+	{
+		Location root = { IECore::MurmurHash().append( "/" ), nullptr };
+		visit( root, 0 );
+	}
+
+	Counts counts()
+	{
+		return m_counts.combine(
+			[] ( const Counts &a, const Counts &b ) {
+				Counts c; c.hits = a.hits + b.hits; c.misses = a.misses + b.misses; return c;
+			}
+		);
+	}
+
+	private :
+
+		static constexpr int g_numPlugs = 3;
+		static constexpr int g_attributesPlug = 2;
+
+		void visit( const Location &location, int depth )
+		{
+			for( int p = 0; p < g_numPlugs; ++p )
+			{
+				hash( m_numNodes - 1, p, location );
+			}
+
+			if( depth == m_depth )
+			{
+				return;
+			}
+
+			tbb::parallel_for(
+				tbb::blocked_range<int>( 0, m_branchingFactor ),
+				[&]( const tbb::blocked_range<int> &r ) {
+					for( int i = r.begin(); i != r.end(); ++i )
+					{
+						Location child = { IECore::MurmurHash( location.hash ).append( i ), &location };
+						visit( child, depth + 1 );
+					}
+				}
+			);
+		}
+
+		IECore::MurmurHash hash( int node, int plug, const Location &location )
+		{
+			const HashCacheKey key = { &m_plugs[node * g_numPlugs + plug], location.hash, 1 };
+			Counts &counts = m_counts.local();
+			if( auto h = m_cache.getIfCached( key ) )
+			{
+				counts.hits++;
+				return *h;
+			}
+			counts.misses++;
+
+			IECore::MurmurHash result;
+			result.append( node );
+			result.append( plug );
+			if( node > 0 )
+			{
+				result.append( hash( node - 1, plug, location ) );
+			}
+			if( plug == g_attributesPlug && location.parent )
+			{
+				result.append( hash( node, plug, *location.parent ) );
+			}
+
+			m_cache.setIfUncached( key, result );
+			return result;
+		}
+
+		Cache &m_cache;
+		const int m_depth;
+		const int m_branchingFactor;
+		const int m_numNodes;
+		// Only used for their addresses, which stand in for plugs.
+		std::vector<char> m_plugs;
+		tbb::enumerable_thread_specific<Counts> m_counts;
+
+};
+
+template<typename Cache>
+dict benchmarkHashCacheInternal( int numThreads, int depth, int branchingFactor, int numNodes, int numPasses, size_t maxEntries )
+{
+	Counts counts;
+	std::chrono::duration<double> duration;
+	{
+		IECorePython::ScopedGILRelease gilRelease;
+
+		Cache cache( maxEntries );
+		HashCacheBenchmark<Cache> benchmark( cache, depth, branchingFactor, numNodes );
+
+		tbb::task_arena arena( numThreads );
+		const auto startTime = std::chrono::steady_clock::now();
+		arena.execute(
+			[&] {
+				for( int i = 0; i < numPasses; ++i )
+				{
+					benchmark.traverse();
+				}
+			}
+		);
+		duration = std::chrono::steady_clock::now() - startTime;
+		counts = benchmark.counts();
+	}
+
+	const size_t lookups = counts.hits + counts.misses;
+
+	dict result;
+	result["hits"] = counts.hits;
+	result["misses"] = counts.misses;
+	result["hitRate"] = lookups ? (double)counts.hits / lookups : 0.0;
+	result["time"] = duration.count();
+	result["throughput"] = lookups / duration.count();
+	return result;
+}
+
+dict benchmarkHashCache( const std::string &cache, int numThreads, int depth, int branchingFactor, int numNodes, int numPasses, size_t maxEntries )
+{
+	if( cache == "shared" )
+	{
+		return benchmarkHashCacheInternal<SharedHashCache>( numThreads, depth, branchingFactor, numNodes, numPasses, maxEntries );
+	}
+	else
+	{
+		GAFFERTEST_ASSERT( cache == "perThread" );
+		return benchmarkHashCacheInternal<PerThreadHashCache>( numThreads, depth, branchingFactor, numNodes, numPasses, maxEntries );
+	}
+}
+
+} // namespace
+
+void GafferTestModule::bindConcurrentCacheTest()
+{
+	def( "testConcurrentCache", &testConcurrentCache );
+	def( "testConcurrentCacheConcurrency", &testConcurrentCacheConcurrency, ( arg( "numIterations" ), arg( "numValues" ), arg( "maxCost" ), arg( "clearFrequency" ) = 0, arg( "resizeFrequency" ) = 0 ) );
+	def(
+		"benchmarkHashCache", &benchmarkHashCache,
+		(
+			arg( "cache" ), arg( "numThreads" ), arg( "depth" ) = 5, arg( "branchingFactor" ) = 6,
+			arg( "numNodes" ) = 10, arg( "numPasses" ) = 2, arg( "maxEntries" ) = 1024 * 1024
+		)
+	);
+}
@@ -45,6 +45,7 @@
 #include "GafferTest/RandomTest.h"
 #include "GafferTest/RecursiveChildIteratorTest.h"
 
+#include "ConcurrentCacheTest.h"
 #include "LRUCacheTest.h"
 #include "TaskMutexTest.h"
 #include "ValuePlugTest.h"
@@ -106,6 +107,7 @@ BOOST_PYTHON_MODULE( _GafferTest )
 	def( "countContextHash32Collisions", &countContextHash32CollisionsWrapper );
 	def( "testContextHashPerformance", &testContextHashPerformance );
 	def( "testContextCopyPerformance", &testContextCopyPerformance );
+	def( "testEditableScopePerformance", &testEditableScopePerformance );
 	def( "testCopyEditableScope", &testCopyEditableScope );
 	def( "testContextHashValidation", &testContextHashValidation );
 	def( "testComputeNodeThreading", &testComputeNodeThreading );
@@ -114,6 +116,7 @@ BOOST_PYTHON_MODULE( _GafferTest )
 
 	bindTaskMutexTest();
 	bindLRUCacheTest();
+	bindConcurrentCacheTest();
 	bindValuePlugTest();
 	bindMessagesTest();
 	bindSignalsTest();
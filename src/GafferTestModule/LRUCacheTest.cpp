@@ -42,10 +42,14 @@
 
 #include "Gaffer/Private/IECorePreview/LRUCache.h"
 
+#include "IECorePython/ScopedGILRelease.h"
+
 #include "IECore/Canceller.h"
 
 #include "tbb/parallel_for.h"
 
+#include <chrono>
+
 using namespace IECorePreview;
 using namespace boost::python;
 
@@ -800,6 +804,101 @@ void testLRUCacheSetIfUncached( const std::string &policy )
 	DispatchTest<TestLRUCacheSetIfUncached>()( policy );
 }
 
+struct TraceEntry
+{
+	int key;
+	size_t cost;
+	std::chrono::nanoseconds computeDuration;
+};
+
+struct TraceResult
+{
+	size_t hits = 0;
+	size_t misses = 0;
+	std::chrono::nanoseconds recomputeDuration = std::chrono::nanoseconds( 0 );
+	std::chrono::nanoseconds replayDuration = std::chrono::nanoseconds( 0 );
+};
+
+// Replays a trace of cache accesses, simulating the recomputation of values
+// that are not cached. Used to compare the effectiveness of the eviction
+// policies.
+template<template<typename> class Policy>
+struct ReplayLRUCacheTrace
+{
+
+	ReplayLRUCacheTrace( LRUCacheEvictionPolicy evictionPolicy, const std::vector<TraceEntry> &trace, size_t maxCost, TraceResult &result )
+		:	m_evictionPolicy( evictionPolicy ), m_trace( trace ), m_maxCost( maxCost ), m_result( result )
+	{
+	}
+
+	void operator()()
+	{
+		using Cache = LRUCache<int, int, Policy>;
+		// Null getter because we only use `getIfCached()` and `set()`, in the
+		// same way as the ValuePlug compute cache does.
+		Cache cache( typename Cache::GetterFunction(), m_maxCost );
+		cache.setEvictionPolicy( m_evictionPolicy );
+
+		const auto startTime = std::chrono::steady_clock::now();
+		for( const auto &entry : m_trace )
+		{
+			if( cache.getIfCached( entry.key ) )
+			{
+				m_result.hits++;
+			}
+			else
+			{
+				m_result.misses++;
+				m_result.recomputeDuration += entry.computeDuration;
+				cache.set( entry.key, entry.key, entry.cost, entry.computeDuration );
+			}
+		}
+		m_result.replayDuration = std::chrono::steady_clock::now() - startTime;
+	}
+
+	private :
+
+		const LRUCacheEvictionPolicy m_evictionPolicy;
+		const std::vector<TraceEntry> &m_trace;
+		const size_t m_maxCost;
+		TraceResult &m_result;
+
+};
+
+dict replayLRUCacheTrace( const std::string &policy, const std::string &evictionPolicy, object pythonTrace, size_t maxCost )
+{
+	GAFFERTEST_ASSERT( evictionPolicy == "lru" || evictionPolicy == "costAware" );
+
+	std::vector<TraceEntry> trace;
+	const size_t size = len( pythonTrace );
+	trace.reserve( size );
+	for( size_t i = 0; i < size; ++i )
+	{
+		object entry = pythonTrace[i];
+		trace.push_back( {
+			extract<int>( entry[0] ),
+			extract<size_t>( entry[1] ),
+			std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::duration<double>( extract<double>( entry[2] ) ) )
+		} );
+	}
+
+	TraceResult result;
+	{
+		IECorePython::ScopedGILRelease gilRelease;
+		DispatchTest<ReplayLRUCacheTrace>()(
+			policy, evictionPolicy == "costAware" ? LRUCacheEvictionPolicy::CostAware : LRUCacheEvictionPolicy::LRU,
+			trace, maxCost, result
+		);
+	}
+
+	dict d;
+	d["hits"] = result.hits;
+	d["misses"] = result.misses;
+	d["recomputeTime"] = std::chrono::duration<double>( result.recomputeDuration ).count();
+	d["replayTime"] = std::chrono::duration<double>( result.replayDuration ).count();
+	return d;
+}
+
 } // namespace
 
 void GafferTestModule::bindLRUCacheTest()
@@ -815,4 +914,5 @@ void GafferTestModule::bindLRUCacheTest()
 	def( "testLRUCacheUncacheableItem", &testLRUCacheUncacheableItem );
 	def( "testLRUCacheGetIfCached", &testLRUCacheGetIfCached );
 	def( "testLRUCacheSetIfUncached", &testLRUCacheSetIfUncached );
+	def( "replayLRUCacheTrace", &replayLRUCacheTrace, ( arg( "policy" ), arg( "evictionPolicy" ), arg( "trace" ), arg( "maxCost" ) ) );
 }
@@ -34,6 +34,7 @@
 #
 ##########################################################################
 
+import os
 import psutil
 
 import Gaffer
@@ -44,3 +45,26 @@ import Gaffer
 Gaffer.ValuePlug.setCacheMemoryLimit(
 	min( 1024**3 * 8, psutil.virtual_memory().total * 3 // 4 )
 )
+
+# Enable the optional disk cache if a directory has been
+# specified for it.
+
+if "GAFFER_DISK_CACHE_DIRECTORY" in os.environ :
+	Gaffer.ValuePlug.setDiskCacheDirectory( os.environ["GAFFER_DISK_CACHE_DIRECTORY"] )
+
+# Allow the eviction policy for the cache to be chosen
+# for benchmarking and production trials.
+
+if "GAFFER_CACHE_EVICTION_POLICY" in os.environ :
+	Gaffer.ValuePlug.setCacheEvictionPolicy(
+		getattr( Gaffer.ValuePlug.CacheEvictionPolicy, os.environ["GAFFER_CACHE_EVICTION_POLICY"] )
+	)
+
+# Give named partitions of the cache their own memory limits, so that
+# memory pressure in one subsystem doesn't evict the values computed by
+# another. The variable contains a space separated list of `name:megabytes`
+# pairs, for example `sceneObjects:4096 scene:1024 imageTiles:2048`.
+
+for partition in os.environ.get( "GAFFER_CACHE_PARTITIONS", "" ).split() :
+	name, megabytes = partition.split( ":" )
+	Gaffer.ValuePlug.setCachePartitionMemoryLimit( name, int( megabytes ) * 1024 * 1024 )